@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file benchmark.cpp
+//! \brief Benchmark runner and allocation counting for edie_benchmarks.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "benchmarks/benchmark.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <vector>
+
+#include "logger/logger.hpp"
+
+namespace {
+std::atomic<uint64_t> ullAllocations{0};
+std::string strProjectRoot{"."};
+
+struct RegisteredBenchmark
+{
+    const char* szName;
+    edie::benchmark::BenchmarkFunction pfBenchmark;
+};
+
+std::vector<RegisteredBenchmark>& Registry()
+{
+    static std::vector<RegisteredBenchmark> vRegistry;
+    return vRegistry;
+}
+
+void* CountedAlloc(std::size_t sz)
+{
+    ullAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* pvMemory = std::malloc(sz != 0 ? sz : 1)) { return pvMemory; }
+    throw std::bad_alloc();
+}
+} // namespace
+
+// Every heap allocation in the process goes through here so the runner can count them.
+void* operator new(std::size_t sz) { return CountedAlloc(sz); }
+void* operator new[](std::size_t sz) { return CountedAlloc(sz); }
+void operator delete(void* pvMemory) noexcept { std::free(pvMemory); }
+void operator delete[](void* pvMemory) noexcept { std::free(pvMemory); }
+void operator delete(void* pvMemory, std::size_t) noexcept { std::free(pvMemory); }
+void operator delete[](void* pvMemory, std::size_t) noexcept { std::free(pvMemory); }
+
+// -------------------------------------------------------------------------------------------------------
+uint64_t edie::benchmark::AllocationCount() { return ullAllocations.load(std::memory_order_relaxed); }
+
+// -------------------------------------------------------------------------------------------------------
+const std::string& edie::benchmark::ProjectRoot() { return strProjectRoot; }
+
+// -------------------------------------------------------------------------------------------------------
+std::filesystem::path edie::benchmark::WriteTemporaryFile(const std::string& strName_, std::string_view strContents_)
+{
+    std::error_code ec;
+    std::filesystem::path clPath = std::filesystem::temp_directory_path(ec) / strName_;
+    if (ec) { return {}; }
+
+    std::ofstream clFile(clPath, std::ios::binary | std::ios::trunc);
+    clFile.write(strContents_.data(), static_cast<std::streamsize>(strContents_.size()));
+    return clFile.good() ? clPath : std::filesystem::path();
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool edie::benchmark::RegisterBenchmark(const char* szName_, BenchmarkFunction pfBenchmark_)
+{
+    Registry().push_back({szName_, pfBenchmark_});
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3) { throw std::invalid_argument("Usage: <project root> [benchmark name filter]"); }
+
+    strProjectRoot = argv[1];
+    const char* szFilter = argc == 3 ? argv[2] : "";
+
+    Logger::InitLogger();
+
+    constexpr double dMinSeconds = 0.5;
+    constexpr uint64_t ullMaxIterations = 1000000000ULL;
+
+    printf("%-48s %14s %12s %14s %14s %12s\n", "Benchmark", "Time/iter", "Iterations", "Bytes/s", "Messages/s", "Allocs/msg");
+
+    for (const RegisteredBenchmark& stBenchmark : Registry())
+    {
+        if (strstr(stBenchmark.szName, szFilter) == nullptr) { continue; }
+
+        uint64_t ullIterations = 1;
+        while (true)
+        {
+            edie::benchmark::State clState(ullIterations);
+            stBenchmark.pfBenchmark(clState);
+
+            if (!clState.Error().empty())
+            {
+                printf("%-48s ERROR: %s\n", stBenchmark.szName, clState.Error().c_str());
+                break;
+            }
+
+            const double dSeconds = clState.Seconds();
+            if (dSeconds >= dMinSeconds || ullIterations >= ullMaxIterations)
+            {
+                const double dItems = static_cast<double>(clState.ItemsProcessed());
+                printf("%-48s %11.0f ns %12llu %12.3e/s %12.3e/s %12.2f\n", stBenchmark.szName, dSeconds * 1e9 / static_cast<double>(ullIterations),
+                       static_cast<unsigned long long>(ullIterations), static_cast<double>(clState.BytesProcessed()) / dSeconds, dItems / dSeconds,
+                       dItems > 0 ? static_cast<double>(clState.Allocations()) / dItems : 0.0);
+                break;
+            }
+
+            // Aim a little past the minimum time, growing at most tenfold per attempt
+            const double dScale = dSeconds > 0.0 ? 1.4 * dMinSeconds / dSeconds : 10.0;
+            ullIterations = std::clamp(static_cast<uint64_t>(static_cast<double>(ullIterations) * std::min(dScale, 10.0)), ullIterations + 1,
+                                       ullMaxIterations);
+        }
+    }
+
+    Logger::Shutdown();
+    return 0;
+}
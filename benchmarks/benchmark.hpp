@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file benchmark.hpp
+//! \brief Minimal benchmark registry and runner, modelled on the
+//! Google Benchmark API.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef EDIE_BENCHMARK_HPP
+#define EDIE_BENCHMARK_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace edie::benchmark {
+
+//----------------------------------------------------------------------------
+//! \brief Get the number of heap allocations made by the process so far.
+//----------------------------------------------------------------------------
+uint64_t AllocationCount();
+
+//----------------------------------------------------------------------------
+//! \brief Get the path to the project root given on the command line.
+//----------------------------------------------------------------------------
+const std::string& ProjectRoot();
+
+//----------------------------------------------------------------------------
+//! \brief Write a benchmark input to a file in the temporary directory,
+//! replacing any earlier file of the same name.
+//
+//! \return The path to the file, or an empty path if it couldn't be written.
+//----------------------------------------------------------------------------
+std::filesystem::path WriteTemporaryFile(const std::string& strName_, std::string_view strContents_);
+
+//============================================================================
+//! \class State
+//! \brief Drives the timed loop of a single benchmark run and collects the
+//! amount of work it reports.
+//
+//! A benchmark does its setup, then runs the measured code inside
+//! `for (auto _ : state)`. Only the loop itself is timed and has its
+//! allocations counted.
+//============================================================================
+class State
+{
+  public:
+    class Iterator
+    {
+        State* pclMyState;
+        uint64_t ullMyRemaining;
+
+      public:
+        Iterator(State* pclState_, uint64_t ullRemaining_) : pclMyState(pclState_), ullMyRemaining(ullRemaining_) {}
+
+        bool operator!=(const Iterator&)
+        {
+            if (ullMyRemaining != 0) { return true; }
+            pclMyState->Stop();
+            return false;
+        }
+
+        Iterator& operator++()
+        {
+            --ullMyRemaining;
+            return *this;
+        }
+
+        int operator*() const { return 0; }
+    };
+
+    explicit State(uint64_t ullIterations_) : ullMyIterations(ullIterations_) {}
+
+    Iterator begin()
+    {
+        ullMyStartAllocations = AllocationCount();
+        tpMyStart = std::chrono::steady_clock::now();
+        return {this, ullMyIterations};
+    }
+
+    Iterator end() { return {this, 0}; }
+
+    //! Bytes consumed by the whole run, used to report a throughput.
+    void SetBytesProcessed(uint64_t ullBytes_) { ullMyBytes = ullBytes_; }
+
+    //! Messages handled by the whole run, used to report a rate and allocations per message.
+    void SetItemsProcessed(uint64_t ullItems_) { ullMyItems = ullItems_; }
+
+    //! Abandon the benchmark, e.g. when its input couldn't be loaded.
+    void SkipWithError(std::string strError_) { strMyError = std::move(strError_); }
+
+    [[nodiscard]] uint64_t iterations() const { return ullMyIterations; }
+    [[nodiscard]] uint64_t BytesProcessed() const { return ullMyBytes; }
+    [[nodiscard]] uint64_t ItemsProcessed() const { return ullMyItems; }
+    [[nodiscard]] uint64_t Allocations() const { return ullMyAllocations; }
+    [[nodiscard]] double Seconds() const { return std::chrono::duration<double>(tpMyStop - tpMyStart).count(); }
+    [[nodiscard]] const std::string& Error() const { return strMyError; }
+
+  private:
+    void Stop()
+    {
+        tpMyStop = std::chrono::steady_clock::now();
+        ullMyAllocations = AllocationCount() - ullMyStartAllocations;
+    }
+
+    uint64_t ullMyIterations;
+    uint64_t ullMyBytes{0};
+    uint64_t ullMyItems{0};
+    uint64_t ullMyStartAllocations{0};
+    uint64_t ullMyAllocations{0};
+    std::chrono::steady_clock::time_point tpMyStart;
+    std::chrono::steady_clock::time_point tpMyStop;
+    std::string strMyError;
+};
+
+typedef void (*BenchmarkFunction)(State&);
+
+//----------------------------------------------------------------------------
+//! \brief Add a benchmark to the set run by edie_benchmarks.
+//
+//! \return Always true, so that registration can initialize a static.
+//----------------------------------------------------------------------------
+bool RegisterBenchmark(const char* szName_, BenchmarkFunction pfBenchmark_);
+
+//----------------------------------------------------------------------------
+//! \brief Keep the compiler from optimizing away a result.
+//----------------------------------------------------------------------------
+template <typename T> inline void DoNotOptimize(T&& tValue_)
+{
+#if defined(_MSC_VER)
+    static const void* volatile pvSink;
+    pvSink = &tValue_;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&tValue_) : "memory");
+#endif
+}
+
+} // namespace edie::benchmark
+
+#define EDIE_BENCHMARK_CONCAT2(a, b) a##b
+#define EDIE_BENCHMARK_CONCAT(a, b)  EDIE_BENCHMARK_CONCAT2(a, b)
+#define BENCHMARK(function) \
+    [[maybe_unused]] static const bool EDIE_BENCHMARK_CONCAT(bRegistered, __LINE__) = edie::benchmark::RegisterBenchmark(#function, function)
+
+#endif // EDIE_BENCHMARK_HPP
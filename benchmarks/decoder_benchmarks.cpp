@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file decoder_benchmarks.cpp
+//! \brief Benchmarks of MessageDecoder on RANGE message bodies.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <vector>
+
+#include "benchmarks/benchmark.hpp"
+#include "benchmarks/range_message.hpp"
+#include "decoders/novatel/api/message_decoder.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+using edie::benchmark::RangeInput;
+using edie::benchmark::State;
+
+namespace {
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T> void DecodeRange(State& state, HEADERFORMAT eFormat_)
+{
+    RangeInput stInput(eFormat_);
+    MessageDecoder clDecoder(&stInput.clJsonDb);
+    T stMessage;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        if (clDecoder.Decode(stInput.vBody.data(), stMessage, stInput.stMetaData) != STATUS::SUCCESS)
+        {
+            state.SkipWithError("Failed to decode RANGE");
+            return;
+        }
+        edie::benchmark::DoNotOptimize(stMessage);
+    }
+
+    state.SetBytesProcessed(state.iterations() * stInput.vBody.size());
+    state.SetItemsProcessed(state.iterations());
+}
+
+// -------------------------------------------------------------------------------------------------------
+// Exposes the decoder entry points that take a message definition's field list directly
+class FieldListDecoder : public MessageDecoder
+{
+  public:
+    using MessageDecoder::MessageDecoder;
+    using MessageDecoderBase::DecodeAscii;
+};
+
+// -------------------------------------------------------------------------------------------------------
+void BM_DecodeRangeAsciiFieldList(State& state)
+{
+    RangeInput stInput(HEADERFORMAT::ASCII);
+    FieldListDecoder clDecoder(&stInput.clJsonDb);
+    const std::vector<BaseField*>& vFields = stInput.clJsonDb.GetMsgDef(43)->fields.at(0);
+    IntermediateMessage stMessage;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        stMessage.clear();
+        stMessage.reserve(vFields.size());
+        char* pcBody = reinterpret_cast<char*>(stInput.vBody.data());
+        if (clDecoder.DecodeAscii<false>(vFields, &pcBody, stMessage) != STATUS::SUCCESS)
+        {
+            state.SkipWithError("Failed to decode RANGE");
+            return;
+        }
+        edie::benchmark::DoNotOptimize(stMessage);
+    }
+
+    state.SetBytesProcessed(state.iterations() * stInput.vBody.size());
+    state.SetItemsProcessed(state.iterations());
+}
+
+// -------------------------------------------------------------------------------------------------------
+void BM_DecodeRangeAscii(State& state) { DecodeRange<IntermediateMessage>(state, HEADERFORMAT::ASCII); }
+void BM_DecodeRangeAsciiFlat(State& state) { DecodeRange<FlatIntermediateMessage>(state, HEADERFORMAT::ASCII); }
+void BM_DecodeRangeBinary(State& state) { DecodeRange<IntermediateMessage>(state, HEADERFORMAT::BINARY); }
+void BM_DecodeRangeBinaryFlat(State& state) { DecodeRange<FlatIntermediateMessage>(state, HEADERFORMAT::BINARY); }
+
+} // namespace
+
+BENCHMARK(BM_DecodeRangeAscii);
+BENCHMARK(BM_DecodeRangeAsciiFlat);
+BENCHMARK(BM_DecodeRangeBinary);
+BENCHMARK(BM_DecodeRangeBinaryFlat);
+BENCHMARK(BM_DecodeRangeAsciiFieldList);
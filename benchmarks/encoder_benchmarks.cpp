@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file encoder_benchmarks.cpp
+//! \brief Benchmarks of Encoder on a decoded RANGE message.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <vector>
+
+#include "benchmarks/benchmark.hpp"
+#include "benchmarks/range_message.hpp"
+#include "decoders/novatel/api/encoder.hpp"
+#include "decoders/novatel/api/message_decoder.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+using edie::benchmark::RangeInput;
+using edie::benchmark::State;
+
+namespace {
+
+// -------------------------------------------------------------------------------------------------------
+void EncodeRange(State& state, ENCODEFORMAT eFormat_)
+{
+    RangeInput stInput(HEADERFORMAT::BINARY);
+    MessageDecoder clDecoder(&stInput.clJsonDb);
+    Encoder clEncoder(&stInput.clJsonDb);
+    IntermediateMessage stMessage;
+    if (clDecoder.Decode(stInput.vBody.data(), stMessage, stInput.stMetaData) != STATUS::SUCCESS)
+    {
+        state.SkipWithError("Failed to decode RANGE");
+        return;
+    }
+
+    IntermediateHeader stHeader = edie::benchmark::RangeHeader();
+
+    std::vector<unsigned char> vBuffer(64 * 1024);
+    MessageDataStruct stMessageData;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        unsigned char* pucBuffer = vBuffer.data();
+        if (clEncoder.Encode(&pucBuffer, static_cast<uint32_t>(vBuffer.size()), stHeader, stMessage, stMessageData, stInput.stMetaData, eFormat_) !=
+            STATUS::SUCCESS)
+        {
+            state.SkipWithError("Failed to encode RANGE");
+            return;
+        }
+        edie::benchmark::DoNotOptimize(stMessageData);
+    }
+
+    state.SetBytesProcessed(state.iterations() * stMessageData.uiMessageLength);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// -------------------------------------------------------------------------------------------------------
+void BM_EncodeRangeAscii(State& state) { EncodeRange(state, ENCODEFORMAT::ASCII); }
+void BM_EncodeRangeAbbrevAscii(State& state) { EncodeRange(state, ENCODEFORMAT::ABBREV_ASCII); }
+void BM_EncodeRangeJson(State& state) { EncodeRange(state, ENCODEFORMAT::JSON); }
+void BM_EncodeRangeBinary(State& state) { EncodeRange(state, ENCODEFORMAT::BINARY); }
+
+} // namespace
+
+BENCHMARK(BM_EncodeRangeAscii);
+BENCHMARK(BM_EncodeRangeAbbrevAscii);
+BENCHMARK(BM_EncodeRangeJson);
+BENCHMARK(BM_EncodeRangeBinary);
@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file fileparser_benchmarks.cpp
+//! \brief End-to-end benchmarks of FileParser converting log files.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "benchmarks/benchmark.hpp"
+#include "benchmarks/range_message.hpp"
+#include "decoders/novatel/api/fileparser.hpp"
+#include "hw_interface/stream_interface/api/inputfilestream.hpp"
+#include "hw_interface/stream_interface/api/inputmappedfilestream.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+using edie::benchmark::State;
+
+namespace {
+
+constexpr uint32_t uiSyntheticLogs = 1000;
+constexpr uint32_t uiRecordingRepeats = 2000;
+// Small enough that the synthetic files are split into a few chunks per thread
+constexpr uint64_t ullChunkSize = 256 * 1024;
+
+// -------------------------------------------------------------------------------------------------------
+template <typename InputStream = InputFileStream>
+void ParseFile(State& state, JsonReader& clJsonDb_, const std::filesystem::path& clPath_, ENCODEFORMAT eFormat_, uint32_t uiThreads_ = 1,
+               uint32_t uiChunkThreads_ = 1)
+{
+    std::error_code ec;
+    const uintmax_t ullSize = std::filesystem::file_size(clPath_, ec);
+    if (clPath_.empty() || ec)
+    {
+        state.SkipWithError("Couldn't find the input file");
+        return;
+    }
+
+    FileParser clFileParser(&clJsonDb_);
+    clFileParser.SetEncodeFormat(eFormat_);
+    clFileParser.SetWorkerThreads(uiThreads_);
+    clFileParser.SetChunkThreads(uiChunkThreads_, ullChunkSize);
+    const std::string strPath = clPath_.string();
+    MetaDataStruct stMetaData;
+    MessageDataStruct stMessageData;
+    uint64_t ullMessages = 0;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        InputStream clInputStream(strPath.c_str());
+        if (!clFileParser.SetStream(&clInputStream))
+        {
+            state.SkipWithError("Couldn't read " + strPath);
+            return;
+        }
+
+        STATUS eStatus = STATUS::UNKNOWN;
+        while (eStatus != STATUS::STREAM_EMPTY)
+        {
+            eStatus = clFileParser.Read(stMessageData, stMetaData);
+            if (eStatus == STATUS::SUCCESS) { ++ullMessages; }
+        }
+        edie::benchmark::DoNotOptimize(stMessageData);
+    }
+
+    if (ullMessages == 0)
+    {
+        state.SkipWithError("No messages were converted");
+        return;
+    }
+
+    state.SetBytesProcessed(state.iterations() * ullSize);
+    state.SetItemsProcessed(ullMessages);
+}
+
+// -------------------------------------------------------------------------------------------------------
+template <typename InputStream = InputFileStream>
+void ParseRangeFile(State& state, ENCODEFORMAT eInputFormat_, ENCODEFORMAT eOutputFormat_, uint32_t uiThreads_ = 1, uint32_t uiChunkThreads_ = 1)
+{
+    const std::vector<unsigned char> vLog = edie::benchmark::EncodeRangeLog(eInputFormat_);
+    std::string strFile;
+    for (uint32_t i = 0; i < uiSyntheticLogs; ++i) { strFile.append(vLog.begin(), vLog.end()); }
+
+    JsonReader clJsonDb;
+    clJsonDb.ParseJson(edie::benchmark::szRangeJsonDb);
+    ParseFile<InputStream>(state, clJsonDb, edie::benchmark::WriteTemporaryFile("edie_benchmark_range.gps", strFile), eOutputFormat_, uiThreads_,
+                           uiChunkThreads_);
+}
+
+void BM_FileParserRangeBinaryToAscii(State& state) { ParseRangeFile(state, ENCODEFORMAT::BINARY, ENCODEFORMAT::ASCII); }
+void BM_FileParserRangeAsciiToBinary(State& state) { ParseRangeFile(state, ENCODEFORMAT::ASCII, ENCODEFORMAT::BINARY); }
+void BM_FileParserRangeAsciiToJson(State& state) { ParseRangeFile(state, ENCODEFORMAT::ASCII, ENCODEFORMAT::JSON); }
+void BM_FileParserRangeBinaryToAscii4Threads(State& state) { ParseRangeFile(state, ENCODEFORMAT::BINARY, ENCODEFORMAT::ASCII, 4); }
+void BM_FileParserRangeAsciiToJson4Threads(State& state) { ParseRangeFile(state, ENCODEFORMAT::ASCII, ENCODEFORMAT::JSON, 4); }
+void BM_FileParserRangeBinaryToAsciiMapped(State& state) { ParseRangeFile<InputMappedFileStream>(state, ENCODEFORMAT::BINARY, ENCODEFORMAT::ASCII); }
+void BM_FileParserRangeAsciiToBinaryMapped(State& state) { ParseRangeFile<InputMappedFileStream>(state, ENCODEFORMAT::ASCII, ENCODEFORMAT::BINARY); }
+void BM_FileParserRangeBinaryToAscii4Chunks(State& state) { ParseRangeFile(state, ENCODEFORMAT::BINARY, ENCODEFORMAT::ASCII, 1, 4); }
+void BM_FileParserRangeAsciiToJson4Chunks(State& state) { ParseRangeFile(state, ENCODEFORMAT::ASCII, ENCODEFORMAT::JSON, 1, 4); }
+
+// -------------------------------------------------------------------------------------------------------
+// A long recording made of the regression data set over and over, converted with the full UI DB
+void BM_FileParserBestUtmBinToAscii(State& state)
+{
+    const std::filesystem::path clRoot(edie::benchmark::ProjectRoot());
+    const std::filesystem::path clDatabase = clRoot / "database" / "messages_public.json";
+    if (!std::filesystem::exists(clDatabase))
+    {
+        state.SkipWithError("Couldn't find " + clDatabase.string());
+        return;
+    }
+
+    std::ifstream clRecording(clRoot / "regression" / "BESTUTMBIN.GPS", std::ios::binary);
+    const std::string strRecording{std::istreambuf_iterator<char>(clRecording), std::istreambuf_iterator<char>()};
+    if (strRecording.empty())
+    {
+        state.SkipWithError("Couldn't read regression/BESTUTMBIN.GPS");
+        return;
+    }
+
+    std::string strFile;
+    for (uint32_t i = 0; i < uiRecordingRepeats; ++i) { strFile += strRecording; }
+
+    JsonReader clJsonDb;
+    clJsonDb.LoadFile(clDatabase.string());
+    ParseFile(state, clJsonDb, edie::benchmark::WriteTemporaryFile("edie_benchmark_bestutmbin.gps", strFile), ENCODEFORMAT::ASCII);
+}
+
+} // namespace
+
+BENCHMARK(BM_FileParserRangeBinaryToAscii);
+BENCHMARK(BM_FileParserRangeAsciiToBinary);
+BENCHMARK(BM_FileParserRangeAsciiToJson);
+BENCHMARK(BM_FileParserRangeBinaryToAscii4Threads);
+BENCHMARK(BM_FileParserRangeAsciiToJson4Threads);
+BENCHMARK(BM_FileParserRangeBinaryToAsciiMapped);
+BENCHMARK(BM_FileParserRangeAsciiToBinaryMapped);
+BENCHMARK(BM_FileParserRangeBinaryToAscii4Chunks);
+BENCHMARK(BM_FileParserRangeAsciiToJson4Chunks);
+BENCHMARK(BM_FileParserBestUtmBinToAscii);
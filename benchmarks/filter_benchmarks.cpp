@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file filter_benchmarks.cpp
+//! \brief Benchmarks of Filter on the metadata of decoded headers.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <array>
+#include <vector>
+
+#include "benchmarks/benchmark.hpp"
+#include "decoders/novatel/api/filter.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+using edie::benchmark::State;
+
+namespace {
+
+constexpr uint32_t uiMessages = 256;
+
+// -------------------------------------------------------------------------------------------------------
+// A 20 Hz stream of a handful of logs in mixed formats, as a receiver logging to one port would produce
+std::vector<MetaDataStruct> MakeMetaData()
+{
+    constexpr std::array<std::pair<uint16_t, const char*>, 4> astLogs{{{42, "BESTPOS"}, {43, "RANGE"}, {140, "RANGECMP"}, {1719, "TERRASTARSTATUS"}}};
+    constexpr std::array<HEADERFORMAT, 3> aeFormats{HEADERFORMAT::BINARY, HEADERFORMAT::ASCII, HEADERFORMAT::ABB_ASCII};
+
+    std::vector<MetaDataStruct> vMetaData;
+    for (uint32_t i = 0; i < uiMessages; ++i)
+    {
+        MetaDataStruct stMetaData(aeFormats[i % aeFormats.size()]);
+        stMetaData.usMessageID = astLogs[i % astLogs.size()].first;
+        stMetaData.MessageName(astLogs[i % astLogs.size()].second);
+        stMetaData.eTimeStatus = i % 16 == 0 ? TIME_STATUS::COARSESTEERING : TIME_STATUS::FINESTEERING;
+        stMetaData.usWeek = 2167;
+        stMetaData.dMilliseconds = 244820000.0 + 50.0 * i;
+        vMetaData.push_back(stMetaData);
+    }
+    return vMetaData;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void FilterMetaData(State& state, Filter& clFilter_)
+{
+    std::vector<MetaDataStruct> vMetaData = MakeMetaData();
+    uint32_t uiPassed = 0;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (MetaDataStruct& stMetaData : vMetaData) { uiPassed += clFilter_.DoFiltering(stMetaData) ? 1 : 0; }
+        edie::benchmark::DoNotOptimize(uiPassed);
+    }
+
+    state.SetItemsProcessed(state.iterations() * vMetaData.size());
+}
+
+// -------------------------------------------------------------------------------------------------------
+void BM_FilterMessageId(State& state)
+{
+    Filter clFilter;
+    clFilter.IncludeMessageId(42, HEADERFORMAT::BINARY);
+    clFilter.IncludeMessageId(43);
+    FilterMetaData(state, clFilter);
+}
+
+void BM_FilterMessageName(State& state)
+{
+    Filter clFilter;
+    clFilter.IncludeMessageName("BESTPOS", HEADERFORMAT::BINARY);
+    clFilter.IncludeMessageName("RANGE");
+    FilterMetaData(state, clFilter);
+}
+
+void BM_FilterAll(State& state)
+{
+    Filter clFilter;
+    clFilter.IncludeMessageId(42, HEADERFORMAT::BINARY);
+    clFilter.IncludeMessageId(43);
+    clFilter.IncludeMessageName("RANGE");
+    clFilter.IncludeTimeStatus(TIME_STATUS::FINESTEERING);
+    clFilter.SetIncludeLowerTimeBound(2167, 244820.5);
+    clFilter.SetIncludeUpperTimeBound(2167, 244830.0);
+    clFilter.SetIncludeDecimation(0.1);
+    FilterMetaData(state, clFilter);
+}
+
+} // namespace
+
+BENCHMARK(BM_FilterMessageId);
+BENCHMARK(BM_FilterMessageName);
+BENCHMARK(BM_FilterAll);
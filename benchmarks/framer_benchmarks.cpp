@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file framer_benchmarks.cpp
+//! \brief Benchmarks of Framer on complete OEM4 logs.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <vector>
+
+#include "benchmarks/benchmark.hpp"
+#include "benchmarks/range_message.hpp"
+#include "decoders/novatel/api/framer.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+using edie::benchmark::State;
+
+namespace {
+
+constexpr uint32_t uiLogsPerWrite = 16;
+
+// -------------------------------------------------------------------------------------------------------
+void FrameRange(State& state, ENCODEFORMAT eFormat_)
+{
+    const std::vector<unsigned char> vLog = edie::benchmark::EncodeRangeLog(eFormat_);
+    if (vLog.empty())
+    {
+        state.SkipWithError("Failed to encode RANGE");
+        return;
+    }
+
+    // The framer is fed a batch of back-to-back logs at a time, as it would be from a stream
+    std::vector<unsigned char> vLogs;
+    for (uint32_t i = 0; i < uiLogsPerWrite; ++i) { vLogs.insert(vLogs.end(), vLog.begin(), vLog.end()); }
+
+    Framer clFramer;
+    std::vector<unsigned char> vFrame(vLog.size() + 1);
+    MetaDataStruct stMetaData;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        if (clFramer.Write(vLogs.data(), static_cast<uint32_t>(vLogs.size())) != vLogs.size())
+        {
+            state.SkipWithError("The framer's buffer is too small");
+            return;
+        }
+
+        for (uint32_t i = 0; i < uiLogsPerWrite; ++i)
+        {
+            if (clFramer.GetFrame(vFrame.data(), static_cast<uint32_t>(vFrame.size()), stMetaData) != STATUS::SUCCESS ||
+                stMetaData.uiLength != vLog.size())
+            {
+                state.SkipWithError("Failed to frame RANGE");
+                return;
+            }
+        }
+        edie::benchmark::DoNotOptimize(vFrame);
+    }
+
+    state.SetBytesProcessed(state.iterations() * vLogs.size());
+    state.SetItemsProcessed(state.iterations() * uiLogsPerWrite);
+}
+
+// -------------------------------------------------------------------------------------------------------
+void BM_FrameRangeAscii(State& state) { FrameRange(state, ENCODEFORMAT::ASCII); }
+void BM_FrameRangeBinary(State& state) { FrameRange(state, ENCODEFORMAT::BINARY); }
+
+} // namespace
+
+BENCHMARK(BM_FrameRangeAscii);
+BENCHMARK(BM_FrameRangeBinary);
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file header_benchmarks.cpp
+//! \brief Benchmarks of HeaderDecoder on OEM4 headers.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <cstring>
+#include <string>
+
+#include "benchmarks/benchmark.hpp"
+#include "decoders/novatel/api/header_decoder.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+using edie::benchmark::State;
+
+namespace {
+
+// The parts of the UI DB that a header refers to, so that the benchmarks don't depend on a database file
+constexpr const char* szHeaderJsonDb = R"({
+    "enums": [{
+        "_id": "PortAddress", "name": "PortAddress",
+        "enumerators": [
+            { "value": 0, "name": "NO_PORTS", "description": null }, { "value": 32, "name": "COM1", "description": null },
+            { "value": 64, "name": "COM2", "description": null }, { "value": 96, "name": "COM3", "description": null },
+            { "value": 160, "name": "THISPORT", "description": null }, { "value": 192, "name": "ALL_PORTS", "description": null },
+            { "value": 1440, "name": "USB1", "description": null }, { "value": 2976, "name": "ICOM1", "description": null }
+        ]
+    }, {
+        "_id": "GPSTimeStatus", "name": "GPSTimeStatus",
+        "enumerators": [
+            { "value": 20, "name": "UNKNOWN", "description": null }, { "value": 60, "name": "APPROXIMATE", "description": null },
+            { "value": 80, "name": "COARSEADJUSTING", "description": null }, { "value": 100, "name": "COARSE", "description": null },
+            { "value": 130, "name": "FREEWHEELING", "description": null }, { "value": 140, "name": "FINEADJUSTING", "description": null },
+            { "value": 160, "name": "FINE", "description": null }, { "value": 170, "name": "FINEBACKUPSTEERING", "description": null },
+            { "value": 180, "name": "FINESTEERING", "description": null }, { "value": 200, "name": "SATTIME", "description": null }
+        ]
+    }],
+    "logs": [
+        { "_id": "42", "messageID": 42, "name": "BESTPOS", "description": null, "latestMsgDefCrc": "0", "fields": { "0": [] } },
+        { "_id": "43", "messageID": 43, "name": "RANGE", "description": null, "latestMsgDefCrc": "0", "fields": { "0": [] } },
+        { "_id": "1719", "messageID": 1719, "name": "TERRASTARSTATUS", "description": null, "latestMsgDefCrc": "0", "fields": { "0": [] } }
+    ]
+})";
+
+// -------------------------------------------------------------------------------------------------------
+void DecodeHeader(State& state, const char* szHeader_, uint16_t usMessageID_ = 43)
+{
+    JsonReader clJsonDb;
+    clJsonDb.ParseJson(szHeaderJsonDb);
+    HeaderDecoder clDecoder(&clJsonDb);
+    std::string strHeader(szHeader_);
+    IntermediateHeader stHeader;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        MetaDataStruct stMetaData;
+        if (clDecoder.Decode(reinterpret_cast<unsigned char*>(strHeader.data()), stHeader, stMetaData) != STATUS::SUCCESS || stHeader.usMessageID != usMessageID_)
+        {
+            state.SkipWithError("Failed to decode the header");
+            return;
+        }
+        edie::benchmark::DoNotOptimize(stHeader);
+    }
+
+    state.SetBytesProcessed(state.iterations() * strHeader.size());
+    state.SetItemsProcessed(state.iterations());
+}
+
+// -------------------------------------------------------------------------------------------------------
+void BM_DecodeHeaderAscii(State& state) { DecodeHeader(state, "#RANGEA,COM1,0,72.5,FINESTEERING,2167,244820.000,02000020,5103,16248;"); }
+void BM_DecodeHeaderAsciiLongNames(State& state)
+{
+    // Names too long for the small string optimization
+    DecodeHeader(state, "#TERRASTARSTATUSA_1,USB1,0,72.5,FINEBACKUPSTEERING,2167,244820.000,02000020,5103,16248;", 1719);
+}
+void BM_DecodeHeaderAbbrevAscii(State& state) { DecodeHeader(state, "<RANGE ICOM1 0 72.5 FINESTEERING 2167 244820.000 02000020 5103 16248\r\n"); }
+void BM_DecodeHeaderShortAscii(State& state) { DecodeHeader(state, "%RANGEA,2167,244820.000;"); }
+
+} // namespace
+
+BENCHMARK(BM_DecodeHeaderAscii);
+BENCHMARK(BM_DecodeHeaderAsciiLongNames);
+BENCHMARK(BM_DecodeHeaderAbbrevAscii);
+BENCHMARK(BM_DecodeHeaderShortAscii);
@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file jsonreader_benchmarks.cpp
+//! \brief Benchmarks of JsonReader loading message databases.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "benchmarks/benchmark.hpp"
+#include "decoders/common/api/jsonreader.hpp"
+
+using edie::benchmark::State;
+
+namespace {
+
+constexpr uint32_t uiGeneratedMessages = 500;
+constexpr uint32_t uiGeneratedEnums = 50;
+constexpr uint32_t uiGeneratedEnumerators = 32;
+constexpr uint32_t uiLazyMessagesUsed = 30;
+
+// The fields of every generated message: an enum, a string and an array of observations, like most logs in the UI DB
+constexpr const char* szGeneratedFields = R"([
+    { "name": "sol_status", "description": null, "type": "ENUM", "conversionString": "%s", "enumID": "Enum0",
+      "dataType": { "name": "UINT", "length": 4, "description": null } },
+    { "name": "id", "description": null, "type": "STRING", "conversionString": "%s", "arrayLength": 16,
+      "dataType": { "name": "CHAR", "length": 1, "description": null } },
+    { "name": "obs", "description": null, "type": "FIELD_ARRAY", "conversionString": null, "arrayLength": 325,
+      "dataType": { "name": "UNKNOWN", "length": 24, "description": null },
+      "fields": [
+          { "name": "sv_prn", "description": null, "type": "SIMPLE", "conversionString": "%hu",
+            "dataType": { "name": "USHORT", "length": 2, "description": null } },
+          { "name": "glo_freq", "description": null, "type": "SIMPLE", "conversionString": "%hu",
+            "dataType": { "name": "USHORT", "length": 2, "description": null } },
+          { "name": "psr", "description": null, "type": "SIMPLE", "conversionString": "%.3lf",
+            "dataType": { "name": "DOUBLE", "length": 8, "description": null } },
+          { "name": "psr_std", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+            "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+          { "name": "ch_tr_status", "description": null, "type": "SIMPLE", "conversionString": "%lx",
+            "dataType": { "name": "ULONG", "length": 4, "description": null } }
+      ]
+    }
+])";
+
+// -------------------------------------------------------------------------------------------------------
+std::string MakeDatabase()
+{
+    std::string strDatabase = R"({ "enums": [)";
+    for (uint32_t i = 0; i < uiGeneratedEnums; ++i)
+    {
+        if (i != 0) { strDatabase += ','; }
+        strDatabase.append(R"({ "_id": "Enum)").append(std::to_string(i)).append(R"(", "name": "Enum)").append(std::to_string(i));
+        strDatabase.append(R"(", "enumerators": [)");
+        for (uint32_t j = 0; j < uiGeneratedEnumerators; ++j)
+        {
+            if (j != 0) { strDatabase += ','; }
+            strDatabase.append(R"({ "value": )").append(std::to_string(j)).append(R"(, "name": "ENUMERATOR_)").append(std::to_string(j));
+            strDatabase.append(R"(", "description": "Enumerator )").append(std::to_string(j)).append(R"(" })");
+        }
+        strDatabase.append("]}");
+    }
+
+    strDatabase.append(R"(], "messages": [)");
+    for (uint32_t i = 0; i < uiGeneratedMessages; ++i)
+    {
+        const std::string strId = std::to_string(1000 + i);
+        if (i != 0) { strDatabase += ','; }
+        strDatabase.append(R"({ "_id": ")").append(strId).append(R"(", "messageID": )").append(strId).append(R"(, "name": "MESSAGE)").append(strId);
+        strDatabase.append(R"(", "description": null, "latestMsgDefCrc": "0", "fields": { "0": )").append(szGeneratedFields).append("}}");
+    }
+    return strDatabase.append("]}");
+}
+
+// -------------------------------------------------------------------------------------------------------
+void LoadDatabase(State& state, const std::filesystem::path& clPath_)
+{
+    std::error_code ec;
+    const uintmax_t ullSize = std::filesystem::file_size(clPath_, ec);
+    if (ec)
+    {
+        state.SkipWithError("Couldn't find " + clPath_.string());
+        return;
+    }
+
+    const std::string strPath = clPath_.string();
+    size_t ullMessages = 0;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        JsonReader clJsonDb;
+        clJsonDb.LoadFile(strPath);
+        ullMessages = clJsonDb.GetMessageDefinitions().size();
+        edie::benchmark::DoNotOptimize(clJsonDb);
+    }
+
+    state.SetBytesProcessed(state.iterations() * ullSize);
+    state.SetItemsProcessed(state.iterations() * ullMessages);
+}
+
+// -------------------------------------------------------------------------------------------------------
+void LoadCachedDatabase(State& state, const std::filesystem::path& clPath_)
+{
+    std::error_code ec;
+    const uintmax_t ullSize = std::filesystem::file_size(clPath_, ec);
+    if (ec)
+    {
+        state.SkipWithError("Couldn't find " + clPath_.string());
+        return;
+    }
+
+    const std::filesystem::path clCachePath = std::filesystem::temp_directory_path() / (clPath_.filename().string() + ".cache");
+    {
+        JsonReader clJsonDb;
+        clJsonDb.LoadFile(clPath_.string());
+        clJsonDb.SaveCache(clCachePath, clPath_);
+    }
+
+    size_t ullMessages = 0;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        JsonReader clJsonDb;
+        if (!clJsonDb.LoadCache(clCachePath, clPath_))
+        {
+            state.SkipWithError("Couldn't load the database cache");
+            break;
+        }
+        ullMessages = clJsonDb.GetMessageDefinitions().size();
+        edie::benchmark::DoNotOptimize(clJsonDb);
+    }
+
+    std::filesystem::remove(clCachePath);
+    state.SetBytesProcessed(state.iterations() * ullSize);
+    state.SetItemsProcessed(state.iterations() * ullMessages);
+}
+
+// -------------------------------------------------------------------------------------------------------
+void LoadLazyDatabase(State& state, const std::filesystem::path& clPath_)
+{
+    std::error_code ec;
+    const uintmax_t ullSize = std::filesystem::file_size(clPath_, ec);
+    if (ec)
+    {
+        state.SkipWithError("Couldn't find " + clPath_.string());
+        return;
+    }
+
+    // Look up a few dozen of the messages, as a typical log would
+    std::vector<int32_t> vUsedIDs;
+    {
+        JsonReader clJsonDb;
+        clJsonDb.LoadFile(clPath_.string());
+        const auto& vMsgDefs = clJsonDb.GetMessageDefinitions();
+        for (size_t i = 0; i < vMsgDefs.size() && vUsedIDs.size() < uiLazyMessagesUsed; i += vMsgDefs.size() / uiLazyMessagesUsed + 1)
+        {
+            vUsedIDs.push_back(static_cast<int32_t>(vMsgDefs[i].logID));
+        }
+    }
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        JsonReader clJsonDb;
+        clJsonDb.LoadFileLazy(clPath_);
+        for (const int32_t iMsgID : vUsedIDs) { edie::benchmark::DoNotOptimize(clJsonDb.GetMsgDef(iMsgID)); }
+        edie::benchmark::DoNotOptimize(clJsonDb);
+    }
+
+    state.SetBytesProcessed(state.iterations() * ullSize);
+    state.SetItemsProcessed(state.iterations() * vUsedIDs.size());
+}
+
+// -------------------------------------------------------------------------------------------------------
+void BM_LoadGeneratedDatabase(State& state)
+{
+    const std::filesystem::path clPath = edie::benchmark::WriteTemporaryFile("edie_benchmark_database.json", MakeDatabase());
+    if (clPath.empty())
+    {
+        state.SkipWithError("Couldn't write the generated database");
+        return;
+    }
+    LoadDatabase(state, clPath);
+}
+
+void BM_LoadGeneratedDatabaseCached(State& state)
+{
+    const std::filesystem::path clPath = edie::benchmark::WriteTemporaryFile("edie_benchmark_database.json", MakeDatabase());
+    if (clPath.empty())
+    {
+        state.SkipWithError("Couldn't write the generated database");
+        return;
+    }
+    LoadCachedDatabase(state, clPath);
+}
+
+void BM_LoadGeneratedDatabaseLazy(State& state)
+{
+    const std::filesystem::path clPath = edie::benchmark::WriteTemporaryFile("edie_benchmark_database.json", MakeDatabase());
+    if (clPath.empty())
+    {
+        state.SkipWithError("Couldn't write the generated database");
+        return;
+    }
+    LoadLazyDatabase(state, clPath);
+}
+
+void BM_LoadPublicDatabase(State& state)
+{
+    LoadDatabase(state, std::filesystem::path(edie::benchmark::ProjectRoot()) / "database" / "messages_public.json");
+}
+
+void BM_LoadPublicDatabaseCached(State& state)
+{
+    LoadCachedDatabase(state, std::filesystem::path(edie::benchmark::ProjectRoot()) / "database" / "messages_public.json");
+}
+
+void BM_LoadPublicDatabaseLazy(State& state)
+{
+    LoadLazyDatabase(state, std::filesystem::path(edie::benchmark::ProjectRoot()) / "database" / "messages_public.json");
+}
+
+} // namespace
+
+BENCHMARK(BM_LoadGeneratedDatabase);
+BENCHMARK(BM_LoadGeneratedDatabaseCached);
+BENCHMARK(BM_LoadGeneratedDatabaseLazy);
+BENCHMARK(BM_LoadPublicDatabase);
+BENCHMARK(BM_LoadPublicDatabaseCached);
+BENCHMARK(BM_LoadPublicDatabaseLazy);
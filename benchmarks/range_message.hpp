@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file range_message.hpp
+//! \brief A RANGE message definition and body shared by the benchmarks.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef EDIE_BENCHMARK_RANGE_MESSAGE_HPP
+#define EDIE_BENCHMARK_RANGE_MESSAGE_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "decoders/common/api/jsonreader.hpp"
+#include "decoders/novatel/api/common.hpp"
+#include "decoders/novatel/api/encoder.hpp"
+#include "decoders/novatel/api/message_decoder.hpp"
+
+namespace edie::benchmark {
+
+// RANGE as defined in the UI DB, so that the benchmarks don't depend on a database file. RANGECMP and RANGECMP4
+// only need a name, as RangeDecompressor reads their binary bodies directly.
+inline constexpr const char* szRangeJsonDb = R"({
+    "enums": [],
+    "logs": [{
+        "_id": "140", "messageID": 140, "name": "RANGECMP", "description": null, "latestMsgDefCrc": "0", "fields": { "0": [] }
+    }, {
+        "_id": "2050", "messageID": 2050, "name": "RANGECMP4", "description": null, "latestMsgDefCrc": "0", "fields": { "0": [] }
+    }, {
+        "_id": "43", "messageID": 43, "name": "RANGE", "description": null, "latestMsgDefCrc": "0",
+        "fields": { "0": [{
+            "name": "obs", "description": null, "type": "FIELD_ARRAY", "conversionString": null, "arrayLength": 325,
+            "dataType": { "name": "UNKNOWN", "length": 44, "description": null },
+            "fields": [
+                { "name": "sv_prn", "description": null, "type": "SIMPLE", "conversionString": "%hu",
+                  "dataType": { "name": "USHORT", "length": 2, "description": null } },
+                { "name": "glo_freq", "description": null, "type": "SIMPLE", "conversionString": "%hu",
+                  "dataType": { "name": "USHORT", "length": 2, "description": null } },
+                { "name": "psr", "description": null, "type": "SIMPLE", "conversionString": "%.3lf",
+                  "dataType": { "name": "DOUBLE", "length": 8, "description": null } },
+                { "name": "psr_std", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+                  "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+                { "name": "adr", "description": null, "type": "SIMPLE", "conversionString": "%.3lf",
+                  "dataType": { "name": "DOUBLE", "length": 8, "description": null } },
+                { "name": "adr_std", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+                  "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+                { "name": "dopp", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+                  "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+                { "name": "cno", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+                  "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+                { "name": "locktime", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+                  "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+                { "name": "ch_tr_status", "description": null, "type": "SIMPLE", "conversionString": "%lx",
+                  "dataType": { "name": "ULONG", "length": 4, "description": null } }
+            ]
+        }]}
+    }]
+})";
+
+inline constexpr uint32_t uiRangeObservations = 24;
+inline constexpr uint32_t uiRangeObservationSize = 44;
+
+//----------------------------------------------------------------------------
+// A RANGE body in one format with what MessageDecoder needs to decode it.
+//----------------------------------------------------------------------------
+struct RangeInput
+{
+    JsonReader clJsonDb;
+    std::vector<unsigned char> vBody;
+    novatel::edie::oem::MetaDataStruct stMetaData;
+
+    explicit RangeInput(novatel::edie::HEADERFORMAT eFormat_) : stMetaData(eFormat_)
+    {
+        clJsonDb.ParseJson(szRangeJsonDb);
+        stMetaData.usMessageID = 43;
+        stMetaData.uiMessageCRC = 0;
+
+        if (eFormat_ == novatel::edie::HEADERFORMAT::BINARY)
+        {
+            vBody.resize(sizeof(uint32_t) + uiRangeObservations * uiRangeObservationSize);
+            memcpy(vBody.data(), &uiRangeObservations, sizeof(uint32_t));
+            for (uint32_t i = 0; i < uiRangeObservations; ++i)
+            {
+                unsigned char* pucObs = vBody.data() + sizeof(uint32_t) + i * uiRangeObservationSize;
+                const uint16_t ausId[2] = {static_cast<uint16_t>(i + 1), 0};
+                const double dPsr = 20977560.237 + i * 1000.0;
+                const double dAdr = -110237398.651 - i * 1000.0;
+                const float afStats[5] = {0.044F, 0.004F, -3042.213F, 49.5F, 5765.438F};
+                const uint32_t uiStatus = 0x08109c04 + i;
+                memcpy(pucObs, ausId, sizeof(ausId));
+                memcpy(pucObs + 4, &dPsr, sizeof(dPsr));
+                memcpy(pucObs + 12, &afStats[0], sizeof(float));
+                memcpy(pucObs + 16, &dAdr, sizeof(dAdr));
+                memcpy(pucObs + 24, &afStats[1], 4 * sizeof(float));
+                memcpy(pucObs + 40, &uiStatus, sizeof(uiStatus));
+            }
+            stMetaData.uiBinaryMsgLength = static_cast<uint32_t>(vBody.size());
+        }
+        else
+        {
+            std::string strBody = std::to_string(uiRangeObservations);
+            for (uint32_t i = 0; i < uiRangeObservations; ++i)
+            {
+                char acObs[128];
+                snprintf(acObs, sizeof(acObs), ",%u,0,%.3f,0.044,%.3f,0.004,-3042.213,49.500,5765.438,%08x", i + 1, 20977560.237 + i * 1000.0,
+                         -110237398.651 - i * 1000.0, 0x08109c04 + i);
+                strBody += acObs;
+            }
+            strBody += "*c6bf7ed7\r\n";
+            vBody.assign(strBody.begin(), strBody.end());
+            vBody.push_back('\0');
+        }
+    }
+};
+
+//----------------------------------------------------------------------------
+// The header of the RANGE log that the RANGE bodies are taken from.
+//----------------------------------------------------------------------------
+inline novatel::edie::oem::IntermediateHeader RangeHeader()
+{
+    novatel::edie::oem::IntermediateHeader stHeader;
+    stHeader.usMessageID = 43;
+    stHeader.uiPortAddress = 32;
+    stHeader.uiTimeStatus = 180;
+    stHeader.usWeek = 2167;
+    stHeader.dMilliseconds = 244820000.0;
+    stHeader.uiReceiverStatus = 0x02000020;
+    stHeader.usReceiverSwVersion = 16248;
+    return stHeader;
+}
+
+//----------------------------------------------------------------------------
+// A complete RANGE log, header and CRC included, as a receiver would send it.
+//----------------------------------------------------------------------------
+inline std::vector<unsigned char> EncodeRangeLog(novatel::edie::ENCODEFORMAT eFormat_)
+{
+    RangeInput stInput(novatel::edie::HEADERFORMAT::BINARY);
+    novatel::edie::oem::MessageDecoder clDecoder(&stInput.clJsonDb);
+    novatel::edie::oem::Encoder clEncoder(&stInput.clJsonDb);
+    novatel::edie::IntermediateMessage stMessage;
+    if (clDecoder.Decode(stInput.vBody.data(), stMessage, stInput.stMetaData) != novatel::edie::STATUS::SUCCESS) { return {}; }
+
+    novatel::edie::oem::IntermediateHeader stHeader = RangeHeader();
+    std::vector<unsigned char> vLog(64 * 1024);
+    unsigned char* pucLog = vLog.data();
+    novatel::edie::MessageDataStruct stMessageData;
+    if (clEncoder.Encode(&pucLog, static_cast<uint32_t>(vLog.size()), stHeader, stMessage, stMessageData, stInput.stMetaData, eFormat_) !=
+        novatel::edie::STATUS::SUCCESS)
+    {
+        return {};
+    }
+
+    vLog.assign(stMessageData.pucMessage, stMessageData.pucMessage + stMessageData.uiMessageLength);
+    return vLog;
+}
+
+} // namespace edie::benchmark
+
+#endif // EDIE_BENCHMARK_RANGE_MESSAGE_HPP
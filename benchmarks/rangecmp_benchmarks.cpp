@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file rangecmp_benchmarks.cpp
+//! \brief Benchmarks of RangeDecompressor on OEM4 binary RANGECMP logs.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "benchmarks/benchmark.hpp"
+#include "benchmarks/range_message.hpp"
+#include "decoders/common/api/crc32.hpp"
+#include "decoders/novatel/api/rangecmp/range_decompressor.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+using edie::benchmark::State;
+
+namespace {
+
+// Compressed observations taken from a receiver's RANGECMPA log
+constexpr const char* aszRangeCmpRecords[] = {
+    "04dc10084831f31f25ab020b129a79c45207c2966a030000",
+    "0b5c30012705f6df3dab020b8cd140dd50070d962a030000",
+    "0bdc30022705f6ef32ab020b4ade40dd520767966a030000",
+    "24dc100868910e901ca70a0b17583abf5213c27261030000",
+    "2b5c3001095a0bf023a70a0b74ed29d94013187201030000",
+    "44dc1018fbbeff3fc6c7d50a1fedf5e1520f81fca2030000",
+    "4b5c301156cdff7fd0c7d50a019a3af4500fd1fb02030000",
+    "4bdc300256cdff7fd0c7d50ac29f3af4520f27fc42030000",
+    "64dc10088e7cff5fbaeca5095a288ea9310e02dee5030000",
+    "6b5c30019399ff4fc8eca5098caec18f300e48dde5030000",
+    "6bdc30029399ff3fbfeca5094cadc18f300eaddde5030000",
+    "64dcd001b59dff3fe4eca50998d06ec4100ecfdde5030000",
+    "84dc10089881f15f268df30bde143ea66308bff8e7020000",
+    "8b5c3001c8b4f4af538df30b5767f4e18008f8f7e7020000",
+    "8bdc3002c8b4f47f4a8df30b175bf4e1820851f887030000",
+    "84dcd0011d2df5ff4a8df30b64d534a3100886f8e7030000",
+    "a4dc101808a5f6ff13393d0a51132cc6201e0286e8030000",
+    "ab5c3011cab5f80f30393d0ab9cd50c2201e5885c8030000",
+    "abdc3002cab5f89f27393d0a77ce50c2201e9785e8030000",
+    "a4dcd0018503f99f2b393d0aa81638fa101ec885e8030000",
+    "e4dc10080190fb9ff79c450a0a32a9c0310d42d1e4030000",
+    "eb5c3001cf8afc9fff9c450a007b05be300d98d024030000",
+    "04dd1008b4defc0f14022c0b817551a94215c96743030000",
+    "0b5d30019c8ffd2f1f022c0ba86517c850150d67e3020000",
+};
+
+// The compressed data of a receiver's RANGECMP4A log with 63 observations
+constexpr const char* szRangeCmp4Data =
+    "e3002d812042000000001200ffffc3987b2310571bd85514de1f675e63c6fdd08d0f2c31f2130098873fc368808c99b23cfcd48d1d9cc28fa1ef00c5"
+    "46ff0000a5ef8bb42dd8b813cdd07f43c7f8b4f7427712f0f5ee1f0020cdbd55a2df32c32a0efb5b118d5fe57e8a3404084cfe010074b937ea962d25"
+    "59263c0064c0d01bdc0fb59780e4e61f008063f7352b932bf14a0a11c06242f94e7ba2bd0ce85806dcfff0e6de8646c87d59013ffba1249d386d4f74"
+    "9d0198c8fd04009edf93c42aab2c28539f80837cf4afef45865460cb2bf0ffc3eefb9a749ffb2225fef0fff6a862f0bdcc9802881dfa0f00f0416000"
+    "000000000980fe6e187bebcf0841d5bdd4f2f1ff118d0c60fdef4566eb800112d7d31f1b6f8290f7205113103af31700a07dbe1fb1f65a734cd2827f"
+    "62aed91fdc8318198043c15f0080b2065f02089f54229d2604aa9addbf7f0fa2a801de8f810100405dfba2c2c902f5240e17a8a4871cccb97b12bf37"
+    "42104545fc8f6916e3d53d8cdb0b7063fd0f00508ded8b90ce40981589c33f5e220b4869ee491c1b4b3a9548f27f13a58014f730621f90e8f21f0010"
+    "1c2848000000001400feff21c9bd51a291a81f4b73011491de9efe3e446f0238e2fde33e24bb2f5a8d415662a277ff6d9815a2df473c53402ebb7ffc"
+    "87f6f6669cb3245b6cf6efcf491540a27b295efd9f37fa6b00d0d6de28a9c67a8ec5e9fa1f6291487a2f11dc00d6e57d8b1fb2ded700458d80adadc2"
+    "ff9567fce5ef23080e806ce94ffc43d4fb9a66ec37fff57412808188bd0e7ec4cf07ac5e076e0088814f42cbc30cba00e700da6ffb07c38748c5806c"
+    "6c400d0059ee8d8459d4075ac4af3fc1938878f7222327e0d3df4ffe01105800304000001410d6b62d1cb3a74a353ae961a9877f0ccc1466de9310e3"
+    "7f37d6ffc08762f820e4b4862e8ac6ed5f8f96401f7c881a005030f93ffe30f83ee4b985656131a6fa71b3a2d87d0f91a5ffd2af7d0b0042e08740d1"
+    "1b57ac8a983f3490ed9fef410ee2bf83d24ff8c3e5fb103c9b60b545f00c188619bdea3d883213586605220008752fc324b1ffb434b2fe46294784bd"
+    "07c1d481bf6affc30fb5f0412c681f7494721160c5ecfc47f81050ce8fdc07d0fb090000000000000014008626f736daf8d7471410e4cf154f40a67b"
+    "9be708e056f60300";
+
+// -------------------------------------------------------------------------------------------------------
+std::vector<unsigned char> MakeLog(uint16_t usMessageID_, const std::vector<unsigned char>& vBody_)
+{
+    IntermediateHeader stHeader = edie::benchmark::RangeHeader();
+    stHeader.usMessageID = usMessageID_;
+    stHeader.usLength = static_cast<uint16_t>(vBody_.size());
+    const OEM4BinaryHeader stBinaryHeader(stHeader);
+
+    std::vector<unsigned char> vLog(sizeof(stBinaryHeader) + vBody_.size() + OEM4_BINARY_CRC_LENGTH);
+    memcpy(vLog.data(), &stBinaryHeader, sizeof(stBinaryHeader));
+    memcpy(vLog.data() + sizeof(stBinaryHeader), vBody_.data(), vBody_.size());
+    const uint32_t uiCrc = CalculateBlockCRC32(static_cast<uint32_t>(vLog.size() - OEM4_BINARY_CRC_LENGTH), 0, vLog.data());
+    memcpy(vLog.data() + vLog.size() - OEM4_BINARY_CRC_LENGTH, &uiCrc, sizeof(uiCrc));
+    return vLog;
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::vector<unsigned char> MakeRangeCmpLog()
+{
+    std::vector<unsigned char> vBody(sizeof(uint32_t));
+    const uint32_t uiRecords = sizeof(aszRangeCmpRecords) / sizeof(aszRangeCmpRecords[0]);
+    memcpy(vBody.data(), &uiRecords, sizeof(uiRecords));
+    for (const char* szRecord : aszRangeCmpRecords)
+    {
+        for (size_t i = 0; i < sizeof(RangeCmpDataStruct); ++i)
+        {
+            vBody.push_back(static_cast<unsigned char>(std::stoul(std::string(szRecord + 2 * i, 2), nullptr, 16)));
+        }
+    }
+
+    return MakeLog(RANGECMP_MSG_ID, vBody);
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::vector<unsigned char> MakeRangeCmp4Log()
+{
+    const std::string strData(szRangeCmp4Data);
+    const auto uiDataLength = static_cast<uint32_t>(strData.size() / 2);
+    std::vector<unsigned char> vBody(sizeof(uiDataLength));
+    memcpy(vBody.data(), &uiDataLength, sizeof(uiDataLength));
+    for (size_t i = 0; i < strData.size(); i += 2) { vBody.push_back(static_cast<unsigned char>(std::stoul(strData.substr(i, 2), nullptr, 16))); }
+    return MakeLog(RANGECMP4_MSG_ID, vBody);
+}
+
+// -------------------------------------------------------------------------------------------------------
+void DecompressRangeCmp(State& state, const std::vector<unsigned char>& vLog_, ENCODEFORMAT eFormat_)
+{
+    JsonReader clJsonDb;
+    clJsonDb.ParseJson(edie::benchmark::szRangeJsonDb);
+    RangeDecompressor clDecompressor(&clJsonDb);
+    std::vector<unsigned char> vBuffer(64 * 1024);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        // The log is decompressed in place, so every iteration starts from a fresh copy
+        memcpy(vBuffer.data(), vLog_.data(), vLog_.size());
+        MetaDataStruct stMetaData;
+        if (clDecompressor.Decompress(vBuffer.data(), static_cast<uint32_t>(vBuffer.size()), stMetaData, eFormat_) != STATUS::SUCCESS)
+        {
+            state.SkipWithError("Failed to decompress the log");
+            return;
+        }
+        edie::benchmark::DoNotOptimize(vBuffer);
+    }
+
+    state.SetBytesProcessed(state.iterations() * vLog_.size());
+    state.SetItemsProcessed(state.iterations());
+}
+
+// -------------------------------------------------------------------------------------------------------
+void DecompressRangeCmpObservations(State& state, const std::vector<unsigned char>& vLog_)
+{
+    JsonReader clJsonDb;
+    clJsonDb.ParseJson(edie::benchmark::szRangeJsonDb);
+    RangeDecompressor clDecompressor(&clJsonDb);
+    std::vector<unsigned char> vBuffer(64 * 1024);
+    RangeObservations stObservations;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        memcpy(vBuffer.data(), vLog_.data(), vLog_.size());
+        MetaDataStruct stMetaData;
+        const STATUS eStatus = clDecompressor.DecompressObservations(vBuffer.data(), static_cast<uint32_t>(vBuffer.size()), stMetaData, stObservations);
+        if (eStatus != STATUS::SUCCESS)
+        {
+            state.SkipWithError("Failed to decompress the log");
+            return;
+        }
+        edie::benchmark::DoNotOptimize(stObservations);
+    }
+
+    state.SetBytesProcessed(state.iterations() * vLog_.size());
+    state.SetItemsProcessed(state.iterations());
+}
+
+// -------------------------------------------------------------------------------------------------------
+void BM_DecompressRangeCmpToBinary(State& state) { DecompressRangeCmp(state, MakeRangeCmpLog(), ENCODEFORMAT::BINARY); }
+void BM_DecompressRangeCmpToAscii(State& state) { DecompressRangeCmp(state, MakeRangeCmpLog(), ENCODEFORMAT::ASCII); }
+void BM_DecompressRangeCmp4ToBinary(State& state) { DecompressRangeCmp(state, MakeRangeCmp4Log(), ENCODEFORMAT::BINARY); }
+void BM_DecompressRangeCmp4ToAscii(State& state) { DecompressRangeCmp(state, MakeRangeCmp4Log(), ENCODEFORMAT::ASCII); }
+void BM_DecompressRangeCmpToObservations(State& state) { DecompressRangeCmpObservations(state, MakeRangeCmpLog()); }
+void BM_DecompressRangeCmp4ToObservations(State& state) { DecompressRangeCmpObservations(state, MakeRangeCmp4Log()); }
+
+} // namespace
+
+BENCHMARK(BM_DecompressRangeCmpToBinary);
+BENCHMARK(BM_DecompressRangeCmpToAscii);
+BENCHMARK(BM_DecompressRangeCmp4ToBinary);
+BENCHMARK(BM_DecompressRangeCmp4ToAscii);
+BENCHMARK(BM_DecompressRangeCmpToObservations);
+BENCHMARK(BM_DecompressRangeCmp4ToObservations);
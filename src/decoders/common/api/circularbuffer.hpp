@@ -37,6 +37,7 @@
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
+#include <array>
 #include <cstdint>
 
 //============================================================================
@@ -50,6 +51,24 @@ class CircularBuffer
     uint32_t uiMyLength{0};              //!< Amount of data currently in buffer (bytes)
     unsigned char* pucMyHead{nullptr};   //!< Logical beginning of buffer
     unsigned char* pucMyTail{nullptr};   //!< Logical tail of buffer (could be computed, but maintained as a convenience)
+    bool bMyUseMirroring{false};         //!< Allocate double-mapped memory when the buffer grows
+    bool bMyMirrored{false};             //!< The current allocation is mapped twice, back to back
+
+    //----------------------------------------------------------------------------
+    //! \brief Number of bytes from pucStart_ that can be accessed without
+    //! wrapping, limited to uiBytes_.
+    //----------------------------------------------------------------------------
+    inline uint32_t ContiguousBytes(const unsigned char* pucStart_, uint32_t uiBytes_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Move the buffered data into a new allocation of uiCapacity_ bytes.
+    //----------------------------------------------------------------------------
+    void Reallocate(uint32_t uiCapacity_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Release the current allocation.
+    //----------------------------------------------------------------------------
+    void Release();
 
   public:
     //----------------------------------------------------------------------------
@@ -60,9 +79,41 @@ class CircularBuffer
     CircularBuffer() = default;
 
     //----------------------------------------------------------------------------
-    //! \brief Default circular buffer class Destructor.
+    //! \brief Circular buffer class Destructor. Releases the buffer memory.
     //----------------------------------------------------------------------------
-    ~CircularBuffer() = default;
+    ~CircularBuffer();
+
+    CircularBuffer(const CircularBuffer&) = delete;
+    CircularBuffer& operator=(const CircularBuffer&) = delete;
+
+    //----------------------------------------------------------------------------
+    //! \brief Back the buffer with memory that is mapped twice, back to back (a
+    //! "magic ring"), so that any window of up to capacity bytes is contiguous.
+    //
+    //! \param[in] bMirrored_ true to use double-mapped memory.
+    //
+    //! \return true if the buffer is now double mapped.
+    //! \remark Only supported on Linux. Capacity is rounded up to a whole number
+    //! of pages while mirrored. Existing data is preserved.
+    //----------------------------------------------------------------------------
+    bool SetMirrored(bool bMirrored_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Returns true if the buffer is currently double mapped.
+    //----------------------------------------------------------------------------
+    inline bool IsMirrored() const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Get a pointer to a range of the buffer without copying it.
+    //
+    //! \param[in] uiOffset_ Offset (in bytes) from the beginning of the buffer.
+    //! \param[in] uiBytes_ Size of the range (in bytes).
+    //
+    //! \return A pointer to the range, or nullptr if the range is not in the
+    //! buffer or wraps around (which never happens while mirrored).
+    //! \remark The pointer is valid until data is next appended or discarded.
+    //----------------------------------------------------------------------------
+    const unsigned char* GetContiguous(uint32_t uiOffset_, uint32_t uiBytes_) const;
 
     //----------------------------------------------------------------------------
     //! \brief Sets the size of the circular buffer (bytes)
@@ -126,6 +177,32 @@ class CircularBuffer
     //----------------------------------------------------------------------------
     uint32_t Copy(unsigned char* pucTarget_, uint32_t uiBytes_) const;
 
+    //----------------------------------------------------------------------------
+    //! \brief Continue a CRC-32 over a range of the buffer without copying it out.
+    //
+    //! \param[in] uiOffset_ Offset (in bytes) from the beginning of the buffer.
+    //! \param[in] uiBytes_ Amount of data (in bytes) to include in the CRC.
+    //! \param[in] uiCRC_ CRC-32 of the data preceding the range.
+    //
+    //! \return The CRC-32 updated with the requested range.
+    //! \remark The range is clamped to the data currently in the buffer.
+    //----------------------------------------------------------------------------
+    uint32_t CalculateCRC32(uint32_t uiOffset_, uint32_t uiBytes_, uint32_t uiCRC_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Find the first byte in a range of the buffer that is flagged in a
+    //! lookup table.
+    //
+    //! \param[in] uiOffset_ Offset (in bytes) from the beginning of the buffer to
+    //! start searching from.
+    //! \param[in] uiEnd_ Offset (in bytes) to stop searching at, exclusive.
+    //! \param[in] abMatch_ Table indexed by byte value, true for bytes to find.
+    //
+    //! \return The offset of the first matching byte, or uiEnd_ if none match.
+    //! \remark uiEnd_ is clamped to the data currently in the buffer.
+    //----------------------------------------------------------------------------
+    uint32_t FindFirstOf(uint32_t uiOffset_, uint32_t uiEnd_, const std::array<bool, 256>& abMatch_) const;
+
     //----------------------------------------------------------------------------
     //! \brief Overloading Subscript or array index operator []
     //----------------------------------------------------------------------------
@@ -156,6 +233,22 @@ inline uint32_t CircularBuffer::GetCapacity() const { return uiMyCapacity; }
 //----------------------------------------------------------------------------
 inline uint32_t CircularBuffer::GetLength() const { return uiMyLength; }
 
+//----------------------------------------------------------------------------
+//! \brief Returns true if the buffer is currently double mapped.
+//----------------------------------------------------------------------------
+inline bool CircularBuffer::IsMirrored() const { return bMyMirrored; }
+
+//----------------------------------------------------------------------------
+//! \brief Number of bytes from pucStart_ that can be accessed without wrapping.
+//----------------------------------------------------------------------------
+inline uint32_t CircularBuffer::ContiguousBytes(const unsigned char* pucStart_, uint32_t uiBytes_) const
+{
+    if (bMyMirrored) return uiBytes_;
+
+    const auto uiToEnd = static_cast<uint32_t>(pucMyBuffer + uiMyCapacity - pucStart_);
+    return uiToEnd < uiBytes_ ? uiToEnd : uiBytes_;
+}
+
 //----------------------------------------------------------------------------
 //! \brief Delete contents of buffer, internally called Discard method.
 //----------------------------------------------------------------------------
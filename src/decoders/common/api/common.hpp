@@ -37,9 +37,13 @@
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
+#include <charconv>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace novatel::edie {
 
@@ -355,9 +359,9 @@ unsigned char PackMsgType(uint32_t uiSiblingID_, uint32_t uiMsgFormat_, uint32_t
 //! \param[in] stEnumDef_ A pointer to the enum definition.
 //! \param[in] uiEnum_ The enum value.
 //
-//! \return The enum in string form.
+//! \return The enum in string form, or "UNKNOWN" if it is not defined.
 //-----------------------------------------------------------------------
-std::string GetEnumString(const novatel::edie::EnumDefinition* stEnumDef_, uint32_t uiEnum_);
+const std::string& GetEnumString(const novatel::edie::EnumDefinition* stEnumDef_, uint32_t uiEnum_);
 
 //-----------------------------------------------------------------------
 //! \brief Get the value of an enum string in integer form.
@@ -367,7 +371,7 @@ std::string GetEnumString(const novatel::edie::EnumDefinition* stEnumDef_, uint3
 //
 //! \return The enum in integer form.
 //-----------------------------------------------------------------------
-int32_t GetEnumValue(const novatel::edie::EnumDefinition* stEnumDef_, std::string strEnum_);
+int32_t GetEnumValue(const novatel::edie::EnumDefinition* stEnumDef_, std::string_view strEnum_);
 
 //-----------------------------------------------------------------------
 //! \brief Get the value of an response string in integer form.
@@ -377,7 +381,7 @@ int32_t GetEnumValue(const novatel::edie::EnumDefinition* stEnumDef_, std::strin
 //
 //! \return The response in integer form.
 //-----------------------------------------------------------------------
-int32_t GetResponseId(const novatel::edie::EnumDefinition* stRespDef_, std::string strResp_);
+int32_t GetResponseId(const novatel::edie::EnumDefinition* stRespDef_, std::string_view strResp_);
 
 //-----------------------------------------------------------------------
 //! \brief Get the char as an integer.
@@ -388,6 +392,141 @@ int32_t GetResponseId(const novatel::edie::EnumDefinition* stRespDef_, std::stri
 //-----------------------------------------------------------------------
 int32_t ToDigit(char c);
 
+//-----------------------------------------------------------------------
+//! \brief Parse a number from an ASCII token.
+//
+//! The token is parsed with std::from_chars when it is entirely a number
+//! in a form from_chars accepts, after skipping a leading '+' and, for
+//! base 16, a "0x" prefix. Any other token is passed to the strto*
+//! function for T, so the accepted syntax and the results (including
+//! overflow and wrap-around) match calling strto* directly.
+//
+//! \param[in] pcToken_ The start of the token. The buffer must be null
+//! terminated at or after the end of the token.
+//! \param[in] ullTokenLength_ The length of the token.
+//
+//! \return The number, converted to T.
+//-----------------------------------------------------------------------
+template <typename T, int R = 10> T ParseAsciiNumber(const char* pcToken_, size_t ullTokenLength_)
+{
+    static_assert(std::is_arithmetic_v<T>, "ParseAsciiNumber(): unsupported type");
+
+    // The type the equivalent strto* function returns
+    using L = std::conditional_t<std::is_floating_point_v<T>, T,
+                                 std::conditional_t<std::is_signed_v<T>, std::conditional_t<(sizeof(T) > 4), long long, long>,
+                                                    std::conditional_t<(sizeof(T) > 4), unsigned long long, unsigned long>>>;
+
+    const char* pcBegin = pcToken_;
+    const char* const pcEnd = pcToken_ + ullTokenLength_;
+    if (pcBegin != pcEnd && *pcBegin == '+') { ++pcBegin; }
+    if constexpr (R == 16)
+    {
+        if (pcEnd - pcBegin > 2 && pcBegin[0] == '0' && (pcBegin[1] == 'x' || pcBegin[1] == 'X')) { pcBegin += 2; }
+    }
+
+    L value{};
+    std::from_chars_result stResult{};
+    if constexpr (std::is_floating_point_v<L>) { stResult = std::from_chars(pcBegin, pcEnd, value); }
+    else { stResult = std::from_chars(pcBegin, pcEnd, value, R); }
+
+    // A sign after a skipped prefix is not something strto* would accept
+    if (stResult.ec == std::errc() && stResult.ptr == pcEnd && (pcBegin == pcToken_ || *pcBegin != '-')) { return static_cast<T>(value); }
+
+    if constexpr (std::is_same_v<L, float>) { return strtof(pcToken_, nullptr); }
+    else if constexpr (std::is_same_v<L, double>) { return strtod(pcToken_, nullptr); }
+    else if constexpr (std::is_same_v<L, long>) { return static_cast<T>(strtol(pcToken_, nullptr, R)); }
+    else if constexpr (std::is_same_v<L, long long>) { return static_cast<T>(strtoll(pcToken_, nullptr, R)); }
+    else if constexpr (std::is_same_v<L, unsigned long>) { return static_cast<T>(strtoul(pcToken_, nullptr, R)); }
+    else { return static_cast<T>(strtoull(pcToken_, nullptr, R)); }
+}
+
+//-----------------------------------------------------------------------
+//! \struct ConversionFormat
+//! \brief A printf conversion specification in a form that the encoders
+//! can format without going through printf.
+//
+//! Only a single numeric conversion of the form
+//! %[0][+][width][.precision][hh|h|l|ll](d|i|u|x|X|f|e) is represented.
+//! Anything else parses to a format with no type, meaning the conversion
+//! has to be printed with printf.
+//-----------------------------------------------------------------------
+struct ConversionFormat
+{
+    char cType{'\0'};     //!< d, i, u, x, X, f or e. '\0' if printf is needed.
+    char cLength{'\0'};   //!< 'H' for hh, 'h', 'l', 'L' for ll or '\0' for none.
+    bool bZeroPad{false}; //!< Pad to the width with zeros rather than spaces.
+    bool bPlusSign{false};
+    uint8_t ucWidth{0};
+    int8_t cPrecision{-1}; //!< -1 if no precision was given.
+
+    constexpr bool IsInteger() const { return cType == 'd' || cType == 'i' || cType == 'u' || cType == 'x' || cType == 'X'; }
+    constexpr bool IsFloat() const { return cType == 'f' || cType == 'e'; }
+    constexpr bool IsSigned() const { return cType == 'd' || cType == 'i' || IsFloat(); }
+
+    //-----------------------------------------------------------------------
+    //! \brief Parse a printf conversion string.
+    //
+    //! \param[in] svConversion_ The conversion string, e.g. "%.3lf".
+    //
+    //! \return The parsed format, with no type if the conversion string
+    //! is not one that ConversionFormat represents.
+    //-----------------------------------------------------------------------
+    static constexpr ConversionFormat Parse(std::string_view svConversion_)
+    {
+        ConversionFormat stFormat;
+        size_t i = 0;
+        if (svConversion_.empty() || svConversion_[i++] != '%') { return {}; }
+
+        for (; i < svConversion_.size(); ++i)
+        {
+            if (svConversion_[i] == '0') { stFormat.bZeroPad = true; }
+            else if (svConversion_[i] == '+') { stFormat.bPlusSign = true; }
+            else { break; }
+        }
+
+        // Widths and precisions are limited to two digits
+        const auto ParseDigits = [&](auto& tValue_) {
+            uint32_t uiValue = 0;
+            const size_t ullStart = i;
+            while (i < svConversion_.size() && svConversion_[i] >= '0' && svConversion_[i] <= '9' && i - ullStart < 2)
+            {
+                uiValue = uiValue * 10 + static_cast<uint32_t>(svConversion_[i++] - '0');
+            }
+            tValue_ = static_cast<std::remove_reference_t<decltype(tValue_)>>(uiValue);
+            return i < svConversion_.size() && svConversion_[i] >= '0' && svConversion_[i] <= '9';
+        };
+
+        if (ParseDigits(stFormat.ucWidth)) { return {}; }
+        if (i < svConversion_.size() && svConversion_[i] == '.')
+        {
+            ++i;
+            if (ParseDigits(stFormat.cPrecision)) { return {}; }
+        }
+
+        if (svConversion_.substr(i, 2) == "hh") { stFormat.cLength = 'H'; }
+        else if (svConversion_.substr(i, 2) == "ll") { stFormat.cLength = 'L'; }
+        else if (i < svConversion_.size() && (svConversion_[i] == 'h' || svConversion_[i] == 'l')) { stFormat.cLength = svConversion_[i]; }
+        i += stFormat.cLength == 'H' || stFormat.cLength == 'L' ? 2 : stFormat.cLength != '\0' ? 1 : 0;
+
+        if (i + 1 != svConversion_.size()) { return {}; }
+        stFormat.cType = svConversion_[i];
+
+        if (stFormat.IsInteger())
+        {
+            // A precision on an integer conversion changes how zero padding behaves
+            if (stFormat.cPrecision >= 0) { return {}; }
+        }
+        else if (stFormat.IsFloat())
+        {
+            if (stFormat.cLength != '\0' && stFormat.cLength != 'l') { return {}; }
+            if (stFormat.cPrecision < 0) { stFormat.cPrecision = 6; }
+        }
+        else { return {}; }
+
+        return stFormat;
+    }
+};
+
 //-----------------------------------------------------------------------
 //! \brief Strip a abbreviated ASCII formatting from the front of the
 //! log buffer.
@@ -38,6 +38,7 @@
 //-----------------------------------------------------------------------
 #include <array>
 #include <cstdint>
+#include <type_traits>
 
 constexpr auto uiCRCTable = [] {
     std::array<uint32_t, 256> uiPreCalcCRCTable{};
@@ -63,13 +64,77 @@ constexpr void CalculateCharacterCRC32(uint32_t& uiCRC, unsigned char ucChar)
     uiCRC = ((uiCRC >> 8) & 0x00FFFFFFL) ^ (uiCRCTable[uiIndex]);
 }
 
+// --------------------------------------------------------------------------
+// Slicing-by-8 tables. Table 0 is the regular byte-wise table, table N
+// advances the CRC of a byte that is followed by N zero bytes.
+// --------------------------------------------------------------------------
+constexpr auto uiCRCSliceTable = [] {
+    std::array<std::array<uint32_t, 256>, 8> uiPreCalcSliceTable{};
+
+    uiPreCalcSliceTable[0] = uiCRCTable;
+
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        for (uint32_t j = 1; j < 8; ++j)
+        {
+            const uint32_t crc = uiPreCalcSliceTable[j - 1][i];
+            uiPreCalcSliceTable[j][i] = (crc >> 8) ^ uiCRCTable[crc & 0xff];
+        }
+    }
+
+    return uiPreCalcSliceTable;
+}();
+
+// --------------------------------------------------------------------------
+// Calculates the CRC-32 of a block of data eight bytes at a time. Produces
+// the same result as CalculateCharacterCRC32 over every byte of the block.
+// --------------------------------------------------------------------------
+constexpr uint32_t CalculateBlockCRC32Slice8(uint32_t uiCount, uint32_t uiCRC, const unsigned char* ucBuffer)
+{
+    while (uiCount >= 8)
+    {
+        // Assemble the words byte by byte so the result does not depend on host endianness
+        const uint32_t uiLow = uiCRC ^ (static_cast<uint32_t>(ucBuffer[0]) | static_cast<uint32_t>(ucBuffer[1]) << 8 |
+                                        static_cast<uint32_t>(ucBuffer[2]) << 16 | static_cast<uint32_t>(ucBuffer[3]) << 24);
+        const uint32_t uiHigh = static_cast<uint32_t>(ucBuffer[4]) | static_cast<uint32_t>(ucBuffer[5]) << 8 |
+                                static_cast<uint32_t>(ucBuffer[6]) << 16 | static_cast<uint32_t>(ucBuffer[7]) << 24;
+
+        uiCRC = uiCRCSliceTable[7][uiLow & 0xff] ^ uiCRCSliceTable[6][(uiLow >> 8) & 0xff] ^ uiCRCSliceTable[5][(uiLow >> 16) & 0xff] ^
+                uiCRCSliceTable[4][uiLow >> 24] ^ uiCRCSliceTable[3][uiHigh & 0xff] ^ uiCRCSliceTable[2][(uiHigh >> 8) & 0xff] ^
+                uiCRCSliceTable[1][(uiHigh >> 16) & 0xff] ^ uiCRCSliceTable[0][uiHigh >> 24];
+
+        ucBuffer += 8;
+        uiCount -= 8;
+    }
+
+    while (uiCount-- != 0) { CalculateCharacterCRC32(uiCRC, *ucBuffer++); }
+    return uiCRC;
+}
+
+// --------------------------------------------------------------------------
+// Calculates the CRC-32 of a block of data using the fastest engine the host
+// CPU supports (PCLMULQDQ on x86, the CRC32 instructions on ARMv8, otherwise
+// slicing-by-8). The engine is selected once, on first use.
+// --------------------------------------------------------------------------
+uint32_t CalculateBlockCRC32Accelerated(uint32_t uiCount, uint32_t uiCRC, const unsigned char* ucBuffer);
+
+// --------------------------------------------------------------------------
+// Returns the name of the engine used by CalculateBlockCRC32Accelerated.
+// --------------------------------------------------------------------------
+const char* GetCRC32EngineName();
+
 // --------------------------------------------------------------------------
 // Calculates the CRC-32 of a block of data all at once
 // --------------------------------------------------------------------------
 constexpr uint32_t CalculateBlockCRC32(uint32_t uiCount, uint32_t uiCRC, const unsigned char* ucBuffer)
 {
-    while (uiCount-- != 0) { CalculateCharacterCRC32(uiCRC, *ucBuffer++); }
-    return (uiCRC);
+    if (std::is_constant_evaluated())
+    {
+        while (uiCount-- != 0) { CalculateCharacterCRC32(uiCRC, *ucBuffer++); }
+        return (uiCRC);
+    }
+
+    return CalculateBlockCRC32Accelerated(uiCount, uiCRC, ucBuffer);
 }
 
 // --------------------------------------------------------------------------
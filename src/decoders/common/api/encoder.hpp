@@ -36,6 +36,9 @@
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
+#include <charconv>
+#include <cmath>
+
 #include "decoders/common/api/common.hpp"
 #include "decoders/common/api/jsonreader.hpp"
 #include "decoders/common/api/message_decoder.hpp"
@@ -117,10 +120,212 @@ template <typename T> [[nodiscard]] bool CopyToBuffer(unsigned char** ppucBuffer
 }
 
 // -------------------------------------------------------------------------------------------------------
-template <typename T> std::function<bool(const FieldContainer&, char**, uint32_t&, JsonReader*)> BasicMapEntry(const char* F)
+//! Print the key of a JSON member, i.e. "name": followed by szOpening_, without going through printf.
+[[nodiscard]] inline bool PrintJsonKeyToBuffer(char** ppcBuffer_, uint32_t& uiBytesLeft_, const std::string& strName_, const char* szOpening_ = "")
+{
+    const size_t ullOpeningLength = strlen(szOpening_);
+    const size_t ullLength = strName_.size() + ullOpeningLength + 4;
+    if (uiBytesLeft_ < ullLength) { return false; }
+    char* pcBuffer = *ppcBuffer_;
+    *pcBuffer++ = '"';
+    memcpy(pcBuffer, strName_.data(), strName_.size());
+    pcBuffer += strName_.size();
+    memcpy(pcBuffer, "\": ", 3);
+    memcpy(pcBuffer + 3, szOpening_, ullOpeningLength);
+    *ppcBuffer_ += ullLength;
+    uiBytesLeft_ -= static_cast<uint32_t>(ullLength);
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+//! The longest value that FormatValue will write.
+constexpr uint32_t uiMaxFormattedLength = 128;
+
+// -------------------------------------------------------------------------------------------------------
+//! Write tValue_ to pcOut_ as printf would with the conversion stFormat_. pcOut_ must have room for
+//! uiMaxFormattedLength characters. Returns the number of characters written, or -1 if the conversion or
+//! the value needs printf.
+template <typename T> int32_t FormatValue(char* pcOut_, const ConversionFormat& stFormat_, T tValue_)
+{
+    char acDigits[uiMaxFormattedLength];
+    std::to_chars_result stResult{};
+    bool bNegative = false;
+
+    if constexpr (std::is_integral_v<T>)
+    {
+        if (!stFormat_.IsInteger()) { return -1; }
+
+        // Reproduce how printf reads the promoted argument according to the length modifier
+        const auto tPromoted = +tValue_;
+        uint64_t ullValue = 0;
+        int64_t llValue = 0;
+        if constexpr (sizeof(tPromoted) > sizeof(int32_t))
+        {
+            if (stFormat_.cLength != 'L' && (stFormat_.cLength != 'l' || sizeof(long) != sizeof(tPromoted))) { return -1; }
+            ullValue = static_cast<uint64_t>(tPromoted);
+            llValue = static_cast<int64_t>(tPromoted);
+        }
+        else
+        {
+            const auto uiBits = static_cast<uint32_t>(tPromoted);
+            switch (stFormat_.cLength)
+            {
+            case 'H':
+                ullValue = static_cast<uint8_t>(uiBits);
+                llValue = static_cast<int8_t>(uiBits);
+                break;
+            case 'h':
+                ullValue = static_cast<uint16_t>(uiBits);
+                llValue = static_cast<int16_t>(uiBits);
+                break;
+            default:
+                ullValue = uiBits;
+                llValue = static_cast<int32_t>(uiBits);
+                // A 64-bit length modifier on a 32-bit argument is only consistent across platforms for
+                // values that don't depend on sign extension
+                if (stFormat_.cLength != '\0' && stFormat_.IsSigned() && llValue < 0) { return -1; }
+                break;
+            }
+        }
+
+        if (stFormat_.IsSigned())
+        {
+            bNegative = llValue < 0;
+            ullValue = bNegative ? 0ULL - static_cast<uint64_t>(llValue) : static_cast<uint64_t>(llValue);
+        }
+
+        const bool bHex = stFormat_.cType == 'x' || stFormat_.cType == 'X';
+        stResult = std::to_chars(acDigits, acDigits + sizeof(acDigits), ullValue, bHex ? 16 : 10);
+        if (stFormat_.cType == 'X')
+        {
+            for (char* pcDigit = acDigits; pcDigit < stResult.ptr; ++pcDigit)
+            {
+                if (*pcDigit >= 'a') { *pcDigit = static_cast<char>(*pcDigit - 'a' + 'A'); }
+            }
+        }
+    }
+    else
+    {
+        static_assert(std::is_floating_point_v<T>, "FormatValue(): unsupported type");
+        if (!stFormat_.IsFloat() || !std::isfinite(tValue_)) { return -1; }
+
+        const auto dValue = static_cast<double>(tValue_);
+        bNegative = std::signbit(dValue);
+        stResult = std::to_chars(acDigits, acDigits + sizeof(acDigits), std::fabs(dValue),
+                                 stFormat_.cType == 'e' ? std::chars_format::scientific : std::chars_format::fixed, stFormat_.cPrecision);
+        if (stResult.ec != std::errc()) { return -1; }
+    }
+
+    const char cSign = bNegative ? '-' : stFormat_.bPlusSign && stFormat_.IsSigned() ? '+' : '\0';
+    const auto uiDigits = static_cast<uint32_t>(stResult.ptr - acDigits);
+    const uint32_t uiLength = uiDigits + (cSign != '\0' ? 1 : 0);
+    const uint32_t uiPadding = stFormat_.ucWidth > uiLength ? stFormat_.ucWidth - uiLength : 0;
+    if (uiLength + uiPadding > uiMaxFormattedLength) { return -1; }
+
+    char* pcOut = pcOut_;
+    if (!stFormat_.bZeroPad)
+    {
+        memset(pcOut, ' ', uiPadding);
+        pcOut += uiPadding;
+    }
+    if (cSign != '\0') { *pcOut++ = cSign; }
+    if (stFormat_.bZeroPad)
+    {
+        memset(pcOut, '0', uiPadding);
+        pcOut += uiPadding;
+    }
+    memcpy(pcOut, acDigits, uiDigits);
+    return static_cast<int32_t>(uiLength + uiPadding);
+}
+
+// -------------------------------------------------------------------------------------------------------
+//! Copy a value formatted by FormatValue to the buffer, null terminating it as PrintToBuffer would.
+[[nodiscard]] inline bool CopyFormattedToBuffer(char** ppcBuffer_, uint32_t& uiBytesLeft_, const char* pcFormatted_, uint32_t uiLength_)
+{
+    if (uiBytesLeft_ < uiLength_) { return false; }
+    memcpy(*ppcBuffer_, pcFormatted_, uiLength_);
+    *ppcBuffer_ += uiLength_;
+    uiBytesLeft_ -= uiLength_;
+    if (uiBytesLeft_ > 0) { **ppcBuffer_ = '\0'; }
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+//! Print a value with a conversion that has been parsed into stFormat_, falling back to printing it with
+//! szFormat_ when the conversion or the value needs printf. The output is the same either way.
+template <typename T>
+[[nodiscard]] bool FormatToBuffer(char** ppcBuffer_, uint32_t& uiBytesLeft_, const ConversionFormat& stFormat_, const char* szFormat_, T tValue_)
+{
+    char acFormatted[uiMaxFormattedLength];
+    const int32_t iLength = FormatValue(acFormatted, stFormat_, tValue_);
+    if (iLength < 0) { return PrintToBuffer(ppcBuffer_, uiBytesLeft_, szFormat_, tValue_); }
+    return CopyFormattedToBuffer(ppcBuffer_, uiBytesLeft_, acFormatted, static_cast<uint32_t>(iLength));
+}
+
+//-----------------------------------------------------------------------
+//! \struct FixedConversion
+//! \brief A conversion string known at compile time along with its
+//! parsed format.
+//-----------------------------------------------------------------------
+struct FixedConversion
+{
+    const char* szFormat;
+    ConversionFormat stFormat;
+
+    constexpr FixedConversion(const char* szFormat_) : szFormat(szFormat_), stFormat(ConversionFormat::Parse(szFormat_)) {}
+};
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T> [[nodiscard]] bool FormatToBuffer(char** ppcBuffer_, uint32_t& uiBytesLeft_, const FixedConversion& stConversion_, T tValue_)
+{
+    return FormatToBuffer(ppcBuffer_, uiBytesLeft_, stConversion_.stFormat, stConversion_.szFormat, tValue_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T> [[nodiscard]] bool FormatToBuffer(char** ppcBuffer_, uint32_t& uiBytesLeft_, const BaseField* pstFieldDef_, T tValue_)
+{
+    return FormatToBuffer(ppcBuffer_, uiBytesLeft_, pstFieldDef_->conversionFormat, pstFieldDef_->conversion.c_str(), tValue_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+//! Print a float or double field with a %k or %lk conversion, choosing between fixed and scientific
+//! notation the same way as MakeConversionString.
+template <typename T> [[nodiscard]] bool FormatAdaptiveToBuffer(char** ppcBuffer_, uint32_t& uiBytesLeft_, const FieldContainer& fc_)
+{
+    const BaseField* pstFieldDef = fc_.field_def;
+    const int32_t iBefore = pstFieldDef->conversionBeforePoint;
+    const int32_t iAfter = pstFieldDef->conversionAfterPoint;
+    const auto fVal = std::get<T>(fc_.field_value);
+
+    ConversionFormat stFormat;
+    int32_t iPrecision = iAfter;
+    stFormat.cType = 'f';
+    if (fabs(fVal) >= std::numeric_limits<T>::epsilon())
+    {
+        if (iAfter == 0 && iBefore == 0) { iPrecision = 1; }
+        else if (fabs(fVal) > pstFieldDef->conversionUpperLimit)
+        {
+            stFormat.cType = 'e';
+            iPrecision = iBefore + iAfter - 1;
+        }
+        else if (fabs(fVal) < pstFieldDef->conversionLowerLimit) { stFormat.cType = 'e'; }
+    }
+
+    if (iPrecision >= 0 && iPrecision < 100)
+    {
+        stFormat.cPrecision = static_cast<int8_t>(iPrecision);
+        char acFormatted[uiMaxFormattedLength];
+        const int32_t iLength = FormatValue(acFormatted, stFormat, fVal);
+        if (iLength >= 0) { return CopyFormattedToBuffer(ppcBuffer_, uiBytesLeft_, acFormatted, static_cast<uint32_t>(iLength)); }
+    }
+    return PrintToBuffer(ppcBuffer_, uiBytesLeft_, MakeConversionString<T>(fc_).data(), fVal);
+}
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T> std::function<bool(const FieldContainer&, char**, uint32_t&, JsonReader*)> BasicMapEntry(const FixedConversion stConversion_)
 {
-    return [F](const FieldContainer& fc, char** ppcOutBuf, uint32_t& uiBytesLeft, [[maybe_unused]] JsonReader* pclMsgDb) {
-        return PrintToBuffer(ppcOutBuf, uiBytesLeft, F, std::get<T>(fc.field_value));
+    return [stConversion_](const FieldContainer& fc, char** ppcOutBuf, uint32_t& uiBytesLeft, [[maybe_unused]] JsonReader* pclMsgDb) {
+        return FormatToBuffer(ppcOutBuf, uiBytesLeft, stConversion_, std::get<T>(fc.field_value));
     };
 }
 
@@ -138,30 +343,58 @@ class EncoderBase
     EnumDefinition* vMyPortAddrDefns{nullptr};
     EnumDefinition* vMyGPSTimeStatusDefns{nullptr};
 
-    static std::unordered_map<uint64_t, std::function<bool(const FieldContainer&, char**, uint32_t&, [[maybe_unused]] JsonReader*)>> asciiFieldMap;
-    static std::unordered_map<uint64_t, std::function<bool(const FieldContainer&, char**, uint32_t&, [[maybe_unused]] JsonReader*)>> jsonFieldMap;
-    // is there a way to do this with static variables instead?
+    //! \brief Field encoders keyed by the CRC-32 of the conversion string they print.
+    using FieldEncoderMap = std::unordered_map<uint64_t, std::function<bool(const FieldContainer&, char**, uint32_t&, JsonReader*)>>;
+
+    //! \brief The ASCII and JSON field encoders of an encoder class. They are
+    //! built once per class and shared, read-only, by all of its instances.
+    struct FieldEncoderMaps
+    {
+        FieldEncoderMap asciiFieldMap;
+        FieldEncoderMap jsonFieldMap;
+    };
+
+    const FieldEncoderMaps* pstMyFieldMaps;
+
     virtual char separatorASCII() const { return ','; };
     virtual char separatorAbbASCII() const { return ' '; };
     virtual uint32_t indentationLengthAbbASCII() const { return 5; };
 
+    // The body encoders below read either an IntermediateMessage or a FlatFieldRange.
+
     // Encode binary
-    template <bool FLATTEN>
-    [[nodiscard]] bool EncodeBinaryBody(const IntermediateMessage& stInterMessage_, unsigned char** ppcOutBuf_, uint32_t& uiBytesLeft_);
+    template <bool FLATTEN, typename T>
+    [[nodiscard]] bool EncodeBinaryBody(const T& stInterMessage_, unsigned char** ppcOutBuf_, uint32_t& uiBytesLeft_);
     [[nodiscard]] virtual bool FieldToBinary(const FieldContainer& fc_, unsigned char** ppcOutBuf_, uint32_t& uiBytesLeft_);
 
     // Encode ascii
-    template <bool ABBREVIATED>
-    [[nodiscard]] bool EncodeAsciiBody(const std::vector<FieldContainer>& vInterFormat_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+    template <bool ABBREVIATED, typename T>
+    [[nodiscard]] bool EncodeAsciiBody(const T& vInterFormat_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
                                        [[maybe_unused]] uint32_t uiIndentationLevel = 1);
     [[nodiscard]] bool FieldToAscii(const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_);
 
     // Encode JSON
     [[nodiscard]] bool FieldToJson(const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_);
-    [[nodiscard]] bool EncodeJsonBody(const std::vector<FieldContainer>& vInterFormat_, char** ppcOutBuf_, uint32_t& uiBytesLeft_);
+    template <typename T> [[nodiscard]] bool EncodeJsonBody(const T& vInterFormat_, char** ppcOutBuf_, uint32_t& uiBytesLeft_);
 
     virtual void InitEnumDefns();
-    void InitFieldMaps();
+    static void InitFieldMaps(FieldEncoderMap& asciiFieldMap_, FieldEncoderMap& jsonFieldMap_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the field encoders of the EncoderBase class.
+    //
+    //! \return The field encoders, built on the first call.
+    //----------------------------------------------------------------------------
+    static const FieldEncoderMaps& BaseFieldMaps();
+
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for derived classes that add field encoders.
+    //
+    //! \param[in] stFieldMaps_ The field encoders to use, which must outlive
+    //! the encoder.
+    //! \param[in] pclJsonDb_ A pointer to a JsonReader object.
+    //----------------------------------------------------------------------------
+    EncoderBase(const FieldEncoderMaps& stFieldMaps_, JsonReader* pclJsonDb_);
 
   public:
     //----------------------------------------------------------------------------
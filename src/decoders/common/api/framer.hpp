@@ -60,6 +60,11 @@ class FramerBase
     bool bMyReportUnknownBytes{true};
     bool bMyPayloadOnly{false};
     bool bMyFrameJson{false};
+    bool bMyBulkScan{true};
+    bool bMyFrameInPlace{false};
+
+    const unsigned char* pucMyFrame{nullptr};
+    uint32_t uiMyFrameInPlaceLength{0U};
 
     virtual void ResetState() = 0;
 
@@ -81,6 +86,39 @@ class FramerBase
         ResetState();
     }
 
+    //----------------------------------------------------------------------------
+    //! \brief Hand over a complete frame from the front of the circular buffer.
+    //! The frame is left in place if that is enabled and the frame is
+    //! contiguous, otherwise it is copied into pucFrameBuffer_ and discarded.
+    //
+    //! \param[out] pucFrameBuffer_ The buffer to copy the frame to.
+    //! \param[in] uiFrameLength_ The length of the frame.
+    //----------------------------------------------------------------------------
+    void ReturnFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameLength_)
+    {
+        const unsigned char* pucInPlace = bMyFrameInPlace ? clMyCircularDataBuffer.GetContiguous(0, uiFrameLength_) : nullptr;
+        if (pucInPlace != nullptr)
+        {
+            pucMyFrame = pucInPlace;
+            uiMyFrameInPlaceLength = uiFrameLength_;
+            return;
+        }
+
+        clMyCircularDataBuffer.Copy(pucFrameBuffer_, uiFrameLength_);
+        clMyCircularDataBuffer.Discard(uiFrameLength_);
+        pucMyFrame = pucFrameBuffer_;
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Discard the frame that was last left in place, if any.
+    //----------------------------------------------------------------------------
+    void ReleaseFrame()
+    {
+        clMyCircularDataBuffer.Discard(uiMyFrameInPlaceLength);
+        uiMyFrameInPlaceLength = 0;
+        pucMyFrame = nullptr;
+    }
+
   public:
     //----------------------------------------------------------------------------
     //! \brief A constructor for the FramerBase class.
@@ -126,6 +164,46 @@ class FramerBase
     //----------------------------------------------------------------------------
     void SetFrameJson(bool bFrameJson_) { bMyFrameJson = bFrameJson_; }
 
+    //----------------------------------------------------------------------------
+    //! \brief Should the Framer scan runs of bytes in bulk where the framing
+    //! state cannot change, rather than stepping through them one at a time?
+    //! Both modes return identical frames.
+    //
+    //! \param[in] bBulkScan_ true if the Framer should use the bulk-scan fast
+    //! path.
+    //----------------------------------------------------------------------------
+    void SetBulkScan(bool bBulkScan_) { bMyBulkScan = bBulkScan_; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Should the Framer keep its bytes in a double-mapped ("magic ring")
+    //! buffer, so that every frame is contiguous in memory and can be copied out
+    //! in one step?
+    //
+    //! \param[in] bMirrored_ true if the Framer should use a mirrored buffer.
+    //
+    //! \return true if the buffer is mirrored. Only supported on Linux.
+    //----------------------------------------------------------------------------
+    bool SetMirroredBuffer(bool bMirrored_) { return clMyCircularDataBuffer.SetMirrored(bMirrored_); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Should the Framer leave complete frames in its internal buffer
+    //! instead of copying them into the caller's frame buffer? Frames that are
+    //! not contiguous are still copied. Use GetFrameData() to find the frame.
+    //
+    //! \param[in] bFrameInPlace_ true if the Framer should leave frames in place.
+    //! \remark Pair with SetMirroredBuffer() so that every frame is contiguous.
+    //----------------------------------------------------------------------------
+    void SetFrameInPlace(bool bFrameInPlace_) { bMyFrameInPlace = bFrameInPlace_; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the frame returned by the last successful call to GetFrame().
+    //
+    //! \return A pointer to the frame, either inside the internal buffer or in
+    //! the caller's frame buffer. The pointer is valid until the next call to
+    //! GetFrame(), Flush() or Write().
+    //----------------------------------------------------------------------------
+    const unsigned char* GetFrameData() const { return pucMyFrame; }
+
     //----------------------------------------------------------------------------
     //! \brief Should the Framer return only the message body of messages and
     //! discard the header?
@@ -150,6 +228,16 @@ class FramerBase
     //----------------------------------------------------------------------------
     virtual uint32_t GetBytesAvailableInBuffer() const { return clMyCircularDataBuffer.GetCapacity() - clMyCircularDataBuffer.GetLength(); }
 
+    //----------------------------------------------------------------------------
+    //! \brief Get the number of bytes in the internal circular buffer that
+    //! have not been framed yet.
+    //
+    //! \return The number of bytes in the internal circular buffer.
+    //! \remark A frame left in place is counted until the next call to
+    //! GetFrame(), Flush() or Write().
+    //----------------------------------------------------------------------------
+    uint32_t GetBytesInBuffer() const { return clMyCircularDataBuffer.GetLength(); }
+
     //----------------------------------------------------------------------------
     //! \brief Write new bytes to the internal circular buffer.
     //
@@ -174,6 +262,8 @@ class FramerBase
     //----------------------------------------------------------------------------
     virtual uint32_t Flush(unsigned char* pucBuffer_, uint32_t uiBufferSize_)
     {
+        ReleaseFrame();
+
         const uint32_t uiBytesToFlush = std::min(clMyCircularDataBuffer.GetLength(), uiBufferSize_);
 
         HandleUnknownBytes(pucBuffer_, uiBytesToFlush);
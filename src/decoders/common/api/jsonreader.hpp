@@ -36,13 +36,19 @@
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
+#include <atomic>
+#include <cmath>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <logger/logger.hpp>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include "common.hpp"
@@ -209,7 +215,52 @@ struct EnumDefinition
     std::string name{};
     std::vector<novatel::edie::EnumDataType> enumerators{};
 
+    //! Lookup indexes into enumerators, built by BuildIndexes(). They hold
+    //! positions rather than pointers so that copies of the definition stay valid.
+    std::vector<uint32_t> vValueIndex{}; //!< Dense value->position table, or positions sorted by value if sparse.
+    std::vector<uint32_t> vNameIndex{};  //!< Positions sorted by name.
+    std::vector<uint32_t> vDescIndex{};  //!< Positions sorted by description.
+    bool bDenseValues{false};
+
     constexpr EnumDefinition() = default;
+
+    //----------------------------------------------------------------------------
+    //! \brief Build the value and name lookup indexes for the enumerators.
+    //
+    //! Must be called again whenever enumerators is modified. Lookups fall
+    //! back to a linear scan if the indexes were never built or enumerators
+    //! were added or removed since, but renaming an enumerator or changing its
+    //! value in place isn't detected: lookups return wrong results until
+    //! BuildIndexes() is called.
+    //----------------------------------------------------------------------------
+    void BuildIndexes();
+
+    //----------------------------------------------------------------------------
+    //! \brief Check that indexes were built for as many enumerators as there
+    //! are now. Changes to the enumerators themselves aren't detected.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] bool HasIndexes() const { return vNameIndex.size() == enumerators.size() && !vNameIndex.empty(); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Find an enumerator by value.
+    //
+    //! \return A pointer to the enumerator, or nullptr if not found.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const EnumDataType* FindValue(uint32_t uiValue_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Find an enumerator by name.
+    //
+    //! \return A pointer to the enumerator, or nullptr if not found.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const EnumDataType* FindName(std::string_view svName_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Find an enumerator by description.
+    //
+    //! \return A pointer to the enumerator, or nullptr if not found.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const EnumDataType* FindDescription(std::string_view svDescription_) const;
 };
 
 //-----------------------------------------------------------------------
@@ -250,6 +301,10 @@ struct BaseField
     uint32_t conversionHash{0ULL};
     int32_t conversionBeforePoint{0};
     int32_t conversionAfterPoint{0};
+    ConversionFormat conversionFormat;
+    // Magnitudes outside of these limits are printed in scientific notation by %k and %lk
+    double conversionUpperLimit{1.0};
+    double conversionLowerLimit{1.0};
     SimpleDataType dataType;
 
     BaseField() = default;
@@ -271,6 +326,9 @@ struct BaseField
         conversion = sConversion;
         parseConversion(sConversionStripped, conversionBeforePoint, conversionAfterPoint);
         conversionHash = CalculateBlockCRC32(sConversionStripped.c_str());
+        conversionFormat = ConversionFormat::Parse(conversion);
+        conversionUpperLimit = pow(10.0, conversionBeforePoint);
+        conversionLowerLimit = pow(10.0, -conversionBeforePoint);
     }
 
     void parseConversion(std::string& strStrippedConversionString_, int32_t& iBeforePoint_, int32_t& iAfterPoint_) const
@@ -453,7 +511,7 @@ struct MessageDefinition
         return *this;
     }
 
-    std::vector<BaseField*> const* GetMsgDefFromCRC(std::shared_ptr<spdlog::logger> pclLogger_, uint32_t& uiMsgDefCRC_) const;
+    std::vector<BaseField*> const* GetMsgDefFromCRC(const std::shared_ptr<spdlog::logger>& pclLogger_, uint32_t& uiMsgDefCRC_) const;
 };
 
 // Forward declaration of from_json
@@ -471,23 +529,69 @@ void from_json(const json& j, EnumDefinition& ed);
 uint32_t parse_fields(const json& j, std::vector<novatel::edie::BaseField*>& vFields);
 void parse_enumerators(const json& j, std::vector<novatel::edie::EnumDataType>& vEnumerators);
 
+//-----------------------------------------------------------------------
+//! \struct StringHash
+//! \brief Transparent string hash, so that maps keyed on std::string can
+//! be searched with a std::string_view without constructing a key.
+//-----------------------------------------------------------------------
+struct StringHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view svKey_) const { return std::hash<std::string_view>{}(svKey_); }
+};
+
+template <typename T> using StringMap = std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
+//-----------------------------------------------------------------------
+//! \struct LazyMessageDefinition
+//! \brief Where to find a message definition in a Json file that was
+//! loaded lazily, and the definition once it has been built.
+//-----------------------------------------------------------------------
+struct LazyMessageDefinition
+{
+    std::string name;
+    uint32_t logID{0};
+    uint64_t ullOffset{0}; //!< Offset of the message's Json object in the file.
+    uint64_t ullLength{0}; //!< Length of the message's Json object in the file.
+    mutable std::atomic<const MessageDefinition*> pstDefinition{nullptr};
+};
+
 } // namespace novatel::edie
 
 //============================================================================
 //! \class JsonReader
 //! \brief Responsible for translating the Json representation of the
 //! NovAtel UI DB.
+//
+//! \remark Once loaded, a JsonReader may be shared without copying by any
+//! number of decoders, encoders and parsers on different threads. Its const
+//! member functions, including lookups that build a message definition of a
+//! lazily loaded DB, are safe to call concurrently. Loading, appending or
+//! removing definitions is not, and must not overlap with any other use.
 //============================================================================
 class JsonReader
 {
     std::vector<novatel::edie::MessageDefinition> vMessageDefinitions;
     std::vector<novatel::edie::EnumDefinition> vEnumDefinitions;
-    std::unordered_map<std::string, novatel::edie::MessageDefinition*> mMessageName;
+    novatel::edie::StringMap<novatel::edie::MessageDefinition*> mMessageName;
     std::unordered_map<int32_t, novatel::edie::MessageDefinition*> mMessageID;
-    std::unordered_map<std::string, novatel::edie::EnumDefinition*> mEnumName;
-    std::unordered_map<std::string, novatel::edie::EnumDefinition*> mEnumID;
+    novatel::edie::StringMap<novatel::edie::EnumDefinition*> mEnumName;
+    novatel::edie::StringMap<novatel::edie::EnumDefinition*> mEnumID;
+    uint64_t ullGeneration{0};
+
+    // Messages of a Json file loaded with LoadFileLazy(), built on first use
+    std::filesystem::path clLazyFilePath;
+    std::vector<std::unique_ptr<novatel::edie::LazyMessageDefinition>> vLazyMessages;
+    novatel::edie::StringMap<const novatel::edie::LazyMessageDefinition*> mLazyMessageName;
+    std::unordered_map<int32_t, const novatel::edie::LazyMessageDefinition*> mLazyMessageID;
+    mutable std::deque<novatel::edie::MessageDefinition> dqLazyDefinitions;
+    mutable std::mutex clLazyMutex;
 
   public:
+    //! \brief uiCACHE_VERSION: changed whenever the layout of a cache written by SaveCache() changes.
+    static constexpr uint32_t uiCACHE_VERSION = 1;
+
     //----------------------------------------------------------------------------
     //! \brief A constructor for the JsonReader class.
     //----------------------------------------------------------------------------
@@ -504,6 +608,7 @@ class JsonReader
         vEnumDefinitions = that.vEnumDefinitions;
         vMessageDefinitions = that.vMessageDefinitions;
         GenerateMappings();
+        CopyLazyMessages(that);
     }
 
     //----------------------------------------------------------------------------
@@ -518,6 +623,7 @@ class JsonReader
             vEnumDefinitions = that.vEnumDefinitions;
             vMessageDefinitions = that.vMessageDefinitions;
             GenerateMappings();
+            CopyLazyMessages(that);
         }
 
         return *this;
@@ -535,6 +641,49 @@ class JsonReader
     //----------------------------------------------------------------------------
     template <typename T> void LoadFile(T filePath_);
 
+    //----------------------------------------------------------------------------
+    //! \brief Load a Json DB from the provided filepath lazily. The enums are
+    //! loaded, but only the name, ID and position in the file of each message
+    //! are read. A message definition is built the first time it is looked up,
+    //! which is safe to do from several threads at once.
+    //
+    //! \param [in] clJsonPath_ The filepath to the Json file, which must stay
+    //! unchanged while the DB is in use.
+    //----------------------------------------------------------------------------
+    void LoadFileLazy(const std::filesystem::path& clJsonPath_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Load a Json DB from the provided filepath through a binary cache.
+    //! The cache is loaded if it was written for the current contents of the
+    //! Json file. Otherwise the Json file is loaded and the cache is rewritten.
+    //
+    //! \param [in] clJsonPath_ The filepath to the Json file.
+    //! \param [in] clCachePath_ The filepath to the cache. Defaults to the
+    //! Json filepath with ".cache" appended.
+    //----------------------------------------------------------------------------
+    void LoadFileCached(const std::filesystem::path& clJsonPath_, std::filesystem::path clCachePath_ = {});
+
+    //----------------------------------------------------------------------------
+    //! \brief Save the loaded DB to a binary cache, stamped with the size and
+    //! CRC of the Json file it was loaded from.
+    //
+    //! \param [in] clCachePath_ The filepath to write the cache to.
+    //! \param [in] clJsonPath_ The filepath to the Json file the DB was loaded from.
+    //----------------------------------------------------------------------------
+    void SaveCache(const std::filesystem::path& clCachePath_, const std::filesystem::path& clJsonPath_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Load a DB from a binary cache written by SaveCache().
+    //
+    //! \param [in] clCachePath_ The filepath to the cache.
+    //! \param [in] clJsonPath_ The filepath to the Json file the cache must
+    //! have been written for.
+    //
+    //! \return false, leaving the DB unchanged, if the cache is missing,
+    //! corrupt, from another version, or the Json file has changed since.
+    //----------------------------------------------------------------------------
+    bool LoadCache(const std::filesystem::path& clCachePath_, const std::filesystem::path& clJsonPath_);
+
     //----------------------------------------------------------------------------
     //! \brief Append a message Json DB from the provided filepath.
     //
@@ -575,7 +724,7 @@ class JsonReader
     //
     //! \param [in] strMsgName_ A string containing the message name.
     //----------------------------------------------------------------------------
-    const novatel::edie::MessageDefinition* GetMsgDef(const std::string& strMsgName_) const;
+    const novatel::edie::MessageDefinition* GetMsgDef(std::string_view strMsgName_) const;
 
     //----------------------------------------------------------------------------
     //! \brief Get a UI DB message definition for the provided message ID.
@@ -588,8 +737,10 @@ class JsonReader
     //! \brief Convert a message name string to an message ID number
     //
     //! \param [in] sMsgName_ The message name string
+    //
+    //! \return The packed message ID, or 0 if the message is not defined.
     //----------------------------------------------------------------------------
-    uint32_t MsgNameToMsgId(std::string sMsgName_) const;
+    uint32_t MsgNameToMsgId(std::string_view sMsgName_) const;
 
     //----------------------------------------------------------------------------
     //! \brief Convert a message ID number to a message name string
@@ -603,7 +754,7 @@ class JsonReader
     //
     //! \param [in] sEnumNameOrID_ The enum ID.
     //----------------------------------------------------------------------------
-    novatel::edie::EnumDefinition* GetEnumDefID(const std::string& sEnumID) const
+    novatel::edie::EnumDefinition* GetEnumDefID(std::string_view sEnumID) const
     {
         auto it = mEnumID.find(sEnumID);
         return it != mEnumID.end() ? it->second : nullptr;
@@ -614,15 +765,29 @@ class JsonReader
     //
     //! \param [in] sEnumNameOrID_ The enum name.
     //----------------------------------------------------------------------------
-    novatel::edie::EnumDefinition* GetEnumDefName(const std::string& sEnumName) const
+    novatel::edie::EnumDefinition* GetEnumDefName(std::string_view sEnumName) const
     {
         auto it = mEnumName.find(sEnumName);
         return it != mEnumName.end() ? it->second : nullptr;
     }
 
+    //----------------------------------------------------------------------------
+    //! \brief Get all UI DB message definitions, except those of a DB loaded
+    //! with LoadFileLazy().
+    //----------------------------------------------------------------------------
+    const std::vector<novatel::edie::MessageDefinition>& GetMessageDefinitions() const { return vMessageDefinitions; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get a counter that changes every time the definitions are
+    //! modified, so that anything derived from them can tell it is stale.
+    //----------------------------------------------------------------------------
+    uint64_t GetGeneration() const { return ullGeneration; }
+
   private:
     void GenerateMappings()
     {
+        ++ullGeneration;
+
         for (novatel::edie::EnumDefinition& enm : vEnumDefinitions)
         {
             mEnumName[enm.name] = &enm;
@@ -636,9 +801,16 @@ class JsonReader
 
             for (const auto& field : msg.fields) { MapMessageEnumFields(field.second); }
         }
+
+        // Definitions built from a lazily loaded DB point into the enums as well
+        std::lock_guard<std::mutex> clLock(clLazyMutex);
+        for (const novatel::edie::MessageDefinition& msg : dqLazyDefinitions)
+        {
+            for (const auto& field : msg.fields) { MapMessageEnumFields(field.second); }
+        }
     }
 
-    void MapMessageEnumFields(const std::vector<novatel::edie::BaseField*>& vMsgDefFields_)
+    void MapMessageEnumFields(const std::vector<novatel::edie::BaseField*>& vMsgDefFields_) const
     {
         for (const auto& field : vMsgDefFields_)
         {
@@ -653,6 +825,23 @@ class JsonReader
         }
     }
 
+    //----------------------------------------------------------------------------
+    //! \brief Get the definition of a lazily loaded message, building it if
+    //! this is the first time it has been looked up.
+    //----------------------------------------------------------------------------
+    const novatel::edie::MessageDefinition* GetLazyMsgDef(const novatel::edie::LazyMessageDefinition& stLazyMsg_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Forget the messages of a lazily loaded DB.
+    //----------------------------------------------------------------------------
+    void ClearLazyMessages();
+
+    //----------------------------------------------------------------------------
+    //! \brief Take over the index of a lazily loaded DB from another reader.
+    //! The copied messages are built again on first use.
+    //----------------------------------------------------------------------------
+    void CopyLazyMessages(const JsonReader& that);
+
     void RemoveMessageMapping(novatel::edie::MessageDefinition& msg)
     {
         // Check string against name map
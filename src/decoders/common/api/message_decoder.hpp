@@ -37,15 +37,19 @@
 // Includes
 //-----------------------------------------------------------------------
 #include <cassert>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <logger/logger.hpp>
 #include <map>
 #include <nlohmann/json.hpp>
+#include <span>
 #include <sstream>
 #include <stdarg.h>
 #include <string>
+#include <string_view>
 #include <variant>
+#include <vector>
 
 #include "decoders/common/api/common.hpp"
 #include "decoders/common/api/crc32.hpp"
@@ -72,6 +76,8 @@ struct FieldContainer
 
     template <class T> FieldContainer(T field_value_, const BaseField* field_def_) : field_value(field_value_), field_def(field_def_) {}
 
+    FieldContainer(std::string_view field_value_, const BaseField* field_def_) : field_value(std::string(field_value_)), field_def(field_def_) {}
+
     FieldContainer([[maybe_unused]] const FieldContainer& obj)
     {
         throw std::runtime_error("FieldContainer: I'm being copied. Implement a proper copy constructor.");
@@ -80,6 +86,357 @@ struct FieldContainer
 
 typedef std::vector<FieldContainer> IntermediateMessage;
 
+//! \brief A single decoded value, i.e. FieldContainer::field_value without the nested array alternative.
+typedef std::variant<novatel_types> FieldValue;
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T, typename... Ts> constexpr uint8_t TypeIndex()
+{
+    constexpr bool abMatches[] = {std::is_same_v<T, Ts>...};
+    for (uint8_t i = 0; i < sizeof...(Ts); ++i)
+    {
+        if (abMatches[i]) { return i; }
+    }
+    return sizeof...(Ts);
+}
+
+//! \brief Type tag of a FlatField, the index of the held type in FieldValue.
+template <typename T> constexpr uint8_t FlatTypeIndex() { return TypeIndex<T, novatel_types>(); }
+
+//! \brief Type tag of a FlatField that holds an array of child fields.
+constexpr uint8_t FLAT_ARRAY = std::variant_size_v<FieldValue>;
+
+//-----------------------------------------------------------------------
+//! \struct FlatField
+//! \brief A single typed slot of a FlatIntermediateMessage.
+//-----------------------------------------------------------------------
+struct FlatField
+{
+    const BaseField* field_def{nullptr};
+    uint64_t ullValue{0}; //!< Raw bytes of a scalar value or the arena offset of a string.
+    uint32_t uiNext{0};   //!< Slot index following this field and all of its children.
+    uint32_t uiCount{0};  //!< Number of direct children of an array or the length of a string.
+    uint8_t ucType{0};    //!< FlatTypeIndex of the held value or FLAT_ARRAY.
+};
+
+class FlatIntermediateMessage;
+
+//-----------------------------------------------------------------------
+//! \struct FlatFieldView
+//! \brief A reference to a single field of a FlatIntermediateMessage.
+//-----------------------------------------------------------------------
+struct FlatFieldView
+{
+    const BaseField* field_def;
+    const FlatIntermediateMessage* pclMessage;
+    uint32_t uiIndex;
+};
+
+//============================================================================
+//! \class FlatFieldRange
+//! \brief The sibling fields of one level of a FlatIntermediateMessage.
+//============================================================================
+class FlatFieldRange
+{
+  private:
+    const FlatIntermediateMessage* pclMyMessage;
+    uint32_t uiMyBegin;
+    uint32_t uiMyEnd;
+    uint32_t uiMyCount;
+
+  public:
+    class Iterator
+    {
+      private:
+        const FlatIntermediateMessage* pclMyMessage;
+        uint32_t uiMyIndex;
+
+      public:
+        Iterator(const FlatIntermediateMessage* pclMessage_, uint32_t uiIndex_) : pclMyMessage(pclMessage_), uiMyIndex(uiIndex_) {}
+
+        inline FlatFieldView operator*() const;
+        inline Iterator& operator++();
+        bool operator!=(const Iterator& clOther_) const { return uiMyIndex != clOther_.uiMyIndex; }
+    };
+
+    FlatFieldRange(const FlatIntermediateMessage* pclMessage_, uint32_t uiBegin_, uint32_t uiEnd_, uint32_t uiCount_)
+        : pclMyMessage(pclMessage_), uiMyBegin(uiBegin_), uiMyEnd(uiEnd_), uiMyCount(uiCount_)
+    {
+    }
+
+    Iterator begin() const { return {pclMyMessage, uiMyBegin}; }
+    Iterator end() const { return {pclMyMessage, uiMyEnd}; }
+    size_t size() const { return uiMyCount; }
+    bool empty() const { return uiMyCount == 0; }
+};
+
+//============================================================================
+//! \class FlatIntermediateMessage
+//! \brief An IntermediateMessage stored as one contiguous arena of typed
+//! slots.
+//
+//! Fields are laid out depth first: an array slot is followed directly by
+//! its children and records the index of the slot that follows its last
+//! child. Strings live in a separate character arena. Clearing the message
+//! keeps both arenas, so once warmed up decoding into it does not allocate.
+//============================================================================
+class FlatIntermediateMessage
+{
+  private:
+    std::vector<FlatField> vMyFields;
+    std::vector<char> vMyStrings;
+    uint32_t uiMyTopLevelCount{0};
+
+    FlatField& AddField(uint32_t uiParent_, const BaseField* field_def_, uint8_t ucType_)
+    {
+        if (uiParent_ == NO_PARENT) { ++uiMyTopLevelCount; }
+        else { ++vMyFields[uiParent_].uiCount; }
+
+        const auto uiIndex = static_cast<uint32_t>(vMyFields.size());
+        FlatField& stField = vMyFields.emplace_back();
+        stField.field_def = field_def_;
+        stField.ucType = ucType_;
+        stField.uiNext = uiIndex + 1;
+        return stField;
+    }
+
+  public:
+    static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+    //----------------------------------------------------------------------------
+    //! \brief Remove all fields while keeping the allocated arenas.
+    //----------------------------------------------------------------------------
+    void clear()
+    {
+        vMyFields.clear();
+        vMyStrings.clear();
+        uiMyTopLevelCount = 0;
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Reserve space for a number of fields and string characters.
+    //----------------------------------------------------------------------------
+    void reserve(size_t uiFields_, size_t uiStringBytes_ = 0)
+    {
+        vMyFields.reserve(uiFields_);
+        vMyStrings.reserve(uiStringBytes_);
+    }
+
+    //! \return The total number of slots, including array elements.
+    size_t size() const { return vMyFields.size(); }
+    bool empty() const { return vMyFields.empty(); }
+
+    const FlatField& operator[](uint32_t uiIndex_) const { return vMyFields[uiIndex_]; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Append a scalar value to the array at uiParent_, or to the top
+    //! level if uiParent_ is NO_PARENT.
+    //----------------------------------------------------------------------------
+    template <typename T> void AddValue(uint32_t uiParent_, T tValue_, const BaseField* field_def_)
+    {
+        static_assert(std::is_arithmetic_v<T> && FlatTypeIndex<T>() < FLAT_ARRAY, "FlatIntermediateMessage: unsupported value type");
+        memcpy(&AddField(uiParent_, field_def_, FlatTypeIndex<T>()).ullValue, &tValue_, sizeof(T));
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Append a string to the array at uiParent_. The characters are
+    //! copied into the arena and null terminated.
+    //----------------------------------------------------------------------------
+    void AddString(uint32_t uiParent_, std::string_view svValue_, const BaseField* field_def_)
+    {
+        FlatField& stField = AddField(uiParent_, field_def_, FlatTypeIndex<std::string>());
+        stField.ullValue = vMyStrings.size();
+        stField.uiCount = static_cast<uint32_t>(svValue_.size());
+        vMyStrings.insert(vMyStrings.end(), svValue_.begin(), svValue_.end());
+        vMyStrings.push_back('\0');
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Open an array field. Fields added with the returned index as
+    //! their parent become its elements until EndArray is called.
+    //----------------------------------------------------------------------------
+    uint32_t BeginArray(uint32_t uiParent_, const BaseField* field_def_)
+    {
+        AddField(uiParent_, field_def_, FLAT_ARRAY);
+        return static_cast<uint32_t>(vMyFields.size() - 1);
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Close the array opened at uiArray_.
+    //----------------------------------------------------------------------------
+    void EndArray(uint32_t uiArray_) { vMyFields[uiArray_].uiNext = static_cast<uint32_t>(vMyFields.size()); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get a scalar value, with the same type checking as std::get.
+    //----------------------------------------------------------------------------
+    template <typename T> T GetValue(uint32_t uiIndex_) const
+    {
+        const FlatField& stField = vMyFields[uiIndex_];
+        if (stField.ucType != FlatTypeIndex<T>()) { throw std::bad_variant_access(); }
+        T tValue;
+        memcpy(&tValue, &stField.ullValue, sizeof(T));
+        return tValue;
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get a null terminated string value.
+    //----------------------------------------------------------------------------
+    const char* GetString(uint32_t uiIndex_) const
+    {
+        const FlatField& stField = vMyFields[uiIndex_];
+        if (stField.ucType != FlatTypeIndex<std::string>()) { throw std::bad_variant_access(); }
+        return vMyStrings.data() + stField.ullValue;
+    }
+
+    //! \return The top level fields of the message.
+    FlatFieldRange GetFields() const { return {this, 0, static_cast<uint32_t>(vMyFields.size()), uiMyTopLevelCount}; }
+
+    //! \return The elements of the array field at uiArray_.
+    FlatFieldRange GetChildren(uint32_t uiArray_) const
+    {
+        const FlatField& stField = vMyFields[uiArray_];
+        if (stField.ucType != FLAT_ARRAY) { throw std::bad_variant_access(); }
+        return {this, uiArray_ + 1, stField.uiNext, stField.uiCount};
+    }
+};
+
+// -------------------------------------------------------------------------------------------------------
+inline FlatFieldView FlatFieldRange::Iterator::operator*() const { return {(*pclMyMessage)[uiMyIndex].field_def, pclMyMessage, uiMyIndex}; }
+
+// -------------------------------------------------------------------------------------------------------
+inline FlatFieldRange::Iterator& FlatFieldRange::Iterator::operator++()
+{
+    uiMyIndex = (*pclMyMessage)[uiMyIndex].uiNext;
+    return *this;
+}
+
+//============================================================================
+//! \class FlatFieldWriter
+//! \brief Appends decoded fields to one level of a FlatIntermediateMessage
+//! through the same emplace_back() interface as IntermediateMessage.
+//============================================================================
+class FlatFieldWriter
+{
+  private:
+    FlatIntermediateMessage* pclMyMessage;
+    uint32_t uiMyParent;
+
+  public:
+    FlatFieldWriter(FlatIntermediateMessage& clMessage_, uint32_t uiParent_ = FlatIntermediateMessage::NO_PARENT)
+        : pclMyMessage(&clMessage_), uiMyParent(uiParent_)
+    {
+    }
+
+    template <typename T> void emplace_back(const T& tValue_, const BaseField* field_def_)
+    {
+        if constexpr (std::is_convertible_v<const T&, std::string_view>) { pclMyMessage->AddString(uiMyParent, tValue_, field_def_); }
+        else { pclMyMessage->AddValue(uiMyParent, tValue_, field_def_); }
+    }
+
+    // Elements are appended to the shared arena, there is nothing to reserve per level.
+    void reserve([[maybe_unused]] size_t uiSize_) {}
+
+    FlatFieldWriter BeginArray(const BaseField* field_def_) { return {*pclMyMessage, pclMyMessage->BeginArray(uiMyParent, field_def_)}; }
+    void EndArray() { pclMyMessage->EndArray(uiMyParent); }
+};
+
+// -------------------------------------------------------------------------------------------------------
+// Accessors that let the decoders and encoders work on either representation.
+// -------------------------------------------------------------------------------------------------------
+inline std::vector<FieldContainer>& BeginArrayField(std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* field_def_, size_t uiSize_)
+{
+    auto& vArray = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field_def_).field_value);
+    vArray.reserve(uiSize_);
+    return vArray;
+}
+
+inline void EndArrayField([[maybe_unused]] std::vector<FieldContainer>& vArray_) {}
+
+inline FlatFieldWriter BeginArrayField(FlatFieldWriter& clWriter_, const BaseField* field_def_, [[maybe_unused]] size_t uiSize_)
+{
+    return clWriter_.BeginArray(field_def_);
+}
+
+inline void EndArrayField(FlatFieldWriter& clArray_) { clArray_.EndArray(); }
+
+inline bool IsArrayField(const FieldContainer& fc_) { return std::holds_alternative<std::vector<FieldContainer>>(fc_.field_value); }
+inline bool IsArrayField(const FlatFieldView& ff_) { return (*ff_.pclMessage)[ff_.uiIndex].ucType == FLAT_ARRAY; }
+
+inline const std::vector<FieldContainer>& GetArrayField(const FieldContainer& fc_) { return std::get<std::vector<FieldContainer>>(fc_.field_value); }
+inline FlatFieldRange GetArrayField(const FlatFieldView& ff_) { return ff_.pclMessage->GetChildren(ff_.uiIndex); }
+
+template <typename T> bool HoldsFieldValue(const FieldContainer& fc_) { return std::holds_alternative<T>(fc_.field_value); }
+template <typename T> bool HoldsFieldValue(const FlatFieldView& ff_) { return (*ff_.pclMessage)[ff_.uiIndex].ucType == FlatTypeIndex<T>(); }
+
+template <typename T> T GetFieldValue(const FieldContainer& fc_) { return std::get<T>(fc_.field_value); }
+template <typename T> T GetFieldValue(const FlatFieldView& ff_) { return ff_.pclMessage->GetValue<T>(ff_.uiIndex); }
+
+inline const char* GetFieldString(const FieldContainer& fc_) { return std::get<std::string>(fc_.field_value).c_str(); }
+inline const char* GetFieldString(const FlatFieldView& ff_) { return ff_.pclMessage->GetString(ff_.uiIndex); }
+
+inline const FieldContainer& AsFieldContainer(const FieldContainer& fc_) { return fc_; }
+
+// -------------------------------------------------------------------------------------------------------
+inline FieldContainer AsFieldContainer(const FlatFieldView& ff_)
+{
+    const FlatIntermediateMessage& clMessage = *ff_.pclMessage;
+    switch (clMessage[ff_.uiIndex].ucType)
+    {
+    case FlatTypeIndex<bool>(): return {clMessage.GetValue<bool>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<int8_t>(): return {clMessage.GetValue<int8_t>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<int16_t>(): return {clMessage.GetValue<int16_t>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<int32_t>(): return {clMessage.GetValue<int32_t>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<int64_t>(): return {clMessage.GetValue<int64_t>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<uint8_t>(): return {clMessage.GetValue<uint8_t>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<uint16_t>(): return {clMessage.GetValue<uint16_t>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<uint32_t>(): return {clMessage.GetValue<uint32_t>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<uint64_t>(): return {clMessage.GetValue<uint64_t>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<float>(): return {clMessage.GetValue<float>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<double>(): return {clMessage.GetValue<double>(ff_.uiIndex), ff_.field_def};
+    case FlatTypeIndex<std::string>(): return {std::string_view(clMessage.GetString(ff_.uiIndex)), ff_.field_def};
+    default: throw std::runtime_error("AsFieldContainer(): Array fields have no single value");
+    }
+}
+
+//! Field converters resolved from a conversion string.
+typedef FieldValue (*AsciiFieldDecoder)(const BaseField*, char**, const size_t, JsonReader*);
+typedef FieldValue (*JsonFieldDecoder)(const BaseField*, json, JsonReader*);
+
+//-----------------------------------------------------------------------
+//! \struct DecodeStep
+//! \brief A single field of a DecodePlan with everything the decoders
+//! need from its definition resolved ahead of time.
+//-----------------------------------------------------------------------
+struct DecodeStep
+{
+    const BaseField* pclField{nullptr};
+    FIELD_TYPE eFieldType{FIELD_TYPE::UNKNOWN};
+    DATA_TYPE eDataType{DATA_TYPE::UNKNOWN};
+    uint16_t usLength{0};                      //!< Binary length of one value.
+    uint8_t ucAlignment{1};                    //!< Binary byte boundary of the field.
+    bool bPrintAsString{false};                //!< Array is a quoted string.
+    bool bCommaSeparated{false};               //!< Array values are separate tokens.
+    bool bHexByteArray{false};                 //!< Array converted with %Z.
+    bool bSignedByteArray{false};              //!< Array converted with %P.
+    uint32_t uiArrayLength{0};                 //!< Fixed or maximum array length.
+    uint32_t uiEnumLength{0};                  //!< Width of an ASCII enum value.
+    const EnumDefinition* pclEnumDef{nullptr}; //!< Enumerators of an enum field.
+    AsciiFieldDecoder pfAsciiDecoder{nullptr}; //!< Null if the conversion is unknown.
+    JsonFieldDecoder pfJsonDecoder{nullptr};   //!< Null if the conversion is unknown.
+    uint32_t uiSubPlan{UINT32_MAX};            //!< Index in DecodePlan::vSubPlans of a field array.
+};
+
+//-----------------------------------------------------------------------
+//! \struct DecodePlan
+//! \brief A message definition's field list compiled into DecodeSteps,
+//! with the field lists of field arrays compiled alongside it.
+//-----------------------------------------------------------------------
+struct DecodePlan
+{
+    std::vector<DecodeStep> vSteps;
+    std::vector<DecodePlan> vSubPlans;
+};
+
 //============================================================================
 //! \class MessageDecoderBase
 //! \brief Class to decode messages.
@@ -102,54 +459,97 @@ class MessageDecoderBase
 
     // Enum util functions
     void InitEnumDefns();
-    void InitFieldMaps();
     void CreateResponseMsgDefns();
 
+    // Plans for every field list in the database, keyed by the data of the field list they were compiled from
+    std::unordered_map<BaseField* const*, DecodePlan> mMyDecodePlans;
+    uint64_t ullMyPlanGeneration{0};
+
+    void CompileDecodePlans();
+    [[nodiscard]] const DecodePlan& GetDecodePlan(const std::vector<BaseField*>& vMsgDefFields_);
+    [[nodiscard]] const DecodePlan* FindDecodePlan(std::span<BaseField* const> vMsgDefFields_) const;
+
+    [[nodiscard]] STATUS GetMsgDefFields(MetaDataBase& stMetaData_, const std::vector<BaseField*>*& pvMsgDefFields_) const;
+    template <typename T>
+    [[nodiscard]] STATUS DecodeBody(const DecodePlan& stPlan_, unsigned char* pucInData_, T& vIntermediateFormat_, const MetaDataBase& stMetaData_) const;
+
+  protected:
+    //! \brief The ASCII and JSON field decoders of a decoder class, keyed by the
+    //! CRC-32 of the conversion string they parse. They are built once per class
+    //! and shared, read-only, by all of its instances.
+    struct FieldDecoderMaps
+    {
+        std::unordered_map<uint32_t, AsciiFieldDecoder> asciiFieldMap;
+        std::unordered_map<uint32_t, JsonFieldDecoder> jsonFieldMap;
+    };
+
+  private:
+    const FieldDecoderMaps* pstMyFieldMaps;
+
+    static void InitFieldMaps(std::unordered_map<uint32_t, AsciiFieldDecoder>& asciiFieldMap_,
+                              std::unordered_map<uint32_t, JsonFieldDecoder>& jsonFieldMap_);
+
   protected:
-    std::unordered_map<uint32_t, std::function<void(std::vector<FieldContainer>&, const BaseField*, char**, [[maybe_unused]] const size_t,
-                                                    [[maybe_unused]] JsonReader*)>>
-        asciiFieldMap;
-    std::unordered_map<uint32_t, std::function<void(std::vector<FieldContainer>&, const BaseField*, json, [[maybe_unused]] JsonReader*)>>
-        jsonFieldMap;
-
-    [[nodiscard]] STATUS DecodeBinary(const std::vector<BaseField*> MsgDefFields_, unsigned char** ppucLogBuf_,
-                                      std::vector<FieldContainer>& vIntermediateFormat_, uint32_t uiMessageLength_) const;
-    template <bool ABB>
-    [[nodiscard]] STATUS DecodeAscii(const std::vector<BaseField*> MsgDefFields_, char** ppcLogBuf_,
-                                     std::vector<FieldContainer>& vIntermediateFormat_) const;
-    [[nodiscard]] STATUS DecodeJson(const std::vector<BaseField*> MsgDefFields_, json clJsonFields_,
-                                    std::vector<FieldContainer>& vIntermediateFormat_) const;
-
-    void DecodeBinaryField(const BaseField* MessageDataType_, unsigned char** ppcLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_) const;
-    void DecodeAsciiField(const BaseField* MessageDataType_, char** ppcToken_, const size_t tokenLength_,
-                          std::vector<FieldContainer>& vIntermediateFormat_) const;
-    void DecodeJsonField(const BaseField* MessageDataType_, json clJsonField_, std::vector<FieldContainer>& vIntermediateFormat_) const;
+    //----------------------------------------------------------------------------
+    //! \brief Get the field decoders of the MessageDecoderBase class.
+    //
+    //! \return The field decoders, built on the first call.
+    //----------------------------------------------------------------------------
+    static const FieldDecoderMaps& BaseFieldMaps();
+
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for derived classes that add field decoders.
+    //
+    //! \param[in] stFieldMaps_ The field decoders to use, which must outlive
+    //! the decoder.
+    //! \param[in] pclJsonDb_ A pointer to a JsonReader object.
+    //----------------------------------------------------------------------------
+    MessageDecoderBase(const FieldDecoderMaps& stFieldMaps_, JsonReader* pclJsonDb_);
+
+    [[nodiscard]] DecodeStep CompileStep(const BaseField* pclField_) const;
+    [[nodiscard]] DecodePlan CompilePlan(std::span<BaseField* const> vMsgDefFields_) const;
+
+    // The decoders below append to either an IntermediateMessage or a FlatFieldWriter.
+    template <typename T>
+    [[nodiscard]] STATUS DecodeBinary(const DecodePlan& stPlan_, unsigned char** ppucLogBuf_, T& vIntermediateFormat_, uint32_t uiMessageLength_) const;
+    template <bool ABB, typename T> [[nodiscard]] STATUS DecodeAscii(const DecodePlan& stPlan_, char** ppcLogBuf_, T& vIntermediateFormat_) const;
+    template <typename T> [[nodiscard]] STATUS DecodeJson(const DecodePlan& stPlan_, json clJsonFields_, T& vIntermediateFormat_) const;
+
+    template <typename T> void DecodeBinaryField(const DecodeStep& stStep_, unsigned char** ppcLogBuf_, T& vIntermediateFormat_) const;
+    template <typename T>
+    void DecodeAsciiField(const DecodeStep& stStep_, char** ppcToken_, const size_t tokenLength_, T& vIntermediateFormat_) const;
+    template <typename T> void DecodeJsonField(const DecodeStep& stStep_, json clJsonField_, T& vIntermediateFormat_) const;
+
+    // Overloads that use the plan of a field list from the database, or compile the field list on every call if it isn't in the database.
+    template <typename T>
+    [[nodiscard]] STATUS DecodeBinary(std::span<BaseField* const> MsgDefFields_, unsigned char** ppucLogBuf_, T& vIntermediateFormat_,
+                                      uint32_t uiMessageLength_) const;
+    template <bool ABB, typename T>
+    [[nodiscard]] STATUS DecodeAscii(std::span<BaseField* const> MsgDefFields_, char** ppcLogBuf_, T& vIntermediateFormat_) const;
+    template <typename T> [[nodiscard]] STATUS DecodeJson(std::span<BaseField* const> MsgDefFields_, json clJsonFields_, T& vIntermediateFormat_) const;
+
+    template <typename T> void DecodeBinaryField(const BaseField* MessageDataType_, unsigned char** ppcLogBuf_, T& vIntermediateFormat_) const;
+    template <typename T>
+    void DecodeAsciiField(const BaseField* MessageDataType_, char** ppcToken_, const size_t tokenLength_, T& vIntermediateFormat_) const;
+    template <typename T> void DecodeJsonField(const BaseField* MessageDataType_, json clJsonField_, T& vIntermediateFormat_) const;
 
     // -------------------------------------------------------------------------------------------------------
-    template <typename T, int R = 10>
-    std::function<void(std::vector<FieldContainer>&, const BaseField*, char**, const size_t, JsonReader*)> SimpleAsciiMapEntry()
-    {
-        return [](std::vector<FieldContainer>& vIntermediate_, const BaseField* MessageDataType_, char** ppcToken_,
-                  [[maybe_unused]] const size_t tokenLength_, [[maybe_unused]] JsonReader* pclMsgDb) {
-            if constexpr (std::is_same_v<T, int8_t>) vIntermediate_.emplace_back(static_cast<T>(strtol(*ppcToken_, nullptr, R)), MessageDataType_);
-            if constexpr (std::is_same_v<T, int16_t>) vIntermediate_.emplace_back(static_cast<T>(strtol(*ppcToken_, nullptr, R)), MessageDataType_);
-            if constexpr (std::is_same_v<T, int32_t>) vIntermediate_.emplace_back(static_cast<T>(strtol(*ppcToken_, nullptr, R)), MessageDataType_);
-            if constexpr (std::is_same_v<T, int64_t>) vIntermediate_.emplace_back(static_cast<T>(strtoll(*ppcToken_, nullptr, R)), MessageDataType_);
-            if constexpr (std::is_same_v<T, uint8_t>) vIntermediate_.emplace_back(static_cast<T>(strtoul(*ppcToken_, nullptr, R)), MessageDataType_);
-            if constexpr (std::is_same_v<T, uint16_t>) vIntermediate_.emplace_back(static_cast<T>(strtoul(*ppcToken_, nullptr, R)), MessageDataType_);
-            if constexpr (std::is_same_v<T, uint32_t>) vIntermediate_.emplace_back(static_cast<T>(strtoul(*ppcToken_, nullptr, R)), MessageDataType_);
-            if constexpr (std::is_same_v<T, uint64_t>)
-                vIntermediate_.emplace_back(static_cast<T>(strtoull(*ppcToken_, nullptr, R)), MessageDataType_);
-            if constexpr (std::is_same_v<T, float>) vIntermediate_.emplace_back(strtof(*ppcToken_, nullptr), MessageDataType_);
-            if constexpr (std::is_same_v<T, double>) vIntermediate_.emplace_back(strtod(*ppcToken_, nullptr), MessageDataType_);
+    template <typename T, int R = 10> static AsciiFieldDecoder SimpleAsciiMapEntry()
+    {
+        return []([[maybe_unused]] const BaseField* MessageDataType_, char** ppcToken_, const size_t tokenLength_,
+                  [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+            if constexpr (std::is_integral_v<T> || std::is_same_v<T, float> || std::is_same_v<T, double>)
+                return ParseAsciiNumber<T, R>(*ppcToken_, tokenLength_);
+            else static_assert(sizeof(T) == 0, "SimpleAsciiMapEntry(): unsupported type");
         };
     }
 
     // -------------------------------------------------------------------------------------------------------
-    template <typename T> std::function<void(std::vector<FieldContainer>&, const BaseField*, json, JsonReader* pclMsgDb)> SimpleJsonMapEntry()
+    template <typename T> static JsonFieldDecoder SimpleJsonMapEntry()
     {
-        return [](std::vector<FieldContainer>& vIntermediate_, const BaseField* MessageDataType_, json clJsonField_,
-                  [[maybe_unused]] JsonReader* pclMsgDb) { vIntermediate_.emplace_back(clJsonField_.get<T>(), MessageDataType_); };
+        return []([[maybe_unused]] const BaseField* MessageDataType_, json clJsonField_, [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+            return clJsonField_.get<T>();
+        };
     }
 
   public:
@@ -161,9 +561,13 @@ class MessageDecoderBase
     MessageDecoderBase(JsonReader* pclJsonDb_ = nullptr);
 
     //----------------------------------------------------------------------------
-    //! \brief Load a JsonReader object.
+    //! \brief Load a JsonReader object and compile a decode plan for every
+    //! message definition in it.
     //
     //! \param[in] pclJsonDb_ A pointer to a JsonReader object.
+    //
+    //! \remark The plans are recompiled on the next Decode() if the database
+    //! is modified afterwards.
     //----------------------------------------------------------------------------
     void LoadJsonDb(JsonReader* pclJsonDb_);
 
@@ -208,6 +612,20 @@ class MessageDecoderBase
     //!   UNKNOWN: The header format provided is not known.
     //----------------------------------------------------------------------------
     [[nodiscard]] STATUS Decode(unsigned char* pucMessage_, IntermediateMessage& stInterMessage_, MetaDataBase& stMetaData_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode a message body from the provided frame into a flat,
+    //! reusable representation.
+    //
+    //! \param[in] pucMessage_ A pointer to a message body.
+    //! \param[out] stInterMessage_ The FlatIntermediateMessage to be populated.
+    //! Its previous contents are cleared but its storage is reused.
+    //! \param[in, out] stMetaData_ MetaDataStruct to provide information about
+    //! the frame and be fully populated to help describe the decoded log.
+    //
+    //! \return The same error codes as the IntermediateMessage overload.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS Decode(unsigned char* pucMessage_, FlatIntermediateMessage& stInterMessage_, MetaDataBase& stMetaData_);
 };
 } // namespace novatel::edie
 
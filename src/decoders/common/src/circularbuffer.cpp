@@ -37,27 +37,109 @@
 #include <cassert>
 #include <cstring>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "crc32.hpp"
 #include "nexcept.h"
 
+#ifdef __linux__
+namespace {
 //---------------------------------------------------------------------------
-void CircularBuffer::SetCapacity(uint32_t uiCapacity_)
+uint32_t RoundUpToPageSize(uint32_t uiBytes_)
 {
-    // Set the size of the buffer (bytes)
-    if (uiCapacity_ <= uiMyCapacity) return;
+    const auto uiPageSize = static_cast<uint32_t>(sysconf(_SC_PAGESIZE));
+    return (std::max(uiBytes_, 1U) + uiPageSize - 1) / uiPageSize * uiPageSize;
+}
+
+//---------------------------------------------------------------------------
+// Map the same uiCapacity_ bytes twice, back to back, so that the second half
+// of the mapping aliases the first. uiCapacity_ must be a multiple of the page
+// size. Returns nullptr on failure.
+unsigned char* MapMirrored(uint32_t uiCapacity_)
+{
+    const int iFd = memfd_create("edie_circularbuffer", MFD_CLOEXEC);
+    if (iFd < 0) return nullptr;
+
+    unsigned char* pucBuffer = nullptr;
+    const size_t ullCapacity = uiCapacity_;
 
-    const auto pucBuffer = new unsigned char[uiCapacity_];
+    if (ftruncate(iFd, static_cast<off_t>(ullCapacity)) == 0)
+    {
+        // Reserve the address range first so both halves land next to each other
+        void* pvReserved = mmap(nullptr, 2 * ullCapacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pvReserved != MAP_FAILED)
+        {
+            auto* pucReserved = static_cast<unsigned char*>(pvReserved);
+            if (mmap(pucReserved, ullCapacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFd, 0) != MAP_FAILED &&
+                mmap(pucReserved + ullCapacity, ullCapacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFd, 0) != MAP_FAILED)
+            {
+                pucBuffer = pucReserved;
+            }
+            else { munmap(pvReserved, 2 * ullCapacity); }
+        }
+    }
+
+    // The mappings keep the memory alive
+    close(iFd);
+    return pucBuffer;
+}
+} // namespace
+#endif
+
+//---------------------------------------------------------------------------
+CircularBuffer::~CircularBuffer() { Release(); }
+
+//---------------------------------------------------------------------------
+void CircularBuffer::Release()
+{
+#ifdef __linux__
+    if (bMyMirrored)
+    {
+        munmap(pucMyBuffer, 2 * static_cast<size_t>(uiMyCapacity));
+        pucMyBuffer = nullptr;
+        bMyMirrored = false;
+        return;
+    }
+#endif
+    delete[] pucMyBuffer;
+    pucMyBuffer = nullptr;
+}
+
+//---------------------------------------------------------------------------
+void CircularBuffer::Reallocate(uint32_t uiCapacity_)
+{
+    unsigned char* pucBuffer = nullptr;
+    bool bMirrored = false;
+
+#ifdef __linux__
+    if (bMyUseMirroring)
+    {
+        uiCapacity_ = RoundUpToPageSize(uiCapacity_);
+        pucBuffer = MapMirrored(uiCapacity_);
+        bMirrored = pucBuffer != nullptr;
+    }
+#endif
+
+    // Fall back to ordinary memory if the buffer could not be mapped
+    if (pucBuffer == nullptr)
+    {
+        pucBuffer = new unsigned char[uiCapacity_];
+        if (pucBuffer != nullptr) memset(pucBuffer, '*', uiCapacity_);
+    }
 
     // Do nothing if new failed.... just use existing buffer
     if (pucBuffer != nullptr)
     {
-        memset(pucBuffer, '*', uiCapacity_);
-
         // Copy the data from our old buffer to the new one
         Copy(pucBuffer, uiMyLength);
 
         // Free the old buffer and take ownership of the new buffer
-        delete[] pucMyBuffer;
+        Release();
         pucMyBuffer = pucBuffer;
+        bMyMirrored = bMirrored;
 
         // Update our pointers to point into the new buffer
         pucMyHead = pucMyBuffer;
@@ -69,6 +151,30 @@ void CircularBuffer::SetCapacity(uint32_t uiCapacity_)
     if (pucMyBuffer == nullptr) throw nExcept("Out of memory!");
 }
 
+//---------------------------------------------------------------------------
+bool CircularBuffer::SetMirrored(bool bMirrored_)
+{
+#ifdef __linux__
+    bMyUseMirroring = bMirrored_;
+
+    // Move any existing data into the new kind of memory
+    if (bMyUseMirroring != bMyMirrored) Reallocate(uiMyCapacity);
+#else
+    static_cast<void>(bMirrored_);
+#endif
+
+    return bMyMirrored;
+}
+
+//---------------------------------------------------------------------------
+void CircularBuffer::SetCapacity(uint32_t uiCapacity_)
+{
+    // Set the size of the buffer (bytes)
+    if (uiCapacity_ <= uiMyCapacity) return;
+
+    Reallocate(uiCapacity_);
+}
+
 //---------------------------------------------------------------------------
 uint32_t CircularBuffer::Append(const unsigned char* pucData_, uint32_t uiBytes_)
 {
@@ -88,7 +194,7 @@ uint32_t CircularBuffer::Append(const unsigned char* pucData_, uint32_t uiBytes_
     // Append data to buffer.  Do this in 2 steps, in case of wrap around.
     // Don't need to worry about overwriting data, because we enlarged the
     // buffer to guarantee a fit.
-    auto uiCopyBytes = std::min(static_cast<uint32_t>(pucMyBuffer + uiMyCapacity - pucMyTail), uiBytes_);
+    auto uiCopyBytes = ContiguousBytes(pucMyTail, uiBytes_);
 
     memcpy(pucMyTail, pucData_, uiCopyBytes);
 
@@ -97,6 +203,10 @@ uint32_t CircularBuffer::Append(const unsigned char* pucData_, uint32_t uiBytes_
     pucMyTail += uiCopyBytes;
     pucData_ += uiCopyBytes;
 
+    // A mirrored buffer writes through the wrap point in one step, so only
+    // the tail pointer needs to be brought back into the first mapping.
+    if (bMyMirrored && pucMyTail >= pucMyBuffer + uiMyCapacity) pucMyTail -= uiMyCapacity;
+
     // Copy any remaining data.  No need to check for overwriting data because
     // uiBytes_ was adjusted as necessary in the 'Enlarge buffer' block above
     uiCopyBytes = uiBytes_ - uiCopyBytes;
@@ -141,7 +251,7 @@ uint32_t CircularBuffer::Copy(unsigned char* pucTarget_, uint32_t uiBytes_) cons
         // Copy data from our buffer to the target buffer, beginning
         // at the logical beginning of our buffer.  We do this in two
         // steps, in case of wraparound.
-        auto uiCopyBytes = std::min(static_cast<uint32_t>(pucMyBuffer + uiMyCapacity - pucMyHead), uiBytes_);
+        auto uiCopyBytes = ContiguousBytes(pucMyHead, uiBytes_);
 
         memcpy(pucTarget_, pucMyHead, uiCopyBytes);
         pucTarget_ += uiCopyBytes;
@@ -154,6 +264,58 @@ uint32_t CircularBuffer::Copy(unsigned char* pucTarget_, uint32_t uiBytes_) cons
     return uiBytes_;
 }
 
+//---------------------------------------------------------------------------
+uint32_t CircularBuffer::CalculateCRC32(uint32_t uiOffset_, uint32_t uiBytes_, uint32_t uiCRC_) const
+{
+    if (uiOffset_ >= uiMyLength) return uiCRC_;
+
+    // Don't read more than we have
+    uiBytes_ = std::min(uiBytes_, uiMyLength - uiOffset_);
+
+    const unsigned char* pucStart = pucMyHead + uiOffset_;
+    if (pucStart >= pucMyBuffer + uiMyCapacity) pucStart -= uiMyCapacity;
+
+    // Process the data in two steps, in case of wraparound.
+    const auto uiFirstBytes = ContiguousBytes(pucStart, uiBytes_);
+    uiCRC_ = CalculateBlockCRC32(uiFirstBytes, uiCRC_, pucStart);
+
+    if (uiBytes_ > uiFirstBytes) uiCRC_ = CalculateBlockCRC32(uiBytes_ - uiFirstBytes, uiCRC_, pucMyBuffer);
+
+    return uiCRC_;
+}
+
+//---------------------------------------------------------------------------
+uint32_t CircularBuffer::FindFirstOf(uint32_t uiOffset_, uint32_t uiEnd_, const std::array<bool, 256>& abMatch_) const
+{
+    uiEnd_ = std::min(uiEnd_, uiMyLength);
+    if (uiOffset_ >= uiEnd_) return uiEnd_;
+
+    const auto IsMatch = [&abMatch_](unsigned char ucByte_) { return abMatch_[ucByte_]; };
+
+    const unsigned char* pucStart = pucMyHead + uiOffset_;
+    if (pucStart >= pucMyBuffer + uiMyCapacity) pucStart -= uiMyCapacity;
+
+    // Search the data in two steps, in case of wraparound.
+    const auto uiFirstBytes = ContiguousBytes(pucStart, uiEnd_ - uiOffset_);
+    const unsigned char* pucFound = std::find_if(pucStart, pucStart + uiFirstBytes, IsMatch);
+    if (pucFound != pucStart + uiFirstBytes) return uiOffset_ + static_cast<uint32_t>(pucFound - pucStart);
+
+    const uint32_t uiSecondBytes = uiEnd_ - uiOffset_ - uiFirstBytes;
+    pucFound = std::find_if(pucMyBuffer, pucMyBuffer + uiSecondBytes, IsMatch);
+    return uiOffset_ + uiFirstBytes + static_cast<uint32_t>(pucFound - pucMyBuffer);
+}
+
+//---------------------------------------------------------------------------
+const unsigned char* CircularBuffer::GetContiguous(uint32_t uiOffset_, uint32_t uiBytes_) const
+{
+    if (uiOffset_ > uiMyLength || uiBytes_ > uiMyLength - uiOffset_) return nullptr;
+
+    const unsigned char* pucStart = pucMyHead + uiOffset_;
+    if (pucStart >= pucMyBuffer + uiMyCapacity) pucStart -= uiMyCapacity;
+
+    return ContiguousBytes(pucStart, uiBytes_) == uiBytes_ ? pucStart : nullptr;
+}
+
 //---------------------------------------------------------------------------
 void CircularBuffer::Discard(uint32_t uiBytes_)
 {
@@ -72,48 +72,27 @@ unsigned char PackMsgType(const uint32_t uiSiblingID_, const uint32_t uiMsgForma
 }
 
 //-----------------------------------------------------------------------
-std::string GetEnumString(const EnumDefinition* const stEnumDef_, uint32_t uiEnum_)
+const std::string& GetEnumString(const EnumDefinition* const stEnumDef_, uint32_t uiEnum_)
 {
-    if (stEnumDef_ != nullptr)
-    {
-        for (auto& e : stEnumDef_->enumerators)
-        {
-            if (e.value == uiEnum_) { return e.name; }
-        }
-    }
+    static const std::string strUnknown("UNKNOWN");
 
-    return std::string("UNKNOWN");
+    const EnumDataType* pstEnum = stEnumDef_ != nullptr ? stEnumDef_->FindValue(uiEnum_) : nullptr;
+    return pstEnum != nullptr ? pstEnum->name : strUnknown;
 }
 
 //-----------------------------------------------------------------------
-int32_t GetEnumValue(const EnumDefinition* const stEnumDef_, std::string strEnum_)
+int32_t GetEnumValue(const EnumDefinition* const stEnumDef_, std::string_view strEnum_)
 {
-    if (stEnumDef_ != nullptr)
-    {
-        for (auto& e : stEnumDef_->enumerators)
-        {
-            if (e.name == strEnum_) { return static_cast<int32_t>(e.value); }
-        }
-    }
-
-    return 0;
+    const EnumDataType* pstEnum = stEnumDef_ != nullptr ? stEnumDef_->FindName(strEnum_) : nullptr;
+    return pstEnum != nullptr ? static_cast<int32_t>(pstEnum->value) : 0;
 }
 
 //-----------------------------------------------------------------------
-int32_t GetResponseId(const EnumDefinition* const stRespDef_, std::string strResp_)
+int32_t GetResponseId(const EnumDefinition* const stRespDef_, std::string_view strResp_)
 {
-    if (stRespDef_ != nullptr)
-    {
-        for (auto& e : stRespDef_->enumerators)
-        {
-            if (e.description == strResp_) // response string is stored in description
-            {
-                return static_cast<int32_t>(e.value);
-            }
-        }
-    }
-
-    return 0;
+    // response string is stored in description
+    const EnumDataType* pstResp = stRespDef_ != nullptr ? stRespDef_->FindDescription(strResp_) : nullptr;
+    return pstResp != nullptr ? static_cast<int32_t>(pstResp->value) : 0;
 }
 
 //-----------------------------------------------------------------------
@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file crc32.cpp
+//! \brief Hardware accelerated CRC32 engines and runtime engine selection.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "crc32.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define EDIE_CRC32_PCLMUL
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define EDIE_TARGET_PCLMUL
+#else
+#define EDIE_TARGET_PCLMUL __attribute__((target("pclmul,sse2")))
+#endif
+#elif defined(__aarch64__) && defined(__linux__) && defined(__GNUC__)
+#define EDIE_CRC32_ARMV8
+#include <arm_acle.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#if defined(__clang__)
+#define EDIE_TARGET_CRC __attribute__((target("crc")))
+#else
+#define EDIE_TARGET_CRC __attribute__((target("+crc")))
+#endif
+#endif
+
+#include <cstring>
+
+namespace {
+
+using CRC32Engine = uint32_t (*)(uint32_t, uint32_t, const unsigned char*);
+
+// --------------------------------------------------------------------------
+uint32_t CalculateBlockCRC32Bytewise(uint32_t uiCount, uint32_t uiCRC, const unsigned char* ucBuffer)
+{
+    while (uiCount-- != 0) { CalculateCharacterCRC32(uiCRC, *ucBuffer++); }
+    return uiCRC;
+}
+
+#ifdef EDIE_CRC32_PCLMUL
+// --------------------------------------------------------------------------
+// Carry-less multiplication folding, after "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction" (Intel, 2009). The constants are
+// the bit-reflected fold and Barrett reduction constants for 0xEDB88320.
+// Requires uiCount >= 64 and a multiple of 16.
+// --------------------------------------------------------------------------
+EDIE_TARGET_PCLMUL uint32_t CalculateBlockCRC32Fold(uint32_t uiCount, uint32_t uiCRC, const unsigned char* ucBuffer)
+{
+    alignas(16) static constexpr uint64_t aullK1K2[] = {0x0154442bd4, 0x01c6e41596};
+    alignas(16) static constexpr uint64_t aullK3K4[] = {0x01751997d0, 0x00ccaa009e};
+    alignas(16) static constexpr uint64_t aullK5K0[] = {0x0163cd6124, 0x0000000000};
+    alignas(16) static constexpr uint64_t aullPoly[] = {0x01db710641, 0x01f7011641};
+
+    auto LoadU = [](const unsigned char* pucData_) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pucData_)); };
+    auto LoadA = [](const uint64_t* pullData_) { return _mm_load_si128(reinterpret_cast<const __m128i*>(pullData_)); };
+
+    __m128i x1 = LoadU(ucBuffer + 0x00);
+    __m128i x2 = LoadU(ucBuffer + 0x10);
+    __m128i x3 = LoadU(ucBuffer + 0x20);
+    __m128i x4 = LoadU(ucBuffer + 0x30);
+    __m128i x0 = LoadA(aullK1K2);
+    __m128i x5;
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int32_t>(uiCRC)));
+
+    ucBuffer += 64;
+    uiCount -= 64;
+
+    // Fold four 128-bit lanes in parallel
+    while (uiCount >= 64)
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        __m128i x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        __m128i x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        __m128i x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, x0, 0x11), x5), LoadU(ucBuffer + 0x00));
+        x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, x0, 0x11), x6), LoadU(ucBuffer + 0x10));
+        x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, x0, 0x11), x7), LoadU(ucBuffer + 0x20));
+        x4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x4, x0, 0x11), x8), LoadU(ucBuffer + 0x30));
+
+        ucBuffer += 64;
+        uiCount -= 64;
+    }
+
+    // Fold the four lanes into one
+    x0 = LoadA(aullK3K4);
+    for (const __m128i& xLane : {x2, x3, x4})
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, x0, 0x11), xLane), x5);
+    }
+
+    // Fold any remaining 16 byte blocks
+    while (uiCount >= 16)
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, x0, 0x11), LoadU(ucBuffer)), x5);
+
+        ucBuffer += 16;
+        uiCount -= 16;
+    }
+
+    // Fold 128 bits down to 64 bits
+    const __m128i xMask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(aullK5K0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, xMask32), x0, 0x00), x2);
+
+    // Barrett reduction to 32 bits
+    x0 = LoadA(aullPoly);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, xMask32), x0, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, xMask32), x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+}
+
+// --------------------------------------------------------------------------
+uint32_t CalculateBlockCRC32Pclmul(uint32_t uiCount, uint32_t uiCRC, const unsigned char* ucBuffer)
+{
+    if (uiCount >= 64)
+    {
+        const uint32_t uiFoldBytes = uiCount & ~0xFU;
+        uiCRC = CalculateBlockCRC32Fold(uiFoldBytes, uiCRC, ucBuffer);
+        ucBuffer += uiFoldBytes;
+        uiCount -= uiFoldBytes;
+    }
+
+    return CalculateBlockCRC32Slice8(uiCount, uiCRC, ucBuffer);
+}
+
+// --------------------------------------------------------------------------
+bool HostSupportsPclmul()
+{
+#if defined(_MSC_VER)
+    int aiCpuInfo[4];
+    __cpuid(aiCpuInfo, 1);
+    return (aiCpuInfo[2] & (1 << 1)) != 0;
+#else
+    return __builtin_cpu_supports("pclmul");
+#endif
+}
+#endif
+
+#ifdef EDIE_CRC32_ARMV8
+// --------------------------------------------------------------------------
+// The ARMv8 CRC32 instructions implement the same reflected 0x04C11DB7
+// polynomial used here (the CRC32C variants are not used).
+// --------------------------------------------------------------------------
+EDIE_TARGET_CRC uint32_t CalculateBlockCRC32Armv8(uint32_t uiCount, uint32_t uiCRC, const unsigned char* ucBuffer)
+{
+    while (uiCount >= 8)
+    {
+        uint64_t ullWord;
+        memcpy(&ullWord, ucBuffer, sizeof(ullWord));
+        uiCRC = __crc32d(uiCRC, ullWord);
+        ucBuffer += 8;
+        uiCount -= 8;
+    }
+
+    while (uiCount-- != 0) { uiCRC = __crc32b(uiCRC, *ucBuffer++); }
+    return uiCRC;
+}
+
+// --------------------------------------------------------------------------
+bool HostSupportsArmv8Crc() { return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0; }
+#endif
+
+// --------------------------------------------------------------------------
+struct CRC32EngineSelection
+{
+    CRC32Engine pfEngine{CalculateBlockCRC32Slice8};
+    const char* pcName{"slice8"};
+
+    CRC32EngineSelection()
+    {
+#if defined(EDIE_CRC32_PCLMUL)
+        if (HostSupportsPclmul())
+        {
+            pfEngine = CalculateBlockCRC32Pclmul;
+            pcName = "pclmul";
+        }
+#elif defined(EDIE_CRC32_ARMV8)
+        if (HostSupportsArmv8Crc())
+        {
+            pfEngine = CalculateBlockCRC32Armv8;
+            pcName = "armv8";
+        }
+#endif
+        // Confirm the selected engine against the reference implementation once, so a bad
+        // feature report can only ever cost speed and never a wrong CRC.
+        constexpr unsigned char aucProbe[] = "123456789123456789123456789123456789123456789123456789123456789123456789";
+        if (pfEngine(sizeof(aucProbe) - 1, 0, aucProbe) != CalculateBlockCRC32Bytewise(sizeof(aucProbe) - 1, 0, aucProbe))
+        {
+            pfEngine = CalculateBlockCRC32Slice8;
+            pcName = "slice8";
+        }
+    }
+};
+
+// --------------------------------------------------------------------------
+const CRC32EngineSelection& GetCRC32Engine()
+{
+    static const CRC32EngineSelection stEngine;
+    return stEngine;
+}
+
+} // namespace
+
+// --------------------------------------------------------------------------
+uint32_t CalculateBlockCRC32Accelerated(uint32_t uiCount, uint32_t uiCRC, const unsigned char* ucBuffer)
+{
+    // The engines only pay off once there are a few words to work with
+    if (uiCount < 16) { return CalculateBlockCRC32Bytewise(uiCount, uiCRC, ucBuffer); }
+    return GetCRC32Engine().pfEngine(uiCount, uiCRC, ucBuffer);
+}
+
+// --------------------------------------------------------------------------
+const char* GetCRC32EngineName() { return GetCRC32Engine().pcName; }
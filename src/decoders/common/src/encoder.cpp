@@ -36,14 +36,25 @@
 
 using namespace novatel::edie;
 
-// initialize static members
-std::unordered_map<uint64_t, std::function<bool(const FieldContainer&, char**, uint32_t&, [[maybe_unused]] JsonReader*)>> EncoderBase::asciiFieldMap;
-std::unordered_map<uint64_t, std::function<bool(const FieldContainer&, char**, uint32_t&, [[maybe_unused]] JsonReader*)>> EncoderBase::jsonFieldMap;
+namespace {
+// The fixed conversions that FieldToAscii and FieldToJson print with
+constexpr FixedConversion stHexByteConversion("%02x");
+constexpr FixedConversion stUCharConversion("%hhu");
+constexpr FixedConversion stCharConversion("%hhd");
+constexpr FixedConversion stUShortConversion("%hu");
+constexpr FixedConversion stShortConversion("%hd");
+constexpr FixedConversion stUIntConversion("%u");
+constexpr FixedConversion stIntConversion("%d");
+constexpr FixedConversion stULongLongConversion("%llu");
+constexpr FixedConversion stLongLongConversion("%lld");
+} // namespace
 
 // -------------------------------------------------------------------------------------------------------
-EncoderBase::EncoderBase(JsonReader* pclJsonDb_)
+EncoderBase::EncoderBase(JsonReader* pclJsonDb_) : EncoderBase(BaseFieldMaps(), pclJsonDb_) {}
+
+// -------------------------------------------------------------------------------------------------------
+EncoderBase::EncoderBase(const FieldEncoderMaps& stFieldMaps_, JsonReader* pclJsonDb_) : pstMyFieldMaps(&stFieldMaps_)
 {
-    InitFieldMaps();
     if (pclJsonDb_ != nullptr) { LoadJsonDb(pclJsonDb_); }
 }
 
@@ -58,24 +69,33 @@ void EncoderBase::LoadJsonDb(JsonReader* pclJsonDb_)
 void EncoderBase::InitEnumDefns() {}
 
 // -------------------------------------------------------------------------------------------------------
-void EncoderBase::InitFieldMaps()
+const EncoderBase::FieldEncoderMaps& EncoderBase::BaseFieldMaps()
 {
-    asciiFieldMap.clear();
-    jsonFieldMap.clear();
+    // A static local is initialized exactly once, even when encoders are constructed on several threads
+    static const FieldEncoderMaps stFieldMaps = [] {
+        FieldEncoderMaps stMaps;
+        InitFieldMaps(stMaps.asciiFieldMap, stMaps.jsonFieldMap);
+        return stMaps;
+    }();
+    return stFieldMaps;
+}
 
+// -------------------------------------------------------------------------------------------------------
+void EncoderBase::InitFieldMaps(FieldEncoderMap& asciiFieldMap_, [[maybe_unused]] FieldEncoderMap& jsonFieldMap_)
+{
     // =========================================================
     // ASCII Field Mapping
     // =========================================================
-    asciiFieldMap[CalculateBlockCRC32("%UB")] = BasicMapEntry<uint8_t>("%u");
-    asciiFieldMap[CalculateBlockCRC32("%B")] = BasicMapEntry<int8_t>("%d");
-    asciiFieldMap[CalculateBlockCRC32("%XB")] = BasicMapEntry<uint8_t>("%02x");
+    asciiFieldMap_[CalculateBlockCRC32("%UB")] = BasicMapEntry<uint8_t>("%u");
+    asciiFieldMap_[CalculateBlockCRC32("%B")] = BasicMapEntry<int8_t>("%d");
+    asciiFieldMap_[CalculateBlockCRC32("%XB")] = BasicMapEntry<uint8_t>("%02x");
 
     // =========================================================
     // Json Field Mapping
     // =========================================================
-    asciiFieldMap[CalculateBlockCRC32("%UB")] = BasicMapEntry<uint8_t>("%u");
-    asciiFieldMap[CalculateBlockCRC32("%B")] = BasicMapEntry<int8_t>("%d");
-    asciiFieldMap[CalculateBlockCRC32("%XB")] = BasicMapEntry<uint8_t>("%02x");
+    asciiFieldMap_[CalculateBlockCRC32("%UB")] = BasicMapEntry<uint8_t>("%u");
+    asciiFieldMap_[CalculateBlockCRC32("%B")] = BasicMapEntry<int8_t>("%d");
+    asciiFieldMap_[CalculateBlockCRC32("%XB")] = BasicMapEntry<uint8_t>("%02x");
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -88,8 +108,8 @@ void EncoderBase::SetLoggerLevel(spdlog::level::level_enum eLevel_) { pclMyLogge
 void EncoderBase::ShutdownLogger() { Logger::Shutdown(); }
 
 // -------------------------------------------------------------------------------------------------------
-template <bool FLATTEN>
-bool EncoderBase::EncodeBinaryBody(const IntermediateMessage& stInterMessage_, unsigned char** ppcOutBuf_, uint32_t& uiBytesLeft_)
+template <bool FLATTEN, typename T>
+bool EncoderBase::EncodeBinaryBody(const T& stInterMessage_, unsigned char** ppcOutBuf_, uint32_t& uiBytesLeft_)
 {
     unsigned char* pucTempStart;
 
@@ -102,14 +122,14 @@ bool EncoderBase::EncodeBinaryBody(const IntermediateMessage& stInterMessage_, u
             return false;
         }
 
-        if (std::holds_alternative<std::vector<FieldContainer>>(field.field_value))
+        if (IsArrayField(field))
         {
-            const auto& vFCCurrentVectorField = std::get<std::vector<FieldContainer>>(field.field_value);
+            const auto& vFCCurrentVectorField = GetArrayField(field);
 
             // FIELD_ARRAY types contain several classes and so will use a recursive call
             if (field.field_def->type == FIELD_TYPE::FIELD_ARRAY)
             {
-                const auto& vCurrentFieldArrayField = std::get<std::vector<FieldContainer>>(field.field_value);
+                const auto& vCurrentFieldArrayField = vFCCurrentVectorField;
 
                 uint32_t uiFieldCount = static_cast<uint32_t>(vCurrentFieldArrayField.size());
                 if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, &uiFieldCount)) { return false; }
@@ -118,7 +138,7 @@ bool EncoderBase::EncodeBinaryBody(const IntermediateMessage& stInterMessage_, u
 
                 for (const auto& clFieldArray : vCurrentFieldArrayField)
                 {
-                    if (!EncodeBinaryBody<FLATTEN>(std::get<std::vector<FieldContainer>>(clFieldArray.field_value), ppcOutBuf_, uiBytesLeft_))
+                    if (!EncodeBinaryBody<FLATTEN>(GetArrayField(clFieldArray), ppcOutBuf_, uiBytesLeft_))
                     {
                         return false;
                     }
@@ -150,7 +170,7 @@ bool EncoderBase::EncodeBinaryBody(const IntermediateMessage& stInterMessage_, u
                 // This is an array of simple elements
                 for (const auto& arrayField : vFCCurrentVectorField)
                 {
-                    if (!FieldToBinary(arrayField, ppcOutBuf_, uiBytesLeft_)) { return false; }
+                    if (!FieldToBinary(AsFieldContainer(arrayField), ppcOutBuf_, uiBytesLeft_)) { return false; }
                 }
 
                 // For a flattened version of the log, fill in the remaining fields with 0x00.
@@ -172,7 +192,7 @@ bool EncoderBase::EncodeBinaryBody(const IntermediateMessage& stInterMessage_, u
             switch (field.field_def->type)
             {
             case FIELD_TYPE::STRING: { // STRING types can be handled all at once because they are a single element and have a null terminator
-                const char* szString = std::get<std::string>(field.field_value).c_str();
+                const char* szString = GetFieldString(field);
                 if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, szString)) { return false; }
 
                 // For a flattened version of the log, fill in the remaining characters with 0x00.
@@ -191,23 +211,29 @@ bool EncoderBase::EncodeBinaryBody(const IntermediateMessage& stInterMessage_, u
             case FIELD_TYPE::ENUM:
                 switch (field.field_def->dataType.length)
                 {
-                case 2:
-                    if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, &std::get<int16_t>(field.field_value))) { return false; }
+                case 2: {
+                    const auto sValue = GetFieldValue<int16_t>(field);
+                    if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, &sValue)) { return false; }
                     break;
-                case 4:
-                    if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, &std::get<int32_t>(field.field_value))) { return false; }
+                }
+                case 4: {
+                    const auto iValue = GetFieldValue<int32_t>(field);
+                    if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, &iValue)) { return false; }
                     break;
+                }
                 default: return false;
                 }
                 break;
-            case FIELD_TYPE::RESPONSE_ID:
-                if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, &std::get<int32_t>(field.field_value))) { return false; }
+            case FIELD_TYPE::RESPONSE_ID: {
+                const auto iValue = GetFieldValue<int32_t>(field);
+                if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, &iValue)) { return false; }
                 break;
+            }
             case FIELD_TYPE::RESPONSE_STR:
-                if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, std::get<std::string>(field.field_value).c_str())) { return false; }
+                if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, GetFieldString(field))) { return false; }
                 break;
             case FIELD_TYPE::SIMPLE:
-                if (!FieldToBinary(field, ppcOutBuf_, uiBytesLeft_)) { return false; }
+                if (!FieldToBinary(AsFieldContainer(field), ppcOutBuf_, uiBytesLeft_)) { return false; }
                 break;
             default: return false;
             }
@@ -219,6 +245,8 @@ bool EncoderBase::EncodeBinaryBody(const IntermediateMessage& stInterMessage_, u
 // explicit template instantiations
 template bool EncoderBase::EncodeBinaryBody<true>(const IntermediateMessage&, unsigned char**, uint32_t&);
 template bool EncoderBase::EncodeBinaryBody<false>(const IntermediateMessage&, unsigned char**, uint32_t&);
+template bool EncoderBase::EncodeBinaryBody<true>(const FlatFieldRange&, unsigned char**, uint32_t&);
+template bool EncoderBase::EncodeBinaryBody<false>(const FlatFieldRange&, unsigned char**, uint32_t&);
 
 // -------------------------------------------------------------------------------------------------------
 bool EncoderBase::FieldToBinary(const FieldContainer& fc_, unsigned char** ppcOutBuf_, uint32_t& uiBytesLeft_)
@@ -245,9 +273,8 @@ bool EncoderBase::FieldToBinary(const FieldContainer& fc_, unsigned char** ppcOu
 }
 
 // -------------------------------------------------------------------------------------------------------
-template <bool ABBREVIATED>
-bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermediateFormat_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                  uint32_t uiIndentationLevel)
+template <bool ABBREVIATED, typename T>
+bool EncoderBase::EncodeAsciiBody(const T& vIntermediateFormat_, char** ppcOutBuf_, uint32_t& uiBytesLeft_, uint32_t uiIndentationLevel)
 {
     // cant figure out how to do this constexpr since derived classes need to change values
     char separator = ABBREVIATED ? separatorAbbASCII() : separatorASCII();
@@ -272,16 +299,16 @@ bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermedia
             }
         }
 
-        if (std::holds_alternative<std::vector<FieldContainer>>(field.field_value))
+        if (IsArrayField(field))
         {
-            const auto& vFCCurrentVectorField = std::get<std::vector<FieldContainer>>(field.field_value);
+            const auto& vFCCurrentVectorField = GetArrayField(field);
 
             // FIELD_ARRAY types contain several classes and so will use a recursive call
             if (field.field_def->type == FIELD_TYPE::FIELD_ARRAY)
             {
                 if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%d%c", vFCCurrentVectorField.size(), separator)) { return false; }
 
-                const auto& vCurrentFieldArrayField = std::get<std::vector<FieldContainer>>(field.field_value);
+                const auto& vCurrentFieldArrayField = vFCCurrentVectorField;
 
                 if constexpr (ABBREVIATED)
                 {
@@ -298,8 +325,7 @@ bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermedia
                         {
                             if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "\r\n")) { return false; }
 
-                            if (!EncodeAsciiBody<true>(std::get<std::vector<FieldContainer>>(clFieldArray.field_value), ppcOutBuf_, uiBytesLeft_,
-                                                       uiIndentationLevel + 1))
+                            if (!EncodeAsciiBody<true>(GetArrayField(clFieldArray), ppcOutBuf_, uiBytesLeft_, uiIndentationLevel + 1))
                             {
                                 return false;
                             }
@@ -311,7 +337,7 @@ bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermedia
                 {
                     for (const auto& clFieldArray : vCurrentFieldArrayField)
                     {
-                        if (!EncodeAsciiBody<false>(std::get<std::vector<FieldContainer>>(clFieldArray.field_value), ppcOutBuf_, uiBytesLeft_))
+                        if (!EncodeAsciiBody<false>(GetArrayField(clFieldArray), ppcOutBuf_, uiBytesLeft_))
                         {
                             return false;
                         }
@@ -338,18 +364,18 @@ bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermedia
                     // If we are printing a string, don't print the null terminator or any padding bytes
                     if (bPrintAsString)
                     {
-                        if ((std::holds_alternative<int8_t>(arrayField.field_value) && std::get<int8_t>(arrayField.field_value) == '\0') ||
-                            (std::holds_alternative<uint8_t>(arrayField.field_value) && std::get<uint8_t>(arrayField.field_value) == '\0'))
+                        if ((HoldsFieldValue<int8_t>(arrayField) && GetFieldValue<int8_t>(arrayField) == '\0') ||
+                            (HoldsFieldValue<uint8_t>(arrayField) && GetFieldValue<uint8_t>(arrayField) == '\0'))
                         {
                             break;
                         }
                     }
 
-                    if (!FieldToAscii(arrayField, ppcOutBuf_, uiBytesLeft_)) { return false; }
+                    if (!FieldToAscii(AsFieldContainer(arrayField), ppcOutBuf_, uiBytesLeft_)) { return false; }
 
                     if (bIsCommaSeparated)
                     {
-                        if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%c", separator)) { return false; }
+                        if (!CopyToBuffer(reinterpret_cast<unsigned char**>(ppcOutBuf_), uiBytesLeft_, &separator)) { return false; }
                     }
                 }
                 // Quoted elements need a trailing comma
@@ -360,7 +386,7 @@ bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermedia
                 // Non-quoted, non-internally-separated elements also need a trailing comma
                 else if (!bIsCommaSeparated)
                 {
-                    if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%c", separator)) { return false; }
+                    if (!CopyToBuffer(reinterpret_cast<unsigned char**>(ppcOutBuf_), uiBytesLeft_, &separator)) { return false; }
                 }
             }
         }
@@ -369,7 +395,7 @@ bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermedia
             switch (field.field_def->type)
             {
             case FIELD_TYPE::STRING: // STRING types can be handled all at once because they are a single element and have a null terminator
-                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "\"%s\"%c", std::get<std::string>(field.field_value).c_str(), separator))
+                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "\"%s\"%c", GetFieldString(field), separator))
                 {
                     return false;
                 }
@@ -379,7 +405,7 @@ bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermedia
                 if (enumField->length == 2)
                 {
                     if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%s%c",
-                                       GetEnumString(enumField->enumDef, std::get<int16_t>(field.field_value)).c_str(), separator))
+                                       GetEnumString(enumField->enumDef, GetFieldValue<int16_t>(field)).c_str(), separator))
                     {
                         return false;
                     }
@@ -387,7 +413,7 @@ bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermedia
                 else
                 {
                     if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%s%c",
-                                       GetEnumString(enumField->enumDef, std::get<int32_t>(field.field_value)).c_str(), separator))
+                                       GetEnumString(enumField->enumDef, GetFieldValue<int32_t>(field)).c_str(), separator))
                     {
                         return false;
                     }
@@ -396,10 +422,13 @@ bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermedia
             }
             case FIELD_TYPE::RESPONSE_ID: break; // Do nothing, ascii logs don't output this field
             case FIELD_TYPE::RESPONSE_STR:
-                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%s%c", std::get<std::string>(field.field_value).c_str(), separator)) { return false; }
+                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%s%c", GetFieldString(field), separator)) { return false; }
                 break;
             case FIELD_TYPE::SIMPLE:
-                if (!FieldToAscii(field, ppcOutBuf_, uiBytesLeft_) || !PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%c", separator)) { return false; }
+                if (!FieldToAscii(AsFieldContainer(field), ppcOutBuf_, uiBytesLeft_) || !CopyToBuffer(reinterpret_cast<unsigned char**>(ppcOutBuf_), uiBytesLeft_, &separator))
+                {
+                    return false;
+                }
                 break;
             default: return false;
             }
@@ -409,52 +438,53 @@ bool EncoderBase::EncodeAsciiBody(const std::vector<FieldContainer>& vIntermedia
 }
 
 // explicit template instantiations
-template bool EncoderBase::EncodeAsciiBody<true>(const std::vector<FieldContainer>&, char**, uint32_t& uiBytesLeft_, uint32_t);
-template bool EncoderBase::EncodeAsciiBody<false>(const std::vector<FieldContainer>&, char**, uint32_t& uiBytesLeft_, uint32_t);
+template bool EncoderBase::EncodeAsciiBody<true>(const IntermediateMessage&, char**, uint32_t& uiBytesLeft_, uint32_t);
+template bool EncoderBase::EncodeAsciiBody<false>(const IntermediateMessage&, char**, uint32_t& uiBytesLeft_, uint32_t);
+template bool EncoderBase::EncodeAsciiBody<true>(const FlatFieldRange&, char**, uint32_t& uiBytesLeft_, uint32_t);
+template bool EncoderBase::EncodeAsciiBody<false>(const FlatFieldRange&, char**, uint32_t& uiBytesLeft_, uint32_t);
 
 // -------------------------------------------------------------------------------------------------------
 bool EncoderBase::FieldToAscii(const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_)
 {
-    auto it = asciiFieldMap.find(fc_.field_def->conversionHash);
-    if (it != asciiFieldMap.end()) { return it->second(fc_, ppcOutBuf_, uiBytesLeft_, pclMyMsgDb); }
-    const char* pcConvertString = fc_.field_def->conversion.c_str();
+    auto it = pstMyFieldMaps->asciiFieldMap.find(fc_.field_def->conversionHash);
+    if (it != pstMyFieldMaps->asciiFieldMap.end()) { return it->second(fc_, ppcOutBuf_, uiBytesLeft_, pclMyMsgDb); }
 
     switch (fc_.field_def->dataType.name)
     {
     case DATA_TYPE::BOOL: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, std::get<bool>(fc_.field_value) ? "TRUE" : "FALSE");
-    case DATA_TYPE::HEXBYTE: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%02x", std::get<uint8_t>(fc_.field_value));
-    case DATA_TYPE::UCHAR: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<uint8_t>(fc_.field_value));
-    case DATA_TYPE::CHAR: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<int8_t>(fc_.field_value));
-    case DATA_TYPE::USHORT: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<uint16_t>(fc_.field_value));
-    case DATA_TYPE::SHORT: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<int16_t>(fc_.field_value));
-    case DATA_TYPE::UINT: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<uint32_t>(fc_.field_value));
-    case DATA_TYPE::INT: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<int32_t>(fc_.field_value));
-    case DATA_TYPE::ULONG: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<uint32_t>(fc_.field_value));
-    case DATA_TYPE::ULONGLONG: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<uint64_t>(fc_.field_value));
-    case DATA_TYPE::LONG: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<int32_t>(fc_.field_value));
-    case DATA_TYPE::LONGLONG: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<int64_t>(fc_.field_value));
-    case DATA_TYPE::FLOAT: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<float>(fc_.field_value));
-    case DATA_TYPE::DOUBLE: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<double>(fc_.field_value));
+    case DATA_TYPE::HEXBYTE: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stHexByteConversion, std::get<uint8_t>(fc_.field_value));
+    case DATA_TYPE::UCHAR: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<uint8_t>(fc_.field_value));
+    case DATA_TYPE::CHAR: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<int8_t>(fc_.field_value));
+    case DATA_TYPE::USHORT: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<uint16_t>(fc_.field_value));
+    case DATA_TYPE::SHORT: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<int16_t>(fc_.field_value));
+    case DATA_TYPE::UINT: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<uint32_t>(fc_.field_value));
+    case DATA_TYPE::INT: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<int32_t>(fc_.field_value));
+    case DATA_TYPE::ULONG: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<uint32_t>(fc_.field_value));
+    case DATA_TYPE::ULONGLONG: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<uint64_t>(fc_.field_value));
+    case DATA_TYPE::LONG: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<int32_t>(fc_.field_value));
+    case DATA_TYPE::LONGLONG: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<int64_t>(fc_.field_value));
+    case DATA_TYPE::FLOAT: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<float>(fc_.field_value));
+    case DATA_TYPE::DOUBLE: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<double>(fc_.field_value));
     default: SPDLOG_LOGGER_CRITICAL(pclMyLogger, "FieldToAscii(): unknown type."); throw std::runtime_error("FieldToAscii(): unknown type.");
     }
 }
 
 // -------------------------------------------------------------------------------------------------------
-bool EncoderBase::EncodeJsonBody(const std::vector<FieldContainer>& vIntermediateFormat_, char** ppcOutBuf_, uint32_t& uiBytesLeft_)
+template <typename T> bool EncoderBase::EncodeJsonBody(const T& vIntermediateFormat_, char** ppcOutBuf_, uint32_t& uiBytesLeft_)
 {
     if (!CopyToBuffer(reinterpret_cast<unsigned char**>(ppcOutBuf_), uiBytesLeft_, "{")) { return false; }
 
     for (const auto& field : vIntermediateFormat_)
     {
-        if (std::holds_alternative<std::vector<FieldContainer>>(field.field_value))
+        if (IsArrayField(field))
         {
-            const auto& vFCCurrentVectorField = std::get<std::vector<FieldContainer>>(field.field_value);
+            const auto& vFCCurrentVectorField = GetArrayField(field);
 
             // FIELD_ARRAY types contain several classes and so will use a recursive call
             if (field.field_def->type == FIELD_TYPE::FIELD_ARRAY)
             {
-                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s": [)", field.field_def->name.c_str())) { return false; }
-                const auto& vCurrentFieldArrayField = std::get<std::vector<FieldContainer>>(field.field_value);
+                if (!PrintJsonKeyToBuffer(ppcOutBuf_, uiBytesLeft_, field.field_def->name, "[")) { return false; }
+                const auto& vCurrentFieldArrayField = vFCCurrentVectorField;
                 if (vCurrentFieldArrayField.empty())
                 {
                     if (!CopyToBuffer(reinterpret_cast<unsigned char**>(ppcOutBuf_), uiBytesLeft_, "],")) { return false; }
@@ -463,7 +493,7 @@ bool EncoderBase::EncodeJsonBody(const std::vector<FieldContainer>& vIntermediat
                 {
                     for (const auto& clFieldArray : vCurrentFieldArrayField)
                     {
-                        if (!EncodeJsonBody(std::get<std::vector<FieldContainer>>(clFieldArray.field_value), ppcOutBuf_, uiBytesLeft_))
+                        if (!EncodeJsonBody(GetArrayField(clFieldArray), ppcOutBuf_, uiBytesLeft_))
                         {
                             return false;
                         }
@@ -479,12 +509,12 @@ bool EncoderBase::EncodeJsonBody(const std::vector<FieldContainer>& vIntermediat
 
                 if (bPrintAsString)
                 {
-                    if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s": ")", field.field_def->name.c_str())) { return false; }
+                    if (!PrintJsonKeyToBuffer(ppcOutBuf_, uiBytesLeft_, field.field_def->name, "\"")) { return false; }
                 }
                 else
                 {
                     // This is an array of simple elements
-                    if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s": [)", field.field_def->name.c_str())) { return false; }
+                    if (!PrintJsonKeyToBuffer(ppcOutBuf_, uiBytesLeft_, field.field_def->name, "[")) { return false; }
                     if (vFCCurrentVectorField.empty())
                     {
                         if (!CopyToBuffer(reinterpret_cast<unsigned char**>(ppcOutBuf_), uiBytesLeft_, "]")) { return false; }
@@ -496,11 +526,11 @@ bool EncoderBase::EncodeJsonBody(const std::vector<FieldContainer>& vIntermediat
                     // If we are printing a string, don't print the null terminator or any padding bytes
                     if (bPrintAsString)
                     {
-                        if (std::holds_alternative<int8_t>(arrayField.field_value) && std::get<int8_t>(arrayField.field_value) == '\0') { break; }
-                        if (std::holds_alternative<uint8_t>(arrayField.field_value) && std::get<uint8_t>(arrayField.field_value) == '\0') { break; }
+                        if (HoldsFieldValue<int8_t>(arrayField) && GetFieldValue<int8_t>(arrayField) == '\0') { break; }
+                        if (HoldsFieldValue<uint8_t>(arrayField) && GetFieldValue<uint8_t>(arrayField) == '\0') { break; }
                     }
 
-                    if (!FieldToJson(arrayField, ppcOutBuf_, uiBytesLeft_)) { return false; }
+                    if (!FieldToJson(AsFieldContainer(arrayField), ppcOutBuf_, uiBytesLeft_)) { return false; }
                     if (!bPrintAsString && !CopyToBuffer(reinterpret_cast<unsigned char**>(ppcOutBuf_), uiBytesLeft_, ",")) { return false; }
                 }
 
@@ -522,8 +552,7 @@ bool EncoderBase::EncodeJsonBody(const std::vector<FieldContainer>& vIntermediat
             switch (field.field_def->type)
             {
             case FIELD_TYPE::STRING: // STRING types can be handled all at once because they are a single element and have a null terminator
-                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s": "%s",)", field.field_def->name.c_str(),
-                                   std::get<std::string>(field.field_value).c_str()))
+                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s": "%s",)", field.field_def->name.c_str(), GetFieldString(field)))
                 {
                     return false;
                 }
@@ -531,27 +560,26 @@ bool EncoderBase::EncodeJsonBody(const std::vector<FieldContainer>& vIntermediat
             case FIELD_TYPE::ENUM:
                 if (!PrintToBuffer(
                         ppcOutBuf_, uiBytesLeft_, R"("%s": "%s",)", field.field_def->name.c_str(),
-                        GetEnumString(dynamic_cast<const EnumField*>(field.field_def)->enumDef, std::get<int32_t>(field.field_value)).c_str()))
+                        GetEnumString(dynamic_cast<const EnumField*>(field.field_def)->enumDef, GetFieldValue<int32_t>(field)).c_str()))
                 {
                     return false;
                 }
                 break;
             case FIELD_TYPE::RESPONSE_ID:
-                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s": %d,)", field.field_def->name.c_str(), std::get<int32_t>(field.field_value)))
+                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s": %d,)", field.field_def->name.c_str(), GetFieldValue<int32_t>(field)))
                 {
                     return false;
                 }
                 break;
             case FIELD_TYPE::RESPONSE_STR:
-                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s": "%s",)", field.field_def->name.c_str(),
-                                   std::get<std::string>(field.field_value).c_str()))
+                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s": "%s",)", field.field_def->name.c_str(), GetFieldString(field)))
                 {
                     return false;
                 }
                 break;
             case FIELD_TYPE::SIMPLE:
-                if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s": )", field.field_def->name.c_str()) ||
-                    !FieldToJson(field, ppcOutBuf_, uiBytesLeft_) || !CopyToBuffer(reinterpret_cast<unsigned char**>(ppcOutBuf_), uiBytesLeft_, ","))
+                if (!PrintJsonKeyToBuffer(ppcOutBuf_, uiBytesLeft_, field.field_def->name) ||
+                    !FieldToJson(AsFieldContainer(field), ppcOutBuf_, uiBytesLeft_) || !CopyToBuffer(reinterpret_cast<unsigned char**>(ppcOutBuf_), uiBytesLeft_, ","))
                 {
                     return false;
                 }
@@ -564,29 +592,32 @@ bool EncoderBase::EncodeJsonBody(const std::vector<FieldContainer>& vIntermediat
     return true;
 }
 
+// explicit template instantiations
+template bool EncoderBase::EncodeJsonBody(const IntermediateMessage&, char**, uint32_t&);
+template bool EncoderBase::EncodeJsonBody(const FlatFieldRange&, char**, uint32_t&);
+
 // -------------------------------------------------------------------------------------------------------
 bool EncoderBase::FieldToJson(const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_)
 {
-    auto it = jsonFieldMap.find(fc_.field_def->conversionHash);
-    if (it != jsonFieldMap.end()) { return it->second(fc_, ppcOutBuf_, uiBytesLeft_, pclMyMsgDb); }
-    const char* pcConvertString = fc_.field_def->conversion.c_str();
+    auto it = pstMyFieldMaps->jsonFieldMap.find(fc_.field_def->conversionHash);
+    if (it != pstMyFieldMaps->jsonFieldMap.end()) { return it->second(fc_, ppcOutBuf_, uiBytesLeft_, pclMyMsgDb); }
 
     switch (fc_.field_def->dataType.name)
     {
     case DATA_TYPE::BOOL: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, std::get<bool>(fc_.field_value) ? "true" : "false");
-    case DATA_TYPE::HEXBYTE: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%hhu", std::get<uint8_t>(fc_.field_value));
-    case DATA_TYPE::UCHAR: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%hhu", std::get<uint8_t>(fc_.field_value));
-    case DATA_TYPE::CHAR: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%hhd", std::get<int8_t>(fc_.field_value));
-    case DATA_TYPE::USHORT: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%hu", std::get<uint16_t>(fc_.field_value));
-    case DATA_TYPE::SHORT: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%hd", std::get<int16_t>(fc_.field_value));
-    case DATA_TYPE::UINT: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%u", std::get<uint32_t>(fc_.field_value));
-    case DATA_TYPE::INT: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%d", std::get<int32_t>(fc_.field_value));
-    case DATA_TYPE::ULONG: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%u", std::get<uint32_t>(fc_.field_value));
-    case DATA_TYPE::LONG: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%d", std::get<int32_t>(fc_.field_value));
-    case DATA_TYPE::ULONGLONG: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%llu", std::get<uint64_t>(fc_.field_value));
-    case DATA_TYPE::LONGLONG: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%lld", std::get<int64_t>(fc_.field_value));
-    case DATA_TYPE::FLOAT: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<float>(fc_.field_value));
-    case DATA_TYPE::DOUBLE: return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, pcConvertString, std::get<double>(fc_.field_value));
+    case DATA_TYPE::HEXBYTE: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stUCharConversion, std::get<uint8_t>(fc_.field_value));
+    case DATA_TYPE::UCHAR: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stUCharConversion, std::get<uint8_t>(fc_.field_value));
+    case DATA_TYPE::CHAR: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stCharConversion, std::get<int8_t>(fc_.field_value));
+    case DATA_TYPE::USHORT: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stUShortConversion, std::get<uint16_t>(fc_.field_value));
+    case DATA_TYPE::SHORT: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stShortConversion, std::get<int16_t>(fc_.field_value));
+    case DATA_TYPE::UINT: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stUIntConversion, std::get<uint32_t>(fc_.field_value));
+    case DATA_TYPE::INT: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stIntConversion, std::get<int32_t>(fc_.field_value));
+    case DATA_TYPE::ULONG: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stUIntConversion, std::get<uint32_t>(fc_.field_value));
+    case DATA_TYPE::LONG: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stIntConversion, std::get<int32_t>(fc_.field_value));
+    case DATA_TYPE::ULONGLONG: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stULongLongConversion, std::get<uint64_t>(fc_.field_value));
+    case DATA_TYPE::LONGLONG: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stLongLongConversion, std::get<int64_t>(fc_.field_value));
+    case DATA_TYPE::FLOAT: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<float>(fc_.field_value));
+    case DATA_TYPE::DOUBLE: return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def, std::get<double>(fc_.field_value));
     default: SPDLOG_LOGGER_CRITICAL(pclMyLogger, "FieldToJson(): unknown type."); throw std::runtime_error("FieldToJson(): unknown type.");
     }
 }
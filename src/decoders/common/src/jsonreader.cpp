@@ -32,6 +32,13 @@
 //-----------------------------------------------------------------------
 #include "jsonreader.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <random>
+#include <type_traits>
+
 namespace novatel::edie {
 
 //-----------------------------------------------------------------------
@@ -127,12 +134,96 @@ void from_json(const json& j, MessageDefinition& md)
     }
 }
 
+//-----------------------------------------------------------------------
+void EnumDefinition::BuildIndexes()
+{
+    constexpr uint32_t uiNoEntry = UINT32_MAX;
+
+    vValueIndex.clear();
+    vNameIndex.resize(enumerators.size());
+    vDescIndex.resize(enumerators.size());
+    for (uint32_t i = 0; i < enumerators.size(); ++i) { vNameIndex[i] = vDescIndex[i] = i; }
+
+    // Stable sorts keep the first of any duplicate entries first, matching a linear scan.
+    std::stable_sort(vNameIndex.begin(), vNameIndex.end(), [this](uint32_t a, uint32_t b) { return enumerators[a].name < enumerators[b].name; });
+    std::stable_sort(vDescIndex.begin(), vDescIndex.end(),
+                     [this](uint32_t a, uint32_t b) { return enumerators[a].description < enumerators[b].description; });
+
+    uint32_t uiMaxValue = 0;
+    for (const auto& e : enumerators) { uiMaxValue = std::max(uiMaxValue, e.value); }
+
+    // Most enumerations are small and contiguous, so index them directly by value.
+    bDenseValues = !enumerators.empty() && uiMaxValue < 4 * enumerators.size() + 64;
+    if (bDenseValues)
+    {
+        vValueIndex.assign(uiMaxValue + 1, uiNoEntry);
+        for (uint32_t i = 0; i < enumerators.size(); ++i)
+        {
+            if (vValueIndex[enumerators[i].value] == uiNoEntry) { vValueIndex[enumerators[i].value] = i; }
+        }
+    }
+    else
+    {
+        vValueIndex.resize(enumerators.size());
+        for (uint32_t i = 0; i < enumerators.size(); ++i) { vValueIndex[i] = i; }
+        std::stable_sort(vValueIndex.begin(), vValueIndex.end(), [this](uint32_t a, uint32_t b) { return enumerators[a].value < enumerators[b].value; });
+    }
+}
+
+//-----------------------------------------------------------------------
+const EnumDataType* EnumDefinition::FindValue(uint32_t uiValue_) const
+{
+    if (!HasIndexes())
+    {
+        auto it = std::find_if(enumerators.begin(), enumerators.end(), [uiValue_](const EnumDataType& e) { return e.value == uiValue_; });
+        return it != enumerators.end() ? &*it : nullptr;
+    }
+
+    if (bDenseValues)
+    {
+        return uiValue_ < vValueIndex.size() && vValueIndex[uiValue_] != UINT32_MAX ? &enumerators[vValueIndex[uiValue_]] : nullptr;
+    }
+
+    auto it = std::lower_bound(vValueIndex.begin(), vValueIndex.end(), uiValue_, [this](uint32_t i, uint32_t v) { return enumerators[i].value < v; });
+    return it != vValueIndex.end() && enumerators[*it].value == uiValue_ ? &enumerators[*it] : nullptr;
+}
+
+//-----------------------------------------------------------------------
+const EnumDataType* EnumDefinition::FindName(std::string_view svName_) const
+{
+    if (!HasIndexes())
+    {
+        auto it = std::find_if(enumerators.begin(), enumerators.end(), [svName_](const EnumDataType& e) { return e.name == svName_; });
+        return it != enumerators.end() ? &*it : nullptr;
+    }
+
+    auto it = std::lower_bound(vNameIndex.begin(), vNameIndex.end(), svName_,
+                               [this](uint32_t i, std::string_view sv) { return std::string_view(enumerators[i].name) < sv; });
+    return it != vNameIndex.end() && enumerators[*it].name == svName_ ? &enumerators[*it] : nullptr;
+}
+
+//-----------------------------------------------------------------------
+const EnumDataType* EnumDefinition::FindDescription(std::string_view svDescription_) const
+{
+    if (!HasIndexes())
+    {
+        auto it = std::find_if(enumerators.begin(), enumerators.end(),
+                               [svDescription_](const EnumDataType& e) { return e.description == svDescription_; });
+        return it != enumerators.end() ? &*it : nullptr;
+    }
+
+    auto it = std::lower_bound(vDescIndex.begin(), vDescIndex.end(), svDescription_,
+                               [this](uint32_t i, std::string_view sv) { return std::string_view(enumerators[i].description) < sv; });
+    return it != vDescIndex.end() && enumerators[*it].description == svDescription_ ? &enumerators[*it] : nullptr;
+}
+
 //-----------------------------------------------------------------------
 void from_json(const json& j, EnumDefinition& ed)
 {
     ed._id = j.at("_id");
     ed.name = j.at("name");
     parse_enumerators(j.at("enumerators"), ed.enumerators);
+    ed.BuildIndexes();
 }
 
 //-----------------------------------------------------------------------
@@ -185,6 +276,390 @@ void parse_enumerators(const json& j, std::vector<novatel::edie::EnumDataType>&
     for (const auto& enumerator : j) { vEnumerators.push_back(enumerator); }
 }
 
+namespace {
+
+//-----------------------------------------------------------------------
+// The start of a cache written by JsonReader::SaveCache(). The payload that
+// follows holds the enum definitions then the message definitions, with
+// integers in host byte order and strings prefixed by their length.
+//-----------------------------------------------------------------------
+struct CacheHeader
+{
+    char acMagic[8];
+    uint32_t uiVersion;
+    uint32_t uiByteOrder;   // uiCACHE_BYTE_ORDER as stored by the host that wrote the cache
+    uint64_t ullJsonSize;   // Size of the Json file the cache was written for
+    uint32_t uiJsonCrc;     // CRC of the Json file the cache was written for
+    uint32_t uiPayloadCrc;  // CRC of the payload
+    uint64_t ullPayloadSize;
+};
+
+constexpr char acCACHE_MAGIC[8] = {'E', 'D', 'I', 'E', 'D', 'B', '\0', '\0'};
+constexpr uint32_t uiCACHE_BYTE_ORDER = 0x01020304;
+
+//-----------------------------------------------------------------------
+uint32_t BufferCrc32(const char* pcData_, size_t ullSize_)
+{
+    uint32_t uiCrc = 0;
+    const auto* pucData = reinterpret_cast<const unsigned char*>(pcData_);
+    // CalculateBlockCRC32 takes a 32-bit count
+    for (size_t ullBlock; ullSize_ > 0; ullSize_ -= ullBlock, pucData += ullBlock)
+    {
+        ullBlock = std::min<size_t>(ullSize_, UINT32_MAX);
+        uiCrc = CalculateBlockCRC32(static_cast<uint32_t>(ullBlock), uiCrc, pucData);
+    }
+    return uiCrc;
+}
+
+//-----------------------------------------------------------------------
+std::vector<char> ReadWholeFile(const std::filesystem::path& clPath_)
+{
+    std::ifstream clFile(clPath_, std::ios::binary | std::ios::ate);
+    if (!clFile) { throw std::runtime_error("Could not open " + clPath_.string()); }
+
+    std::vector<char> vData(static_cast<size_t>(clFile.tellg()));
+    clFile.seekg(0);
+    if (!clFile.read(vData.data(), static_cast<std::streamsize>(vData.size()))) { throw std::runtime_error("Could not read " + clPath_.string()); }
+    return vData;
+}
+
+//-----------------------------------------------------------------------
+class CacheWriter
+{
+    std::vector<char>& vMyData;
+
+  public:
+    explicit CacheWriter(std::vector<char>& vData_) : vMyData(vData_) {}
+
+    template <typename T> void Write(T tValue_)
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+        const auto* pcValue = reinterpret_cast<const char*>(&tValue_);
+        vMyData.insert(vMyData.end(), pcValue, pcValue + sizeof(T));
+    }
+
+    void Write(const std::string& strValue_)
+    {
+        Write(static_cast<uint32_t>(strValue_.size()));
+        vMyData.insert(vMyData.end(), strValue_.begin(), strValue_.end());
+    }
+
+    void Write(const std::vector<uint32_t>& vValues_)
+    {
+        Write(static_cast<uint32_t>(vValues_.size()));
+        const auto* pcValues = reinterpret_cast<const char*>(vValues_.data());
+        vMyData.insert(vMyData.end(), pcValues, pcValues + vValues_.size() * sizeof(uint32_t));
+    }
+
+    void Write(const BaseField& stField_)
+    {
+        Write(stField_.type);
+        Write(stField_.name);
+        Write(stField_.description);
+        Write(stField_.conversion);
+
+        Write(stField_.dataType.name);
+        Write(stField_.dataType.length);
+        Write(stField_.dataType.description);
+        Write(static_cast<uint32_t>(stField_.dataType.enums.size()));
+        for (const auto& [iValue, stEnum] : stField_.dataType.enums)
+        {
+            Write(iValue);
+            Write(stEnum);
+        }
+
+        switch (stField_.type)
+        {
+        case FIELD_TYPE::SIMPLE: break;
+        case FIELD_TYPE::ENUM:
+            Write(static_cast<const EnumField&>(stField_).enumID);
+            Write(static_cast<const EnumField&>(stField_).length);
+            break;
+        case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
+        case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: [[fallthrough]];
+        case FIELD_TYPE::STRING: Write(static_cast<const ArrayField&>(stField_).arrayLength); break;
+        case FIELD_TYPE::FIELD_ARRAY:
+            Write(static_cast<const FieldArrayField&>(stField_).arrayLength);
+            Write(static_cast<const FieldArrayField&>(stField_).fieldSize);
+            Write(static_cast<const FieldArrayField&>(stField_).fields);
+            break;
+        default: throw std::runtime_error("Can't cache field \"" + stField_.name + "\" of this type");
+        }
+    }
+
+    void Write(const std::vector<BaseField*>& vFields_)
+    {
+        Write(static_cast<uint32_t>(vFields_.size()));
+        for (const BaseField* pstField : vFields_) { Write(*pstField); }
+    }
+
+    void Write(const EnumDataType& stEnum_)
+    {
+        Write(stEnum_.value);
+        Write(stEnum_.name);
+        Write(stEnum_.description);
+    }
+
+    void Write(const EnumDefinition& stEnumDef_)
+    {
+        Write(stEnumDef_._id);
+        Write(stEnumDef_.name);
+        Write(static_cast<uint32_t>(stEnumDef_.enumerators.size()));
+        for (const EnumDataType& stEnum : stEnumDef_.enumerators) { Write(stEnum); }
+        // The lookup indexes are stored so that loading doesn't have to sort
+        Write(stEnumDef_.vValueIndex);
+        Write(stEnumDef_.vNameIndex);
+        Write(stEnumDef_.vDescIndex);
+        Write(stEnumDef_.bDenseValues);
+    }
+
+    void Write(const MessageDefinition& stMsgDef_)
+    {
+        Write(stMsgDef_._id);
+        Write(stMsgDef_.logID);
+        Write(stMsgDef_.name);
+        Write(stMsgDef_.description);
+        Write(stMsgDef_.latestMessageCrc);
+        Write(static_cast<uint32_t>(stMsgDef_.fields.size()));
+        for (const auto& [uiCrc, vFields] : stMsgDef_.fields)
+        {
+            Write(uiCrc);
+            Write(vFields);
+        }
+    }
+};
+
+//-----------------------------------------------------------------------
+class CacheReader
+{
+    const char* pcMyPos;
+    const char* const pcMyEnd;
+
+    void Require(size_t ullSize_) const
+    {
+        if (static_cast<size_t>(pcMyEnd - pcMyPos) < ullSize_) { throw std::runtime_error("Truncated database cache"); }
+    }
+
+  public:
+    CacheReader(const char* pcData_, size_t ullSize_) : pcMyPos(pcData_), pcMyEnd(pcData_ + ullSize_) {}
+
+    [[nodiscard]] bool AtEnd() const { return pcMyPos == pcMyEnd; }
+
+    template <typename T> void Read(T& tValue_)
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+        Require(sizeof(T));
+        memcpy(&tValue_, pcMyPos, sizeof(T));
+        pcMyPos += sizeof(T);
+    }
+
+    template <typename T> T Read()
+    {
+        T tValue;
+        Read(tValue);
+        return tValue;
+    }
+
+    void Read(std::string& strValue_)
+    {
+        const auto uiSize = Read<uint32_t>();
+        Require(uiSize);
+        strValue_.assign(pcMyPos, uiSize);
+        pcMyPos += uiSize;
+    }
+
+    void Read(std::vector<uint32_t>& vValues_)
+    {
+        const auto uiSize = Read<uint32_t>();
+        Require(static_cast<size_t>(uiSize) * sizeof(uint32_t));
+        vValues_.resize(uiSize);
+        memcpy(vValues_.data(), pcMyPos, uiSize * sizeof(uint32_t));
+        pcMyPos += uiSize * sizeof(uint32_t);
+    }
+
+    std::unique_ptr<BaseField> ReadField()
+    {
+        const auto eType = Read<FIELD_TYPE>();
+
+        std::unique_ptr<BaseField> pstField;
+        switch (eType)
+        {
+        case FIELD_TYPE::SIMPLE: pstField = std::make_unique<BaseField>(); break;
+        case FIELD_TYPE::ENUM: pstField = std::make_unique<EnumField>(); break;
+        case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
+        case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: [[fallthrough]];
+        case FIELD_TYPE::STRING: pstField = std::make_unique<ArrayField>(); break;
+        case FIELD_TYPE::FIELD_ARRAY: pstField = std::make_unique<FieldArrayField>(); break;
+        default: throw std::runtime_error("Invalid field type in database cache");
+        }
+
+        pstField->type = eType;
+        Read(pstField->name);
+        Read(pstField->description);
+        std::string strConversion;
+        Read(strConversion);
+        // Derive the parsed conversion the same way as loading the Json does
+        if (!strConversion.empty()) { pstField->setConversion(strConversion); }
+
+        Read(pstField->dataType.name);
+        Read(pstField->dataType.length);
+        Read(pstField->dataType.description);
+        for (auto uiEnums = Read<uint32_t>(); uiEnums > 0; --uiEnums)
+        {
+            const auto iValue = Read<int32_t>();
+            Read(pstField->dataType.enums[iValue]);
+        }
+
+        switch (eType)
+        {
+        case FIELD_TYPE::ENUM:
+            Read(static_cast<EnumField&>(*pstField).enumID);
+            Read(static_cast<EnumField&>(*pstField).length);
+            break;
+        case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
+        case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: [[fallthrough]];
+        case FIELD_TYPE::STRING: Read(static_cast<ArrayField&>(*pstField).arrayLength); break;
+        case FIELD_TYPE::FIELD_ARRAY:
+            Read(static_cast<FieldArrayField&>(*pstField).arrayLength);
+            Read(static_cast<FieldArrayField&>(*pstField).fieldSize);
+            Read(static_cast<FieldArrayField&>(*pstField).fields);
+            break;
+        default: break;
+        }
+        return pstField;
+    }
+
+    void Read(std::vector<BaseField*>& vFields_)
+    {
+        for (auto uiFields = Read<uint32_t>(); uiFields > 0; --uiFields) { vFields_.push_back(ReadField().release()); }
+    }
+
+    void Read(EnumDataType& stEnum_)
+    {
+        Read(stEnum_.value);
+        Read(stEnum_.name);
+        Read(stEnum_.description);
+    }
+
+    void Read(EnumDefinition& stEnumDef_)
+    {
+        Read(stEnumDef_._id);
+        Read(stEnumDef_.name);
+        stEnumDef_.enumerators.resize(Read<uint32_t>());
+        for (EnumDataType& stEnum : stEnumDef_.enumerators) { Read(stEnum); }
+        Read(stEnumDef_.vValueIndex);
+        Read(stEnumDef_.vNameIndex);
+        Read(stEnumDef_.vDescIndex);
+        Read(stEnumDef_.bDenseValues);
+    }
+
+    void Read(MessageDefinition& stMsgDef_)
+    {
+        Read(stMsgDef_._id);
+        Read(stMsgDef_.logID);
+        Read(stMsgDef_.name);
+        Read(stMsgDef_.description);
+        Read(stMsgDef_.latestMessageCrc);
+        for (auto uiCrcs = Read<uint32_t>(); uiCrcs > 0; --uiCrcs) { Read(stMsgDef_.fields[Read<uint32_t>()]); }
+    }
+};
+
+//-----------------------------------------------------------------------
+// Finds the extent of Json values without building them, so that a DB can
+// be indexed without converting every message.
+//-----------------------------------------------------------------------
+class JsonScanner
+{
+    std::string_view svMyJson;
+    size_t ullMyPos{0};
+
+    [[noreturn]] void Fail() const { throw std::runtime_error("Malformed Json at offset " + std::to_string(ullMyPos)); }
+
+    char Peek()
+    {
+        while (ullMyPos < svMyJson.size() && std::isspace(static_cast<unsigned char>(svMyJson[ullMyPos]))) { ++ullMyPos; }
+        if (ullMyPos >= svMyJson.size()) { Fail(); }
+        return svMyJson[ullMyPos];
+    }
+
+    void SkipString()
+    {
+        for (++ullMyPos; ullMyPos < svMyJson.size(); ++ullMyPos)
+        {
+            if (svMyJson[ullMyPos] == '\\') { ++ullMyPos; }
+            else if (svMyJson[ullMyPos] == '"')
+            {
+                ++ullMyPos;
+                return;
+            }
+        }
+        Fail();
+    }
+
+  public:
+    explicit JsonScanner(std::string_view svJson_) : svMyJson(svJson_) {}
+
+    [[nodiscard]] size_t Position() const { return ullMyPos; }
+
+    //! Consume the next structural character if it is cExpected_.
+    bool Accept(char cExpected_)
+    {
+        if (Peek() != cExpected_) { return false; }
+        ++ullMyPos;
+        return true;
+    }
+
+    void Expect(char cExpected_)
+    {
+        if (!Accept(cExpected_)) { Fail(); }
+    }
+
+    //! Read a member name, leaving the position after the ':'.
+    std::string_view Key()
+    {
+        if (Peek() != '"') { Fail(); }
+        const size_t ullStart = ullMyPos + 1;
+        SkipString();
+        const std::string_view svKey = svMyJson.substr(ullStart, ullMyPos - 1 - ullStart);
+        Expect(':');
+        return svKey;
+    }
+
+    //! Skip a value of any type, returning its text.
+    std::string_view Value()
+    {
+        const char cFirst = Peek();
+        const size_t ullStart = ullMyPos;
+        if (cFirst == '"') { SkipString(); }
+        else if (cFirst == '{' || cFirst == '[')
+        {
+            uint32_t uiDepth = 0;
+            do {
+                if (ullMyPos >= svMyJson.size()) { Fail(); }
+                const char c = svMyJson[ullMyPos];
+                if (c == '"') { SkipString(); }
+                else
+                {
+                    if (c == '{' || c == '[') { ++uiDepth; }
+                    else if (c == '}' || c == ']') { --uiDepth; }
+                    ++ullMyPos;
+                }
+            } while (uiDepth > 0);
+        }
+        else
+        {
+            while (ullMyPos < svMyJson.size() && svMyJson[ullMyPos] != ',' && svMyJson[ullMyPos] != '}' && svMyJson[ullMyPos] != ']' &&
+                   !std::isspace(static_cast<unsigned char>(svMyJson[ullMyPos])))
+            {
+                ++ullMyPos;
+            }
+        }
+        return svMyJson.substr(ullStart, ullMyPos - ullStart);
+    }
+};
+
+} // namespace
+
 } // namespace novatel::edie
 
 //-----------------------------------------------------------------------
@@ -196,6 +671,7 @@ template <typename T> void JsonReader::LoadFile(T filePath)
         json_file.open(std::filesystem::path(filePath), std::ios::in);
         json jDefinitions = json::parse(json_file);
 
+        ClearLazyMessages();
         vMessageDefinitions.clear();
         for (const auto& msg : jDefinitions["messages"])
         {
@@ -225,6 +701,7 @@ template <> void JsonReader::LoadFile<std::string>(std::string filePath)
         json_file.open(filePath, std::ios::in);
         json jDefinitions = json::parse(json_file);
 
+        ClearLazyMessages();
         vMessageDefinitions.clear();
 
         for (auto& msg : jDefinitions["messages"])
@@ -329,6 +806,13 @@ void JsonReader::RemoveMessage(uint32_t iMsgId_, bool bGenerateMappings_)
         vMessageDefinitions.erase(iTer);
     }
 
+    const auto itLazy = mLazyMessageID.find(static_cast<int32_t>(iMsgId_));
+    if (itLazy != mLazyMessageID.end())
+    {
+        mLazyMessageName.erase(itLazy->second->name);
+        mLazyMessageID.erase(itLazy);
+    }
+
     if (bGenerateMappings_) GenerateMappings();
 }
 
@@ -352,6 +836,7 @@ void JsonReader::ParseJson(const std::string& strJsonData_)
 {
     json jDefinitions = json::parse(strJsonData_);
 
+    ClearLazyMessages();
     vMessageDefinitions.clear();
     for (const auto& msg : jDefinitions["logs"])
     {
@@ -368,19 +853,288 @@ void JsonReader::ParseJson(const std::string& strJsonData_)
 }
 
 //-----------------------------------------------------------------------
-uint32_t JsonReader::MsgNameToMsgId(std::string sMsgName_) const
+void JsonReader::LoadFileLazy(const std::filesystem::path& clJsonPath_)
+{
+    std::vector<novatel::edie::EnumDefinition> vEnumDefs;
+    std::vector<std::unique_ptr<novatel::edie::LazyMessageDefinition>> vLazyMsgs;
+
+    try
+    {
+        const std::vector<char> vJson = novatel::edie::ReadWholeFile(clJsonPath_);
+        novatel::edie::JsonScanner clScanner(std::string_view(vJson.data(), vJson.size()));
+
+        clScanner.Expect('{');
+        if (!clScanner.Accept('}'))
+        {
+            do {
+                const std::string_view svKey = clScanner.Key();
+                if (svKey == "enums")
+                {
+                    // Enums are few and small, and message definitions refer to them, so they are loaded as usual
+                    for (const auto& enm : json::parse(clScanner.Value())) { vEnumDefs.push_back(enm); }
+                }
+                else if (svKey == "messages")
+                {
+                    clScanner.Expect('[');
+                    if (clScanner.Accept(']')) { continue; }
+                    do {
+                        auto pstLazyMsg = std::make_unique<novatel::edie::LazyMessageDefinition>();
+                        pstLazyMsg->ullOffset = clScanner.Position();
+                        // Only read the members that identify the message
+                        clScanner.Expect('{');
+                        if (!clScanner.Accept('}'))
+                        {
+                            do {
+                                const std::string_view svMember = clScanner.Key();
+                                const std::string_view svValue = clScanner.Value();
+                                if (svMember == "name") { pstLazyMsg->name = json::parse(svValue).get<std::string>(); }
+                                else if (svMember == "messageID")
+                                {
+                                    if (std::from_chars(svValue.data(), svValue.data() + svValue.size(), pstLazyMsg->logID).ec != std::errc())
+                                    {
+                                        throw std::runtime_error("Invalid messageID");
+                                    }
+                                }
+                            } while (clScanner.Accept(','));
+                            clScanner.Expect('}');
+                        }
+                        pstLazyMsg->ullLength = clScanner.Position() - pstLazyMsg->ullOffset;
+                        vLazyMsgs.push_back(std::move(pstLazyMsg));
+                    } while (clScanner.Accept(','));
+                    clScanner.Expect(']');
+                }
+                else { clScanner.Value(); }
+            } while (clScanner.Accept(','));
+            clScanner.Expect('}');
+        }
+    }
+    catch (std::exception& e)
+    {
+        throw novatel::edie::JsonReaderFailure(__func__, __FILE__, __LINE__, clJsonPath_, e.what());
+    }
+
+    ClearLazyMessages();
+    vMessageDefinitions.clear();
+    vEnumDefinitions = std::move(vEnumDefs);
+    mMessageName.clear();
+    mMessageID.clear();
+    mEnumName.clear();
+    mEnumID.clear();
+    GenerateMappings();
+
+    clLazyFilePath = clJsonPath_;
+    vLazyMessages = std::move(vLazyMsgs);
+    for (const auto& pstLazyMsg : vLazyMessages)
+    {
+        mLazyMessageName[pstLazyMsg->name] = pstLazyMsg.get();
+        mLazyMessageID[static_cast<int32_t>(pstLazyMsg->logID)] = pstLazyMsg.get();
+    }
+}
+
+//-----------------------------------------------------------------------
+const novatel::edie::MessageDefinition* JsonReader::GetLazyMsgDef(const novatel::edie::LazyMessageDefinition& stLazyMsg_) const
+{
+    const novatel::edie::MessageDefinition* pstMsgDef = stLazyMsg_.pstDefinition.load(std::memory_order_acquire);
+    if (pstMsgDef != nullptr) { return pstMsgDef; }
+
+    std::lock_guard<std::mutex> clLock(clLazyMutex);
+    // Another thread may have built it while this one waited for the lock
+    pstMsgDef = stLazyMsg_.pstDefinition.load(std::memory_order_relaxed);
+    if (pstMsgDef != nullptr) { return pstMsgDef; }
+
+    std::string strJson(stLazyMsg_.ullLength, '\0');
+    std::ifstream clJsonFile(clLazyFilePath, std::ios::binary);
+    clJsonFile.seekg(static_cast<std::streamoff>(stLazyMsg_.ullOffset));
+    if (!clJsonFile.read(strJson.data(), static_cast<std::streamsize>(strJson.size())))
+    {
+        throw novatel::edie::JsonReaderFailure(__func__, __FILE__, __LINE__, clLazyFilePath, "Could not read a message definition");
+    }
+
+    novatel::edie::MessageDefinition stMsgDef;
+    try
+    {
+        novatel::edie::from_json(json::parse(strJson), stMsgDef);
+    }
+    catch (std::exception& e)
+    {
+        throw novatel::edie::JsonReaderFailure(__func__, __FILE__, __LINE__, clLazyFilePath, e.what());
+    }
+    if (stMsgDef.logID != stLazyMsg_.logID || stMsgDef.name != stLazyMsg_.name)
+    {
+        throw novatel::edie::JsonReaderFailure(__func__, __FILE__, __LINE__, clLazyFilePath, "The file changed after it was loaded");
+    }
+
+    // A deque never moves its elements, so definitions handed out earlier stay valid
+    novatel::edie::MessageDefinition& stStored = dqLazyDefinitions.emplace_back(stMsgDef);
+    for (const auto& field : stStored.fields) { MapMessageEnumFields(field.second); }
+    stLazyMsg_.pstDefinition.store(&stStored, std::memory_order_release);
+    return &stStored;
+}
+
+//-----------------------------------------------------------------------
+void JsonReader::ClearLazyMessages()
+{
+    mLazyMessageName.clear();
+    mLazyMessageID.clear();
+    vLazyMessages.clear();
+    dqLazyDefinitions.clear();
+    clLazyFilePath.clear();
+}
+
+//-----------------------------------------------------------------------
+void JsonReader::CopyLazyMessages(const JsonReader& that)
+{
+    ClearLazyMessages();
+    clLazyFilePath = that.clLazyFilePath;
+    for (const auto& [iMsgID, pstThatMsg] : that.mLazyMessageID)
+    {
+        auto pstLazyMsg = std::make_unique<novatel::edie::LazyMessageDefinition>();
+        pstLazyMsg->name = pstThatMsg->name;
+        pstLazyMsg->logID = pstThatMsg->logID;
+        pstLazyMsg->ullOffset = pstThatMsg->ullOffset;
+        pstLazyMsg->ullLength = pstThatMsg->ullLength;
+        mLazyMessageName[pstLazyMsg->name] = pstLazyMsg.get();
+        mLazyMessageID[iMsgID] = pstLazyMsg.get();
+        vLazyMessages.push_back(std::move(pstLazyMsg));
+    }
+}
+
+//-----------------------------------------------------------------------
+void JsonReader::LoadFileCached(const std::filesystem::path& clJsonPath_, std::filesystem::path clCachePath_)
+{
+    if (clCachePath_.empty()) { clCachePath_ = std::filesystem::path(clJsonPath_).concat(".cache"); }
+    if (LoadCache(clCachePath_, clJsonPath_)) { return; }
+
+    LoadFile(clJsonPath_.u32string());
+
+    // The cache only saves time, so failing to write it isn't a reason to fail the load
+    try
+    {
+        SaveCache(clCachePath_, clJsonPath_);
+    }
+    catch (std::exception& e)
+    {
+        Logger::RegisterLogger("json_reader")->warn("Could not write the database cache {}: {}", clCachePath_.string(), e.what());
+    }
+}
+
+//-----------------------------------------------------------------------
+void JsonReader::SaveCache(const std::filesystem::path& clCachePath_, const std::filesystem::path& clJsonPath_) const
+{
+    const std::vector<char> vJson = novatel::edie::ReadWholeFile(clJsonPath_);
+
+    std::vector<char> vCache(sizeof(novatel::edie::CacheHeader));
+    novatel::edie::CacheWriter clWriter(vCache);
+    clWriter.Write(static_cast<uint32_t>(vEnumDefinitions.size()));
+    for (const novatel::edie::EnumDefinition& stEnumDef : vEnumDefinitions) { clWriter.Write(stEnumDef); }
+    // Lazily loaded messages are built so that the cache holds the whole DB
+    std::vector<const novatel::edie::MessageDefinition*> vMsgDefs;
+    for (const novatel::edie::MessageDefinition& stMsgDef : vMessageDefinitions) { vMsgDefs.push_back(&stMsgDef); }
+    for (const auto& [iMsgID, pstLazyMsg] : mLazyMessageID)
+    {
+        if (!mMessageID.contains(iMsgID)) { vMsgDefs.push_back(GetLazyMsgDef(*pstLazyMsg)); }
+    }
+    clWriter.Write(static_cast<uint32_t>(vMsgDefs.size()));
+    for (const novatel::edie::MessageDefinition* pstMsgDef : vMsgDefs) { clWriter.Write(*pstMsgDef); }
+
+    novatel::edie::CacheHeader stHeader{};
+    memcpy(stHeader.acMagic, novatel::edie::acCACHE_MAGIC, sizeof(stHeader.acMagic));
+    stHeader.uiVersion = uiCACHE_VERSION;
+    stHeader.uiByteOrder = novatel::edie::uiCACHE_BYTE_ORDER;
+    stHeader.ullJsonSize = vJson.size();
+    stHeader.uiJsonCrc = novatel::edie::BufferCrc32(vJson.data(), vJson.size());
+    stHeader.ullPayloadSize = vCache.size() - sizeof(stHeader);
+    stHeader.uiPayloadCrc = novatel::edie::BufferCrc32(vCache.data() + sizeof(stHeader), stHeader.ullPayloadSize);
+    memcpy(vCache.data(), &stHeader, sizeof(stHeader));
+
+    // Write to a temporary file and rename it, so that another process never sees a partial cache
+    std::filesystem::path clTempPath = std::filesystem::path(clCachePath_).concat(".tmp" + std::to_string(std::random_device{}()));
+    {
+        std::ofstream clCacheFile(clTempPath, std::ios::binary | std::ios::trunc);
+        clCacheFile.write(vCache.data(), static_cast<std::streamsize>(vCache.size()));
+        if (!clCacheFile.flush())
+        {
+            clCacheFile.close();
+            std::filesystem::remove(clTempPath);
+            throw novatel::edie::JsonReaderFailure(__func__, __FILE__, __LINE__, clCachePath_, "Could not write the database cache");
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(clTempPath, clCachePath_, ec);
+    if (ec)
+    {
+        std::filesystem::remove(clTempPath);
+        throw novatel::edie::JsonReaderFailure(__func__, __FILE__, __LINE__, clCachePath_, "Could not write the database cache");
+    }
+}
+
+//-----------------------------------------------------------------------
+bool JsonReader::LoadCache(const std::filesystem::path& clCachePath_, const std::filesystem::path& clJsonPath_)
+{
+    std::vector<novatel::edie::EnumDefinition> vEnumDefs;
+    std::vector<novatel::edie::MessageDefinition> vMsgDefs;
+
+    try
+    {
+        const std::vector<char> vCache = novatel::edie::ReadWholeFile(clCachePath_);
+
+        novatel::edie::CacheHeader stHeader;
+        if (vCache.size() < sizeof(stHeader)) { return false; }
+        memcpy(&stHeader, vCache.data(), sizeof(stHeader));
+        if (memcmp(stHeader.acMagic, novatel::edie::acCACHE_MAGIC, sizeof(stHeader.acMagic)) != 0 || stHeader.uiVersion != uiCACHE_VERSION ||
+            stHeader.uiByteOrder != novatel::edie::uiCACHE_BYTE_ORDER || stHeader.ullPayloadSize != vCache.size() - sizeof(stHeader))
+        {
+            return false;
+        }
+
+        // The Json file must be the one the cache was written for
+        std::error_code ec;
+        if (std::filesystem::file_size(clJsonPath_, ec) != stHeader.ullJsonSize || ec) { return false; }
+        const std::vector<char> vJson = novatel::edie::ReadWholeFile(clJsonPath_);
+        if (novatel::edie::BufferCrc32(vJson.data(), vJson.size()) != stHeader.uiJsonCrc) { return false; }
+
+        const char* pcPayload = vCache.data() + sizeof(stHeader);
+        if (novatel::edie::BufferCrc32(pcPayload, stHeader.ullPayloadSize) != stHeader.uiPayloadCrc) { return false; }
+
+        novatel::edie::CacheReader clReader(pcPayload, stHeader.ullPayloadSize);
+        vEnumDefs.resize(clReader.Read<uint32_t>());
+        for (novatel::edie::EnumDefinition& stEnumDef : vEnumDefs) { clReader.Read(stEnumDef); }
+        vMsgDefs.resize(clReader.Read<uint32_t>());
+        for (novatel::edie::MessageDefinition& stMsgDef : vMsgDefs) { clReader.Read(stMsgDef); }
+        if (!clReader.AtEnd()) { return false; }
+    }
+    catch (std::exception&)
+    {
+        return false;
+    }
+
+    ClearLazyMessages();
+    vEnumDefinitions = std::move(vEnumDefs);
+    vMessageDefinitions = std::move(vMsgDefs);
+    mMessageName.clear();
+    mMessageID.clear();
+    mEnumName.clear();
+    mEnumID.clear();
+    GenerateMappings();
+    return true;
+}
+
+//-----------------------------------------------------------------------
+uint32_t JsonReader::MsgNameToMsgId(std::string_view sMsgName_) const
 {
     uint32_t uiSiblingID = 0;
     uint32_t uiMsgFormat;
     uint32_t uiResponse;
 
     // Ingest the sibling information, i.e. the _1 from LOGNAMEA_1
-    if (sMsgName_.find_last_of('_') != std::string::npos && sMsgName_.find_last_of('_') == sMsgName_.size() - 2)
+    if (sMsgName_.size() >= 2 && sMsgName_[sMsgName_.size() - 2] == '_' && sMsgName_.back() != '_')
     {
         uiSiblingID = static_cast<uint32_t>(ToDigit(sMsgName_.back()));
-        sMsgName_.resize(sMsgName_.size() - 2);
+        sMsgName_.remove_suffix(2);
     }
 
+    if (sMsgName_.empty()) { return 0; }
+
     // If this is an abbrev msg (no format information), we will be able to find the MsgDef
     const novatel::edie::MessageDefinition* pclMessageDef = GetMsgDef(sMsgName_);
     if (pclMessageDef)
@@ -396,17 +1150,17 @@ uint32_t JsonReader::MsgNameToMsgId(std::string sMsgName_) const
     case 'R': // ASCII Response
         uiResponse = static_cast<uint32_t>(true);
         uiMsgFormat = static_cast<uint32_t>(novatel::edie::MESSAGEFORMAT::ASCII);
-        sMsgName_.pop_back();
+        sMsgName_.remove_suffix(1);
         break;
     case 'A': // ASCII
         uiResponse = static_cast<uint32_t>(false);
         uiMsgFormat = static_cast<uint32_t>(novatel::edie::MESSAGEFORMAT::ASCII);
-        sMsgName_.pop_back();
+        sMsgName_.remove_suffix(1);
         break;
     case 'B': // Binary
         uiResponse = static_cast<uint32_t>(false);
         uiMsgFormat = static_cast<uint32_t>(novatel::edie::MESSAGEFORMAT::BINARY);
-        sMsgName_.pop_back();
+        sMsgName_.remove_suffix(1);
         break;
     default: // Abbreviated ASCII
         uiResponse = static_cast<uint32_t>(false);
@@ -444,10 +1198,13 @@ std::string JsonReader::MsgIdToMsgName(const uint32_t uiMessageID_) const
 }
 
 //-----------------------------------------------------------------------
-const novatel::edie::MessageDefinition* JsonReader::GetMsgDef(const std::string& strMsgName_) const
+const novatel::edie::MessageDefinition* JsonReader::GetMsgDef(std::string_view strMsgName_) const
 {
     const auto it = mMessageName.find(strMsgName_);
-    return it != mMessageName.end() ? it->second : nullptr;
+    if (it != mMessageName.end()) { return it->second; }
+
+    const auto itLazy = mLazyMessageName.find(strMsgName_);
+    return itLazy != mLazyMessageName.end() ? GetLazyMsgDef(*itLazy->second) : nullptr;
 }
 
 //-----------------------------------------------------------------------
@@ -455,20 +1212,23 @@ const novatel::edie::MessageDefinition* JsonReader::GetMsgDef(const std::string&
 const novatel::edie::MessageDefinition* JsonReader::GetMsgDef(int32_t iMsgID) const
 {
     const auto it = mMessageID.find(iMsgID);
-    return it != mMessageID.end() ? it->second : nullptr;
+    if (it != mMessageID.end()) { return it->second; }
+
+    const auto itLazy = mLazyMessageID.find(iMsgID);
+    return itLazy != mLazyMessageID.end() ? GetLazyMsgDef(*itLazy->second) : nullptr;
 }
 
 // -------------------------------------------------------------------------------------------------------
-std::vector<novatel::edie::BaseField*> const* novatel::edie::MessageDefinition::GetMsgDefFromCRC(std::shared_ptr<spdlog::logger> pclLogger_,
-                                                                                                 uint32_t& uiMsgDefCRC_) const
+std::vector<novatel::edie::BaseField*> const*
+novatel::edie::MessageDefinition::GetMsgDefFromCRC(const std::shared_ptr<spdlog::logger>& pclLogger_, uint32_t& uiMsgDefCRC_) const
 {
+    const auto it = fields.find(uiMsgDefCRC_);
+    if (it != fields.end()) { return &it->second; }
+
     // If we can't find the correct CRC just default to the latest.
-    if (fields.count(uiMsgDefCRC_) == 0)
-    {
-        pclLogger_->info("Log DB is missing the log definition {} - {}.  Defaulting to newest version of the "
-                         "log definition.",
-                         name, uiMsgDefCRC_);
-        uiMsgDefCRC_ = latestMessageCrc;
-    }
+    pclLogger_->info("Log DB is missing the log definition {} - {}.  Defaulting to newest version of the "
+                     "log definition.",
+                     name, uiMsgDefCRC_);
+    uiMsgDefCRC_ = latestMessageCrc;
     return &fields.at(uiMsgDefCRC_);
 }
@@ -32,15 +32,18 @@
 //-----------------------------------------------------------------------
 #include "decoders/common/api/message_decoder.hpp"
 
+#include <algorithm>
 #include <bitset>
 #include <sstream>
 
 using namespace novatel::edie;
 
 // -------------------------------------------------------------------------------------------------------
-MessageDecoderBase::MessageDecoderBase(JsonReader* pclJsonDb_)
+MessageDecoderBase::MessageDecoderBase(JsonReader* pclJsonDb_) : MessageDecoderBase(BaseFieldMaps(), pclJsonDb_) {}
+
+// -------------------------------------------------------------------------------------------------------
+MessageDecoderBase::MessageDecoderBase(const FieldDecoderMaps& stFieldMaps_, JsonReader* pclJsonDb_) : pstMyFieldMaps(&stFieldMaps_)
 {
-    InitFieldMaps();
     if (pclJsonDb_ != nullptr) { LoadJsonDb(pclJsonDb_); }
 }
 
@@ -50,6 +53,7 @@ void MessageDecoderBase::LoadJsonDb(JsonReader* pclJsonDb_)
     pclMyMsgDb = pclJsonDb_;
     InitEnumDefns();
     CreateResponseMsgDefns();
+    CompileDecodePlans();
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -65,153 +69,160 @@ void MessageDecoderBase::InitEnumDefns()
 }
 
 // -------------------------------------------------------------------------------------------------------
-void MessageDecoderBase::InitFieldMaps()
+const MessageDecoderBase::FieldDecoderMaps& MessageDecoderBase::BaseFieldMaps()
+{
+    // A static local is initialized exactly once, even when decoders are constructed on several threads
+    static const FieldDecoderMaps stFieldMaps = [] {
+        FieldDecoderMaps stMaps;
+        InitFieldMaps(stMaps.asciiFieldMap, stMaps.jsonFieldMap);
+        return stMaps;
+    }();
+    return stFieldMaps;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void MessageDecoderBase::InitFieldMaps(std::unordered_map<uint32_t, AsciiFieldDecoder>& asciiFieldMap_,
+                                       std::unordered_map<uint32_t, JsonFieldDecoder>& jsonFieldMap_)
 {
     // =========================================================
     // ASCII Field Mapping
     // =========================================================
-    // asciiFieldMap[CalculateBlockCRC32("%c")] = SimpleAsciiMapEntry<int8_t>();
-    asciiFieldMap[CalculateBlockCRC32("%hd")] = SimpleAsciiMapEntry<int16_t>();
-    asciiFieldMap[CalculateBlockCRC32("%ld")] = SimpleAsciiMapEntry<int32_t>();
-    asciiFieldMap[CalculateBlockCRC32("%lld")] = SimpleAsciiMapEntry<int64_t>();
-    // asciiFieldMap[CalculateBlockCRC32("%uc")] = SimpleAsciiMapEntry<uint8_t>();
-    asciiFieldMap[CalculateBlockCRC32("%hu")] = SimpleAsciiMapEntry<uint16_t>();
-    asciiFieldMap[CalculateBlockCRC32("%lu")] = SimpleAsciiMapEntry<uint32_t>();
-    asciiFieldMap[CalculateBlockCRC32("%llu")] = SimpleAsciiMapEntry<uint64_t>();
-    asciiFieldMap[CalculateBlockCRC32("%lx")] = SimpleAsciiMapEntry<uint32_t, 16>();
-    asciiFieldMap[CalculateBlockCRC32("%B")] = SimpleAsciiMapEntry<int8_t>();
-    asciiFieldMap[CalculateBlockCRC32("%UB")] = SimpleAsciiMapEntry<uint8_t>();
-    asciiFieldMap[CalculateBlockCRC32("%XB")] = SimpleAsciiMapEntry<uint8_t, 16>();
-    asciiFieldMap[CalculateBlockCRC32("%lf")] = SimpleAsciiMapEntry<double>();
-    asciiFieldMap[CalculateBlockCRC32("%e")] = SimpleAsciiMapEntry<float>();
-    asciiFieldMap[CalculateBlockCRC32("%le")] = SimpleAsciiMapEntry<double>();
-    asciiFieldMap[CalculateBlockCRC32("%g%")] = SimpleAsciiMapEntry<float>();
-    asciiFieldMap[CalculateBlockCRC32("%lg")] = SimpleAsciiMapEntry<double>();
-
-    asciiFieldMap[CalculateBlockCRC32("%f")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                  char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+    // asciiFieldMap_[CalculateBlockCRC32("%c")] = SimpleAsciiMapEntry<int8_t>();
+    asciiFieldMap_[CalculateBlockCRC32("%hd")] = SimpleAsciiMapEntry<int16_t>();
+    asciiFieldMap_[CalculateBlockCRC32("%ld")] = SimpleAsciiMapEntry<int32_t>();
+    asciiFieldMap_[CalculateBlockCRC32("%lld")] = SimpleAsciiMapEntry<int64_t>();
+    // asciiFieldMap_[CalculateBlockCRC32("%uc")] = SimpleAsciiMapEntry<uint8_t>();
+    asciiFieldMap_[CalculateBlockCRC32("%hu")] = SimpleAsciiMapEntry<uint16_t>();
+    asciiFieldMap_[CalculateBlockCRC32("%lu")] = SimpleAsciiMapEntry<uint32_t>();
+    asciiFieldMap_[CalculateBlockCRC32("%llu")] = SimpleAsciiMapEntry<uint64_t>();
+    asciiFieldMap_[CalculateBlockCRC32("%lx")] = SimpleAsciiMapEntry<uint32_t, 16>();
+    asciiFieldMap_[CalculateBlockCRC32("%B")] = SimpleAsciiMapEntry<int8_t>();
+    asciiFieldMap_[CalculateBlockCRC32("%UB")] = SimpleAsciiMapEntry<uint8_t>();
+    asciiFieldMap_[CalculateBlockCRC32("%XB")] = SimpleAsciiMapEntry<uint8_t, 16>();
+    asciiFieldMap_[CalculateBlockCRC32("%lf")] = SimpleAsciiMapEntry<double>();
+    asciiFieldMap_[CalculateBlockCRC32("%e")] = SimpleAsciiMapEntry<float>();
+    asciiFieldMap_[CalculateBlockCRC32("%le")] = SimpleAsciiMapEntry<double>();
+    asciiFieldMap_[CalculateBlockCRC32("%g%")] = SimpleAsciiMapEntry<float>();
+    asciiFieldMap_[CalculateBlockCRC32("%lg")] = SimpleAsciiMapEntry<double>();
+
+    asciiFieldMap_[CalculateBlockCRC32("%f")] = [](const BaseField* MessageDataType_, char** ppcToken_, const size_t tokenLength_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         switch (MessageDataType_->dataType.length)
         {
-        case 4: vIntermediateFormat_.emplace_back(strtof(*ppcToken_, nullptr), MessageDataType_); return;
-        case 8: vIntermediateFormat_.emplace_back(strtod(*ppcToken_, nullptr), MessageDataType_); return;
+        case 4: return ParseAsciiNumber<float>(*ppcToken_, tokenLength_);
+        case 8: return ParseAsciiNumber<double>(*ppcToken_, tokenLength_);
         default: throw std::runtime_error("invalid float length");
         }
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%d")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                  char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+    asciiFieldMap_[CalculateBlockCRC32("%d")] = [](const BaseField* MessageDataType_, char** ppcToken_, const size_t tokenLength_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         if (MessageDataType_->dataType.name == DATA_TYPE::BOOL)
-            vIntermediateFormat_.emplace_back(std::string(*ppcToken_, tokenLength_) == "TRUE", MessageDataType_);
+            return std::string_view(*ppcToken_, tokenLength_) == "TRUE";
         else
-            vIntermediateFormat_.emplace_back(static_cast<int32_t>(strtol(*ppcToken_, nullptr, 10)), MessageDataType_);
+            return ParseAsciiNumber<int32_t>(*ppcToken_, tokenLength_);
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%u")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                  char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+    asciiFieldMap_[CalculateBlockCRC32("%u")] = [](const BaseField* MessageDataType_, char** ppcToken_, const size_t tokenLength_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         switch (MessageDataType_->dataType.length)
         {
-        case 1: vIntermediateFormat_.emplace_back(static_cast<uint8_t>(strtoul(*ppcToken_, nullptr, 10)), MessageDataType_); return;
-        case 2: vIntermediateFormat_.emplace_back(static_cast<uint16_t>(strtoul(*ppcToken_, nullptr, 10)), MessageDataType_); return;
-        case 4: vIntermediateFormat_.emplace_back(static_cast<uint32_t>(strtoul(*ppcToken_, nullptr, 10)), MessageDataType_); return;
-        case 8: vIntermediateFormat_.emplace_back(static_cast<uint64_t>(strtoull(*ppcToken_, nullptr, 10)), MessageDataType_); return;
+        case 1: return ParseAsciiNumber<uint8_t>(*ppcToken_, tokenLength_);
+        case 2: return ParseAsciiNumber<uint16_t>(*ppcToken_, tokenLength_);
+        case 4: return ParseAsciiNumber<uint32_t>(*ppcToken_, tokenLength_);
+        case 8: return ParseAsciiNumber<uint64_t>(*ppcToken_, tokenLength_);
         default: throw std::runtime_error("invalid unsigned length");
         }
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%x")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                  char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+    asciiFieldMap_[CalculateBlockCRC32("%x")] = [](const BaseField* MessageDataType_, char** ppcToken_, const size_t tokenLength_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         switch (MessageDataType_->dataType.length)
         {
-        case 1: vIntermediateFormat_.emplace_back(static_cast<uint8_t>(strtoul(*ppcToken_, nullptr, 16)), MessageDataType_); return;
-        case 2: vIntermediateFormat_.emplace_back(static_cast<uint16_t>(strtoul(*ppcToken_, nullptr, 16)), MessageDataType_); return;
-        case 4: vIntermediateFormat_.emplace_back(static_cast<uint32_t>(strtoul(*ppcToken_, nullptr, 16)), MessageDataType_); return;
-        case 8: vIntermediateFormat_.emplace_back(static_cast<uint64_t>(strtoull(*ppcToken_, nullptr, 16)), MessageDataType_); return;
+        case 1: return ParseAsciiNumber<uint8_t, 16>(*ppcToken_, tokenLength_);
+        case 2: return ParseAsciiNumber<uint16_t, 16>(*ppcToken_, tokenLength_);
+        case 4: return ParseAsciiNumber<uint32_t, 16>(*ppcToken_, tokenLength_);
+        case 8: return ParseAsciiNumber<uint64_t, 16>(*ppcToken_, tokenLength_);
         default: throw std::runtime_error("invalid hex length");
         }
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%X")] = asciiFieldMap[CalculateBlockCRC32("%x")];
+    asciiFieldMap_[CalculateBlockCRC32("%X")] = asciiFieldMap_[CalculateBlockCRC32("%x")];
 
-    asciiFieldMap[CalculateBlockCRC32("%c")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                  char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
-        vIntermediateFormat_.emplace_back(static_cast<int8_t>(**ppcToken_), MessageDataType_);
+    asciiFieldMap_[CalculateBlockCRC32("%c")] = []([[maybe_unused]] const BaseField* MessageDataType_, char** ppcToken_,
+                                                   [[maybe_unused]] const size_t tokenLength_, [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+        return static_cast<int8_t>(**ppcToken_);
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%uc")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                   char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
-        vIntermediateFormat_.emplace_back(static_cast<uint8_t>(**ppcToken_), MessageDataType_);
+    asciiFieldMap_[CalculateBlockCRC32("%uc")] = []([[maybe_unused]] const BaseField* MessageDataType_, char** ppcToken_,
+                                                    [[maybe_unused]] const size_t tokenLength_, [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+        return static_cast<uint8_t>(**ppcToken_);
     };
 
     // =========================================================
     // Json Field Mapping
     // =========================================================
-    jsonFieldMap[CalculateBlockCRC32("%ld")] = SimpleJsonMapEntry<int32_t>();
-    jsonFieldMap[CalculateBlockCRC32("%hd")] = SimpleJsonMapEntry<int16_t>();
-    jsonFieldMap[CalculateBlockCRC32("%lld")] = SimpleJsonMapEntry<int64_t>();
-    jsonFieldMap[CalculateBlockCRC32("%lu")] = SimpleJsonMapEntry<uint32_t>();
-    jsonFieldMap[CalculateBlockCRC32("%hu")] = SimpleJsonMapEntry<uint16_t>();
-    jsonFieldMap[CalculateBlockCRC32("%llu")] = SimpleJsonMapEntry<uint64_t>();
-    jsonFieldMap[CalculateBlockCRC32("%lx")] = SimpleJsonMapEntry<uint32_t>();
-    jsonFieldMap[CalculateBlockCRC32("%c")] = SimpleJsonMapEntry<int8_t>();
-    jsonFieldMap[CalculateBlockCRC32("%uc")] = SimpleJsonMapEntry<uint8_t>();
-    jsonFieldMap[CalculateBlockCRC32("%B")] = SimpleJsonMapEntry<int8_t>();
-    jsonFieldMap[CalculateBlockCRC32("%UB")] = SimpleJsonMapEntry<uint8_t>();
-    jsonFieldMap[CalculateBlockCRC32("%XB")] = SimpleJsonMapEntry<uint8_t>();
-    jsonFieldMap[CalculateBlockCRC32("%lf")] = SimpleJsonMapEntry<double>();
-    jsonFieldMap[CalculateBlockCRC32("%e")] = SimpleJsonMapEntry<float>();
-    jsonFieldMap[CalculateBlockCRC32("%le")] = SimpleJsonMapEntry<double>();
-    jsonFieldMap[CalculateBlockCRC32("%g")] = SimpleJsonMapEntry<float>();
-    jsonFieldMap[CalculateBlockCRC32("%lg")] = SimpleJsonMapEntry<double>();
-
-    jsonFieldMap[CalculateBlockCRC32("%f")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                 json clJsonField_, [[maybe_unused]] JsonReader* pclMsgDb) {
+    jsonFieldMap_[CalculateBlockCRC32("%ld")] = SimpleJsonMapEntry<int32_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%hd")] = SimpleJsonMapEntry<int16_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%lld")] = SimpleJsonMapEntry<int64_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%lu")] = SimpleJsonMapEntry<uint32_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%hu")] = SimpleJsonMapEntry<uint16_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%llu")] = SimpleJsonMapEntry<uint64_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%lx")] = SimpleJsonMapEntry<uint32_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%c")] = SimpleJsonMapEntry<int8_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%uc")] = SimpleJsonMapEntry<uint8_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%B")] = SimpleJsonMapEntry<int8_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%UB")] = SimpleJsonMapEntry<uint8_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%XB")] = SimpleJsonMapEntry<uint8_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%lf")] = SimpleJsonMapEntry<double>();
+    jsonFieldMap_[CalculateBlockCRC32("%e")] = SimpleJsonMapEntry<float>();
+    jsonFieldMap_[CalculateBlockCRC32("%le")] = SimpleJsonMapEntry<double>();
+    jsonFieldMap_[CalculateBlockCRC32("%g")] = SimpleJsonMapEntry<float>();
+    jsonFieldMap_[CalculateBlockCRC32("%lg")] = SimpleJsonMapEntry<double>();
+
+    jsonFieldMap_[CalculateBlockCRC32("%f")] = [](const BaseField* MessageDataType_, json clJsonField_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         switch (MessageDataType_->dataType.length)
         {
-        case 4: vIntermediateFormat_.emplace_back(clJsonField_.get<float>(), MessageDataType_); return;
-        case 8: vIntermediateFormat_.emplace_back(clJsonField_.get<double>(), MessageDataType_); return;
+        case 4: return clJsonField_.get<float>();
+        case 8: return clJsonField_.get<double>();
         default: throw std::runtime_error("invalid float length");
         }
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%d")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                 json clJsonField_, [[maybe_unused]] JsonReader* pclMsgDb) {
+    jsonFieldMap_[CalculateBlockCRC32("%d")] = [](const BaseField* MessageDataType_, json clJsonField_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         if (MessageDataType_->dataType.name == DATA_TYPE::BOOL)
-            vIntermediateFormat_.emplace_back(clJsonField_.get<bool>(), MessageDataType_);
+            return clJsonField_.get<bool>();
         else
-            vIntermediateFormat_.emplace_back(clJsonField_.get<int32_t>(), MessageDataType_);
+            return clJsonField_.get<int32_t>();
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%u")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                 json clJsonField_, [[maybe_unused]] JsonReader* pclMsgDb) {
+    jsonFieldMap_[CalculateBlockCRC32("%u")] = [](const BaseField* MessageDataType_, json clJsonField_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         switch (MessageDataType_->dataType.length)
         {
-        case 1: vIntermediateFormat_.emplace_back(clJsonField_.get<uint8_t>(), MessageDataType_); return;
-        case 2: vIntermediateFormat_.emplace_back(clJsonField_.get<uint16_t>(), MessageDataType_); return;
-        case 4: vIntermediateFormat_.emplace_back(clJsonField_.get<uint32_t>(), MessageDataType_); return;
-        case 8: vIntermediateFormat_.emplace_back(clJsonField_.get<uint64_t>(), MessageDataType_); return;
+        case 1: return clJsonField_.get<uint8_t>();
+        case 2: return clJsonField_.get<uint16_t>();
+        case 4: return clJsonField_.get<uint32_t>();
+        case 8: return clJsonField_.get<uint64_t>();
         default: throw std::runtime_error("invalid unsigned length");
         }
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%x")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                 json clJsonField_, [[maybe_unused]] JsonReader* pclMsgDb) {
+    jsonFieldMap_[CalculateBlockCRC32("%x")] = [](const BaseField* MessageDataType_, json clJsonField_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         switch (MessageDataType_->dataType.length)
         {
-        case 1: vIntermediateFormat_.emplace_back(clJsonField_.get<uint8_t>(), MessageDataType_); return;
-        case 2: vIntermediateFormat_.emplace_back(clJsonField_.get<uint16_t>(), MessageDataType_); return;
-        case 4: vIntermediateFormat_.emplace_back(clJsonField_.get<uint32_t>(), MessageDataType_); return;
-        case 8: vIntermediateFormat_.emplace_back(clJsonField_.get<uint64_t>(), MessageDataType_); return;
+        case 1: return clJsonField_.get<uint8_t>();
+        case 2: return clJsonField_.get<uint16_t>();
+        case 4: return clJsonField_.get<uint32_t>();
+        case 8: return clJsonField_.get<uint64_t>();
         default: throw std::runtime_error("invalid hex length");
         }
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%X")] = jsonFieldMap[CalculateBlockCRC32("%x")];
+    jsonFieldMap_[CalculateBlockCRC32("%X")] = jsonFieldMap_[CalculateBlockCRC32("%x")];
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -249,6 +260,96 @@ void MessageDecoderBase::CreateResponseMsgDefns()
     stMyRespDef.fields[0].push_back(stRespStrField.clone());
 }
 
+// -------------------------------------------------------------------------------------------------------
+DecodeStep MessageDecoderBase::CompileStep(const BaseField* pclField_) const
+{
+    DecodeStep stStep;
+    stStep.pclField = pclField_;
+    stStep.eFieldType = pclField_->type;
+    stStep.eDataType = pclField_->dataType.name;
+    stStep.usLength = pclField_->dataType.length;
+    stStep.ucAlignment = static_cast<uint8_t>(std::clamp<uint16_t>(pclField_->dataType.length, 1, 4));
+    stStep.bPrintAsString = pclField_->isString();
+    stStep.bCommaSeparated = pclField_->isCSV();
+    stStep.bHexByteArray = pclField_->conversionHash == CalculateBlockCRC32("%Z");
+    stStep.bSignedByteArray = pclField_->conversionHash == CalculateBlockCRC32("%P");
+
+    // Leave the converters null if they're unknown, only fields that use them should fail to decode
+    auto itAscii = pstMyFieldMaps->asciiFieldMap.find(pclField_->conversionHash);
+    if (itAscii != pstMyFieldMaps->asciiFieldMap.end()) { stStep.pfAsciiDecoder = itAscii->second; }
+    auto itJson = pstMyFieldMaps->jsonFieldMap.find(pclField_->conversionHash);
+    if (itJson != pstMyFieldMaps->jsonFieldMap.end()) { stStep.pfJsonDecoder = itJson->second; }
+
+    switch (pclField_->type)
+    {
+    case FIELD_TYPE::ENUM:
+        stStep.pclEnumDef = static_cast<const EnumField*>(pclField_)->enumDef;
+        stStep.uiEnumLength = static_cast<const EnumField*>(pclField_)->length;
+        break;
+    case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
+    case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: stStep.uiArrayLength = static_cast<const ArrayField*>(pclField_)->arrayLength; break;
+    case FIELD_TYPE::FIELD_ARRAY: stStep.uiArrayLength = static_cast<const FieldArrayField*>(pclField_)->arrayLength; break;
+    default: break;
+    }
+
+    return stStep;
+}
+
+// -------------------------------------------------------------------------------------------------------
+DecodePlan MessageDecoderBase::CompilePlan(std::span<BaseField* const> vMsgDefFields_) const
+{
+    DecodePlan stPlan;
+    stPlan.vSteps.reserve(vMsgDefFields_.size());
+
+    for (const BaseField* pclField : vMsgDefFields_)
+    {
+        DecodeStep& stStep = stPlan.vSteps.emplace_back(CompileStep(pclField));
+        if (pclField->type == FIELD_TYPE::FIELD_ARRAY)
+        {
+            stStep.uiSubPlan = static_cast<uint32_t>(stPlan.vSubPlans.size());
+            stPlan.vSubPlans.emplace_back(CompilePlan(static_cast<const FieldArrayField*>(pclField)->fields));
+        }
+    }
+
+    return stPlan;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void MessageDecoderBase::CompileDecodePlans()
+{
+    mMyDecodePlans.clear();
+    mMyDecodePlans.emplace(stMyRespDef.fields.at(0).data(), CompilePlan(stMyRespDef.fields.at(0)));
+
+    if (pclMyMsgDb == nullptr) { return; }
+
+    ullMyPlanGeneration = pclMyMsgDb->GetGeneration();
+    for (const MessageDefinition& stMsgDef : pclMyMsgDb->GetMessageDefinitions())
+    {
+        for (const auto& [uiMsgDefCrc, vMsgDefFields] : stMsgDef.fields) { mMyDecodePlans.emplace(vMsgDefFields.data(), CompilePlan(vMsgDefFields)); }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------------
+const DecodePlan& MessageDecoderBase::GetDecodePlan(const std::vector<BaseField*>& vMsgDefFields_)
+{
+    // The definitions the plans point into may have been replaced since they were compiled
+    if (pclMyMsgDb != nullptr && pclMyMsgDb->GetGeneration() != ullMyPlanGeneration) { CompileDecodePlans(); }
+
+    auto it = mMyDecodePlans.find(vMsgDefFields_.data());
+    if (it == mMyDecodePlans.end()) { it = mMyDecodePlans.emplace(vMsgDefFields_.data(), CompilePlan(vMsgDefFields_)).first; }
+    return it->second;
+}
+
+// -------------------------------------------------------------------------------------------------------
+const DecodePlan* MessageDecoderBase::FindDecodePlan(std::span<BaseField* const> vMsgDefFields_) const
+{
+    // Plans compiled from definitions that have since been replaced can't be trusted, and can't be recompiled here
+    if (pclMyMsgDb != nullptr && pclMyMsgDb->GetGeneration() != ullMyPlanGeneration) { return nullptr; }
+
+    const auto it = mMyDecodePlans.find(vMsgDefFields_.data());
+    return it != mMyDecodePlans.end() && it->second.vSteps.size() == vMsgDefFields_.size() ? &it->second : nullptr;
+}
+
 // -------------------------------------------------------------------------------------------------------
 void MessageDecoderBase::SetLoggerLevel(spdlog::level::level_enum eLevel_) { pclMyLogger->set_level(eLevel_); }
 
@@ -256,10 +357,12 @@ void MessageDecoderBase::SetLoggerLevel(spdlog::level::level_enum eLevel_) { pcl
 void MessageDecoderBase::ShutdownLogger() { Logger::Shutdown(); }
 
 // -------------------------------------------------------------------------------------------------------
-void MessageDecoderBase::DecodeBinaryField(const BaseField* MessageDataType_, unsigned char** ppucLogBuf_,
-                                           std::vector<FieldContainer>& vIntermediateFormat_) const
+template <typename T>
+void MessageDecoderBase::DecodeBinaryField(const DecodeStep& stStep_, unsigned char** ppucLogBuf_, T& vIntermediateFormat_) const
 {
-    switch (MessageDataType_->dataType.name)
+    const BaseField* MessageDataType_ = stStep_.pclField;
+
+    switch (stStep_.eDataType)
     {
     case DATA_TYPE::BOOL: vIntermediateFormat_.emplace_back(*reinterpret_cast<bool*>(*ppucLogBuf_), MessageDataType_); break;
     case DATA_TYPE::HEXBYTE: [[fallthrough]];
@@ -279,38 +382,55 @@ void MessageDecoderBase::DecodeBinaryField(const BaseField* MessageDataType_, un
     default: throw std::runtime_error("DecodeBinaryField(): Unknown field type\n");
     }
 
-    *ppucLogBuf_ += MessageDataType_->dataType.length;
+    *ppucLogBuf_ += stStep_.usLength;
 }
 
 // -------------------------------------------------------------------------------------------------------
+template <typename T>
+void MessageDecoderBase::DecodeBinaryField(const BaseField* MessageDataType_, unsigned char** ppucLogBuf_, T& vIntermediateFormat_) const
+{
+    DecodeBinaryField(CompileStep(MessageDataType_), ppucLogBuf_, vIntermediateFormat_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T>
+void MessageDecoderBase::DecodeAsciiField(const DecodeStep& stStep_, char** ppcToken_, const size_t tokenLength_, T& vIntermediateFormat_) const
+{
+    if (stStep_.pfAsciiDecoder == nullptr) { throw std::runtime_error("DecodeAsciiField(): Unknown field type\n"); }
+    std::visit([&](const auto& tValue) { vIntermediateFormat_.emplace_back(tValue, stStep_.pclField); },
+               stStep_.pfAsciiDecoder(stStep_.pclField, ppcToken_, tokenLength_, pclMyMsgDb));
+}
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T>
 void MessageDecoderBase::DecodeAsciiField(const BaseField* MessageDataType_, char** ppcToken_, const size_t tokenLength_,
-                                          std::vector<FieldContainer>& vIntermediateFormat_) const
+                                          T& vIntermediateFormat_) const
 {
-    auto it = asciiFieldMap.find(MessageDataType_->conversionHash);
-    if (it == asciiFieldMap.end()) { throw std::runtime_error("DecodeAsciiField(): Unknown field type\n"); }
-    it->second(vIntermediateFormat_, MessageDataType_, ppcToken_, tokenLength_, pclMyMsgDb);
+    DecodeAsciiField(CompileStep(MessageDataType_), ppcToken_, tokenLength_, vIntermediateFormat_);
 }
 
 // -------------------------------------------------------------------------------------------------------
-STATUS
-MessageDecoderBase::DecodeBinary(const std::vector<BaseField*> MsgDefFields_, unsigned char** ppucLogBuf_,
-                                 std::vector<FieldContainer>& vIntermediateFormat_, uint32_t uiMessageLength_) const
+template <typename T>
+STATUS MessageDecoderBase::DecodeBinary(const DecodePlan& stPlan_, unsigned char** ppucLogBuf_, T& vIntermediateFormat_,
+                                        uint32_t uiMessageLength_) const
 {
     unsigned char* pucTempStart = *ppucLogBuf_;
-    for (auto& field : MsgDefFields_)
+    for (const DecodeStep& stStep : stPlan_.vSteps)
     {
+        const BaseField* field = stStep.pclField;
+
         // Realign to type byte boundary if needed
-        uint8_t usTypeAlignment = std::min(static_cast<uint16_t>(4), field->dataType.length);
+        uint8_t usTypeAlignment = stStep.ucAlignment;
         if (reinterpret_cast<uint64_t>(*ppucLogBuf_) % usTypeAlignment != 0)
         {
             *ppucLogBuf_ += usTypeAlignment - (reinterpret_cast<uint64_t>(*ppucLogBuf_) % usTypeAlignment);
         }
 
-        switch (field->type)
+        switch (stStep.eFieldType)
         {
-        case FIELD_TYPE::SIMPLE: DecodeBinaryField(field, ppucLogBuf_, vIntermediateFormat_); break;
+        case FIELD_TYPE::SIMPLE: DecodeBinaryField(stStep, ppucLogBuf_, vIntermediateFormat_); break;
         case FIELD_TYPE::ENUM:
-            switch (field->dataType.length)
+            switch (stStep.usLength)
             {
             case 2: vIntermediateFormat_.emplace_back(*reinterpret_cast<std::int16_t*>(*ppucLogBuf_), field); break;
             case 4: vIntermediateFormat_.emplace_back(*reinterpret_cast<std::int32_t*>(*ppucLogBuf_), field); break;
@@ -318,43 +438,41 @@ MessageDecoderBase::DecodeBinary(const std::vector<BaseField*> MsgDefFields_, un
                 SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeBinary(): Invalid field length\n");
                 throw std::runtime_error("DecodeBinary(): Invalid field length\n");
             }
-            *ppucLogBuf_ += field->dataType.length;
+            *ppucLogBuf_ += stStep.usLength;
             break;
         case FIELD_TYPE::RESPONSE_ID:
             vIntermediateFormat_.emplace_back(*reinterpret_cast<std::int32_t*>(*ppucLogBuf_), field);
             *ppucLogBuf_ += sizeof(int32_t);
             break;
         case FIELD_TYPE::RESPONSE_STR: {
-            std::string sTemp(reinterpret_cast<char*>(*ppucLogBuf_), uiMessageLength_ - sizeof(int32_t)); // Remove CRC
-            vIntermediateFormat_.emplace_back(sTemp, field);
+            std::string_view svTemp(reinterpret_cast<char*>(*ppucLogBuf_), uiMessageLength_ - sizeof(int32_t)); // Remove CRC
+            vIntermediateFormat_.emplace_back(svTemp, field);
             // Binary response string is not null terminated or 4 byte aligned
-            *ppucLogBuf_ += sTemp.size();
+            *ppucLogBuf_ += svTemp.size();
             break;
         }
         case FIELD_TYPE::FIXED_LENGTH_ARRAY: {
-            uint32_t uiArraySize = static_cast<const ArrayField*>(field)->arrayLength;
-            vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
-            auto& pvFC = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
-            pvFC.reserve(uiArraySize);
+            uint32_t uiArraySize = stStep.uiArrayLength;
+            auto&& pvFC = BeginArrayField(vIntermediateFormat_, field, uiArraySize);
 
-            for (uint32_t i = 0; i < uiArraySize; ++i) { DecodeBinaryField(field, ppucLogBuf_, pvFC); }
+            for (uint32_t i = 0; i < uiArraySize; ++i) { DecodeBinaryField(stStep, ppucLogBuf_, pvFC); }
+            EndArrayField(pvFC);
             break;
         }
         case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: {
             auto uiArraySize = *reinterpret_cast<std::uint32_t*>(*ppucLogBuf_);
             *ppucLogBuf_ += sizeof(uint32_t);
-            vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
-            auto& pvFC = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
-            pvFC.reserve(uiArraySize);
+            auto&& pvFC = BeginArrayField(vIntermediateFormat_, field, uiArraySize);
 
-            for (uint32_t i = 0; i < uiArraySize; ++i) { DecodeBinaryField(field, ppucLogBuf_, pvFC); }
+            for (uint32_t i = 0; i < uiArraySize; ++i) { DecodeBinaryField(stStep, ppucLogBuf_, pvFC); }
+            EndArrayField(pvFC);
             break;
         }
         case FIELD_TYPE::STRING: {
             // This version of a string is different. It is hopefully null terminated.
-            std::string sTemp(reinterpret_cast<char*>(*ppucLogBuf_));
-            vIntermediateFormat_.emplace_back(sTemp, field);
-            *ppucLogBuf_ += sTemp.size() + 1; // + 1 to consume the NULL at the end of the string. This is to maintain byte alignment.
+            std::string_view svTemp(reinterpret_cast<char*>(*ppucLogBuf_));
+            vIntermediateFormat_.emplace_back(svTemp, field);
+            *ppucLogBuf_ += svTemp.size() + 1; // + 1 to consume the NULL at the end of the string. This is to maintain byte alignment.
             // TODO: what was this for? It breaks RXCOMMANDSB.GPS. Is 4 supposed to be usTypeAlignment instead?
             // if (reinterpret_cast<std::uint64_t>(*ppucLogBuf_) % 4 != 0) { *ppucLogBuf_ += 4 - reinterpret_cast<std::uint64_t>(*ppucLogBuf_) % 4; }
             break;
@@ -362,20 +480,17 @@ MessageDecoderBase::DecodeBinary(const std::vector<BaseField*> MsgDefFields_, un
         case FIELD_TYPE::FIELD_ARRAY: {
             auto* puiArraySize = reinterpret_cast<std::uint32_t*>(*ppucLogBuf_);
             *ppucLogBuf_ += sizeof(int32_t);
-            auto* sub_field_defs = static_cast<FieldArrayField*>(field);
-            vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
-            auto& pvFieldArrayContainer = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
-            pvFieldArrayContainer.reserve(*puiArraySize);
+            const DecodePlan& stSubPlan = stPlan_.vSubPlans[stStep.uiSubPlan];
+            auto&& pvFieldArrayContainer = BeginArrayField(vIntermediateFormat_, field, *puiArraySize);
 
             for (uint32_t i = 0; i < *puiArraySize; ++i)
             {
-                pvFieldArrayContainer.emplace_back(std::vector<FieldContainer>(), field);
-                auto& pvFC = std::get<std::vector<FieldContainer>>(pvFieldArrayContainer.back().field_value);
-                pvFC.reserve(static_cast<const FieldArrayField*>(field)->fields.size());
-                STATUS eStatus =
-                    DecodeBinary(sub_field_defs->fields, ppucLogBuf_, pvFC, uiMessageLength_ - static_cast<uint32_t>(*ppucLogBuf_ - pucTempStart));
+                auto&& pvFC = BeginArrayField(pvFieldArrayContainer, field, stSubPlan.vSteps.size());
+                STATUS eStatus = DecodeBinary(stSubPlan, ppucLogBuf_, pvFC, uiMessageLength_ - static_cast<uint32_t>(*ppucLogBuf_ - pucTempStart));
                 if (eStatus != STATUS::SUCCESS) { return eStatus; }
+                EndArrayField(pvFC);
             }
+            EndArrayField(pvFieldArrayContainer);
             break;
         }
         default:
@@ -390,9 +505,8 @@ MessageDecoderBase::DecodeBinary(const std::vector<BaseField*> MsgDefFields_, un
 }
 
 // -------------------------------------------------------------------------------------------------------
-template <bool ABBREVIATED>
-STATUS MessageDecoderBase::DecodeAscii(const std::vector<BaseField*> MsgDefFields_, char** ppucLogBuf_,
-                                       std::vector<FieldContainer>& vIntermediateFormat_) const
+template <bool ABBREVIATED, typename T>
+STATUS MessageDecoderBase::DecodeAscii(const DecodePlan& stPlan_, char** ppucLogBuf_, T& vIntermediateFormat_) const
 {
     constexpr char cDelimiter1 = ABBREVIATED ? ' ' : ','; // TODO: give all these better names
     constexpr char cDelimiter2 = ABBREVIATED ? '\r' : '*';
@@ -402,8 +516,9 @@ STATUS MessageDecoderBase::DecodeAscii(const std::vector<BaseField*> MsgDefField
     constexpr char acDelimiter3[4] = {cDelimiter1, cDelimiter2, cDelimiter3, '\0'};
     constexpr char acDelimiterResponse[2] = {cDelimiter2, '\0'};
 
-    for (auto& field : MsgDefFields_)
+    for (const DecodeStep& stStep : stPlan_.vSteps)
     {
+        const BaseField* field = stStep.pclField;
         size_t tokenLength = strcspn(*ppucLogBuf_, acDelimiter3); // TODO: do we need to use acDelimiter3?
         if (ABBREVIATED && ConsumeAbbrevFormatting(tokenLength, ppucLogBuf_)) { tokenLength = strcspn(*ppucLogBuf_, acDelimiter3); }
 
@@ -412,20 +527,19 @@ STATUS MessageDecoderBase::DecodeAscii(const std::vector<BaseField*> MsgDefField
 
         bool bEarlyEndOfMessage = (*(*ppucLogBuf_ + tokenLength) == cDelimiter2);
 
-        switch (field->type)
+        switch (stStep.eFieldType)
         {
         case FIELD_TYPE::SIMPLE:
-            DecodeAsciiField(field, ppucLogBuf_, tokenLength, vIntermediateFormat_);
+            DecodeAsciiField(stStep, ppucLogBuf_, tokenLength, vIntermediateFormat_);
             *ppucLogBuf_ += tokenLength + 1;
             break;
         case FIELD_TYPE::ENUM: {
-            std::string sEnum = std::string(*ppucLogBuf_, tokenLength);
-            const auto enumField = static_cast<EnumField*>(field);
-            switch (enumField->length)
+            const std::string_view svEnum(*ppucLogBuf_, tokenLength);
+            switch (stStep.uiEnumLength)
             {
-            case 1: vIntermediateFormat_.emplace_back(static_cast<uint8_t>(GetEnumValue(enumField->enumDef, sEnum)), field); break;
-            case 2: vIntermediateFormat_.emplace_back(static_cast<uint16_t>(GetEnumValue(enumField->enumDef, sEnum)), field); break;
-            default: vIntermediateFormat_.emplace_back(GetEnumValue(enumField->enumDef, sEnum), field); break;
+            case 1: vIntermediateFormat_.emplace_back(static_cast<uint8_t>(GetEnumValue(stStep.pclEnumDef, svEnum)), field); break;
+            case 2: vIntermediateFormat_.emplace_back(static_cast<uint16_t>(GetEnumValue(stStep.pclEnumDef, svEnum)), field); break;
+            default: vIntermediateFormat_.emplace_back(GetEnumValue(stStep.pclEnumDef, svEnum), field); break;
             }
             *ppucLogBuf_ += tokenLength + 1;
             break;
@@ -433,17 +547,17 @@ STATUS MessageDecoderBase::DecodeAscii(const std::vector<BaseField*> MsgDefField
         case FIELD_TYPE::STRING:
             // If a field delimiter character is in the string, the previous tokenLength value is invalid.
             tokenLength = strcspn(*ppucLogBuf_ + 1, acDelimiter2); // Look for LAST '\"' character, skipping past the first.
-            vIntermediateFormat_.emplace_back(std::string(*ppucLogBuf_ + 1, tokenLength), field); // + 1 to traverse opening double-quote.
+            vIntermediateFormat_.emplace_back(std::string_view(*ppucLogBuf_ + 1, tokenLength), field); // + 1 to traverse opening double-quote.
             // Skip past the first '\"', string token and the remaining characters ('\"' and ',').
             *ppucLogBuf_ += 1 + tokenLength + strcspn(*ppucLogBuf_ + tokenLength, acDelimiter1);
             break;
         case FIELD_TYPE::RESPONSE_ID: {
             // Ensure we get the whole response (skip over delimiters in responses)
             tokenLength = strcspn(*ppucLogBuf_, acDelimiterResponse);
-            std::string sResponse(*ppucLogBuf_, tokenLength);
-            if (sResponse == "OK") { vIntermediateFormat_.emplace_back(1, field); }
+            const std::string_view svResponse(*ppucLogBuf_, tokenLength);
+            if (svResponse == "OK") { vIntermediateFormat_.emplace_back(1, field); }
             // Note: This won't match responses with format specifiers in them (%d, %s, etc), they will be given id=0
-            else { vIntermediateFormat_.emplace_back(GetResponseId(vMyRespDefns, sResponse.substr(svErrorPrefix.length())), field); }
+            else { vIntermediateFormat_.emplace_back(GetResponseId(vMyRespDefns, svResponse.substr(svErrorPrefix.length())), field); }
             // Do not advance buffer, need to reprocess this field for the following RESPONSE_STR.
             bEarlyEndOfMessage = false;
             break;
@@ -451,18 +565,18 @@ STATUS MessageDecoderBase::DecodeAscii(const std::vector<BaseField*> MsgDefField
         case FIELD_TYPE::RESPONSE_STR:
             // Response strings aren't surrounded by double quotes, ensure we get the whole response (skip over certain delimiters in responses)
             tokenLength = strcspn(*ppucLogBuf_, acDelimiterResponse);
-            vIntermediateFormat_.emplace_back(std::string(*ppucLogBuf_, tokenLength), field);
+            vIntermediateFormat_.emplace_back(std::string_view(*ppucLogBuf_, tokenLength), field);
             *ppucLogBuf_ += tokenLength + 1;
             break;
         case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
         case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: {
             uint32_t uiArraySize = 0;
-            if (field->type == FIELD_TYPE::FIXED_LENGTH_ARRAY) { uiArraySize = static_cast<const ArrayField*>(field)->arrayLength; }
-            if (field->type == FIELD_TYPE::VARIABLE_LENGTH_ARRAY)
+            if (stStep.eFieldType == FIELD_TYPE::FIXED_LENGTH_ARRAY) { uiArraySize = stStep.uiArrayLength; }
+            if (stStep.eFieldType == FIELD_TYPE::VARIABLE_LENGTH_ARRAY)
             {
-                uiArraySize = strtoul(*ppucLogBuf_, nullptr, 10);
+                uiArraySize = ParseAsciiNumber<uint32_t>(*ppucLogBuf_, tokenLength);
 
-                if (uiArraySize > static_cast<const ArrayField*>(field)->arrayLength)
+                if (uiArraySize > stStep.uiArrayLength)
                 {
                     SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii(): Array size too large. Malformed Input\n");
                     throw std::runtime_error("DecodeAscii(): Array size too large. Malformed Input\n");
@@ -472,12 +586,10 @@ STATUS MessageDecoderBase::DecodeAscii(const std::vector<BaseField*> MsgDefField
                 tokenLength = strcspn(*ppucLogBuf_, acDelimiter1);
             }
 
-            vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
-            auto& pvFC = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
-            pvFC.reserve(uiArraySize);
+            auto&& pvFC = BeginArrayField(vIntermediateFormat_, field, uiArraySize);
 
-            const bool bPrintAsString = field->isString();
-            const bool bIsCommaSeperated = field->isCSV();
+            const bool bPrintAsString = stStep.bPrintAsString;
+            const bool bIsCommaSeperated = stStep.bCommaSeparated;
 
             char* pcPosition = *ppucLogBuf_;
             if (bPrintAsString)
@@ -490,7 +602,7 @@ STATUS MessageDecoderBase::DecodeAscii(const std::vector<BaseField*> MsgDefField
 
             for (uint32_t i = 0; i < uiArraySize; ++i)
             {
-                if (field->conversionHash == CalculateBlockCRC32("%Z"))
+                if (stStep.bHexByteArray)
                 {
                     uint32_t uiValueRead = 0;
                     if (sscanf(pcPosition, "%02x", &uiValueRead) != 1)
@@ -541,37 +653,36 @@ STATUS MessageDecoderBase::DecodeAscii(const std::vector<BaseField*> MsgDefField
                     else
                     {
                         tokenLength = strcspn(*ppucLogBuf_, acDelimiter1);
-                        DecodeAsciiField(field, ppucLogBuf_, tokenLength, pvFC);
+                        DecodeAsciiField(stStep, ppucLogBuf_, tokenLength, pvFC);
                         *ppucLogBuf_ += tokenLength + 1;
                     }
                 }
             }
             if (!bIsCommaSeperated) *ppucLogBuf_ += tokenLength + 1;
+            EndArrayField(pvFC);
             break;
         }
         case FIELD_TYPE::FIELD_ARRAY: {
             uint32_t uiArraySize = strtoul(*ppucLogBuf_, ppucLogBuf_, 10);
             ++*ppucLogBuf_;
-            auto* sub_field_defs = static_cast<FieldArrayField*>(field);
+            const DecodePlan& stSubPlan = stPlan_.vSubPlans[stStep.uiSubPlan];
 
-            if (uiArraySize > sub_field_defs->arrayLength)
+            if (uiArraySize > stStep.uiArrayLength)
             {
                 SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii(): Array size too large. Malformed Input\n");
                 throw std::runtime_error("DecodeAscii(): Array size too large. Malformed Input\n");
             }
 
-            vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
-            auto& pvFieldArrayContainer = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
-            pvFieldArrayContainer.reserve(uiArraySize);
+            auto&& pvFieldArrayContainer = BeginArrayField(vIntermediateFormat_, field, uiArraySize);
 
             for (uint32_t i = 0; i < uiArraySize; ++i)
             {
-                pvFieldArrayContainer.emplace_back(std::vector<FieldContainer>(), field);
-                auto& pvsubFC = std::get<std::vector<FieldContainer>>(pvFieldArrayContainer.back().field_value);
-                pvsubFC.reserve(static_cast<const FieldArrayField*>(field)->fields.size());
-                STATUS eStatus = DecodeAscii<ABBREVIATED>(sub_field_defs->fields, ppucLogBuf_, pvsubFC);
+                auto&& pvsubFC = BeginArrayField(pvFieldArrayContainer, field, stSubPlan.vSteps.size());
+                STATUS eStatus = DecodeAscii<ABBREVIATED>(stSubPlan, ppucLogBuf_, pvsubFC);
                 if (eStatus != STATUS::SUCCESS) { return eStatus; }
+                EndArrayField(pvsubFC);
             }
+            EndArrayField(pvFieldArrayContainer);
             break;
         }
         default:
@@ -586,70 +697,61 @@ STATUS MessageDecoderBase::DecodeAscii(const std::vector<BaseField*> MsgDefField
     return STATUS::SUCCESS;
 }
 
-// explicit template instantiations
-template STATUS MessageDecoderBase::DecodeAscii<true>(const std::vector<BaseField*>, char**, std::vector<FieldContainer>&) const;
-template STATUS MessageDecoderBase::DecodeAscii<false>(const std::vector<BaseField*>, char**, std::vector<FieldContainer>&) const;
-
 // -------------------------------------------------------------------------------------------------------
-STATUS
-MessageDecoderBase::DecodeJson(const std::vector<BaseField*> MsgDefFields_, json clJsonFields_,
-                               std::vector<FieldContainer>& vIntermediateFormat_) const
+template <typename T>
+STATUS MessageDecoderBase::DecodeJson(const DecodePlan& stPlan_, json clJsonFields_, T& vIntermediateFormat_) const
 {
-    for (auto& field : MsgDefFields_)
+    for (const DecodeStep& stStep : stPlan_.vSteps)
     {
+        const BaseField* field = stStep.pclField;
         json clField = clJsonFields_[field->name];
 
-        switch (field->type)
+        switch (stStep.eFieldType)
         {
-        case FIELD_TYPE::SIMPLE: DecodeJsonField(field, clField, vIntermediateFormat_); break;
-        case FIELD_TYPE::ENUM:
-            vIntermediateFormat_.emplace_back(GetEnumValue(static_cast<EnumField*>(field)->enumDef, clField.get<std::string>()), field);
-            break;
+        case FIELD_TYPE::SIMPLE: DecodeJsonField(stStep, clField, vIntermediateFormat_); break;
+        case FIELD_TYPE::ENUM: vIntermediateFormat_.emplace_back(GetEnumValue(stStep.pclEnumDef, clField.get_ref<const std::string&>()), field); break;
         case FIELD_TYPE::STRING: [[fallthrough]];
         case FIELD_TYPE::RESPONSE_STR: vIntermediateFormat_.emplace_back(clField.get<std::string>(), field); break;
         case FIELD_TYPE::RESPONSE_ID: {
-            std::string sResponse(clField.get<std::string>());
-            if (sResponse == "OK") { vIntermediateFormat_.emplace_back(clField.get<std::string>(), field); }
+            const std::string_view svResponse(clField.get_ref<const std::string&>());
+            if (svResponse == "OK") { vIntermediateFormat_.emplace_back(clField.get<std::string>(), field); }
             // Note: This won't match responses with format specifiers in them (%d, %s, etc), they will be given id=0
-            else { vIntermediateFormat_.emplace_back(GetResponseId(vMyRespDefns, sResponse.substr(svErrorPrefix.length())), field); }
+            else { vIntermediateFormat_.emplace_back(GetResponseId(vMyRespDefns, svResponse.substr(svErrorPrefix.length())), field); }
             break;
         }
         case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
         case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: {
-            vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
-            auto& pvFC = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
-
-            if (field->isString())
+            if (stStep.bPrintAsString)
             {
-                pvFC.reserve(clField.get<std::string>().size());
+                auto&& pvFC = BeginArrayField(vIntermediateFormat_, field, clField.get<std::string>().size());
                 for (char& cValRead : clField.get<std::string>()) { pvFC.emplace_back(static_cast<uint8_t>(cValRead), field); }
+                EndArrayField(pvFC);
             }
             else
             {
-                pvFC.reserve(clField.size());
+                auto&& pvFC = BeginArrayField(vIntermediateFormat_, field, clField.size());
                 for (const auto& it : clField)
                 {
-                    if (field->conversionHash == CalculateBlockCRC32("%Z")) { pvFC.emplace_back(it.get<uint8_t>(), field); }
-                    else if (field->conversionHash == CalculateBlockCRC32("%P")) { pvFC.emplace_back(it.get<int8_t>(), field); }
+                    if (stStep.bHexByteArray) { pvFC.emplace_back(it.get<uint8_t>(), field); }
+                    else if (stStep.bSignedByteArray) { pvFC.emplace_back(it.get<int8_t>(), field); }
                 }
+                EndArrayField(pvFC);
             }
             break;
         }
         case FIELD_TYPE::FIELD_ARRAY: {
             auto uiArraySize = static_cast<uint32_t>(clField.size());
-            auto* sub_field_defs = static_cast<FieldArrayField*>(field);
-            vIntermediateFormat_.emplace_back(std::vector<FieldContainer>(), field);
-            auto& pvFieldArrayContainer = std::get<std::vector<FieldContainer>>(vIntermediateFormat_.back().field_value);
-            pvFieldArrayContainer.reserve(uiArraySize);
+            const DecodePlan& stSubPlan = stPlan_.vSubPlans[stStep.uiSubPlan];
+            auto&& pvFieldArrayContainer = BeginArrayField(vIntermediateFormat_, field, uiArraySize);
 
             for (uint32_t i = 0; i < uiArraySize; ++i)
             {
-                pvFieldArrayContainer.emplace_back(std::vector<FieldContainer>(), field);
-                auto& pvsubFC = std::get<std::vector<FieldContainer>>(pvFieldArrayContainer.back().field_value);
-                pvsubFC.reserve((static_cast<const FieldArrayField*>(field))->fields.size());
-                STATUS eStatus = DecodeJson(sub_field_defs->fields, clField[i], pvsubFC);
+                auto&& pvsubFC = BeginArrayField(pvFieldArrayContainer, field, stSubPlan.vSteps.size());
+                STATUS eStatus = DecodeJson(stSubPlan, clField[i], pvsubFC);
                 if (eStatus != STATUS::SUCCESS) { return eStatus; }
+                EndArrayField(pvsubFC);
             }
+            EndArrayField(pvFieldArrayContainer);
             break;
         }
         default:
@@ -662,24 +764,53 @@ MessageDecoderBase::DecodeJson(const std::vector<BaseField*> MsgDefFields_, json
 }
 
 // -------------------------------------------------------------------------------------------------------
-void MessageDecoderBase::DecodeJsonField(const BaseField* MessageDataType_, json clJsonField_,
-                                         std::vector<FieldContainer>& vIntermediateFormat_) const
+template <typename T>
+STATUS MessageDecoderBase::DecodeBinary(std::span<BaseField* const> MsgDefFields_, unsigned char** ppucLogBuf_, T& vIntermediateFormat_,
+                                        uint32_t uiMessageLength_) const
 {
-    auto it = jsonFieldMap.find(MessageDataType_->conversionHash);
-    if (it == jsonFieldMap.end()) { throw std::runtime_error("DecodeJsonField(): Unknown field type\n"); }
-    it->second(vIntermediateFormat_, MessageDataType_, clJsonField_, pclMyMsgDb);
+    const DecodePlan* pstPlan = FindDecodePlan(MsgDefFields_);
+    if (pstPlan != nullptr) { return DecodeBinary(*pstPlan, ppucLogBuf_, vIntermediateFormat_, uiMessageLength_); }
+    return DecodeBinary(CompilePlan(MsgDefFields_), ppucLogBuf_, vIntermediateFormat_, uiMessageLength_);
 }
 
 // -------------------------------------------------------------------------------------------------------
-STATUS
-MessageDecoderBase::Decode(unsigned char* pucInData_, IntermediateMessage& stInterMessage_, MetaDataBase& stMetaData_)
+template <bool ABBREVIATED, typename T>
+STATUS MessageDecoderBase::DecodeAscii(std::span<BaseField* const> MsgDefFields_, char** ppucLogBuf_, T& vIntermediateFormat_) const
 {
-    if (pucInData_ == nullptr) { return STATUS::NULL_PROVIDED; }
+    const DecodePlan* pstPlan = FindDecodePlan(MsgDefFields_);
+    if (pstPlan != nullptr) { return DecodeAscii<ABBREVIATED>(*pstPlan, ppucLogBuf_, vIntermediateFormat_); }
+    return DecodeAscii<ABBREVIATED>(CompilePlan(MsgDefFields_), ppucLogBuf_, vIntermediateFormat_);
+}
 
-    unsigned char* pucTempInData = pucInData_;
-    const MessageDefinition* vMsgDef;
-    const std::vector<BaseField*>* pvCurrentMsgFields;
+// -------------------------------------------------------------------------------------------------------
+template <typename T>
+STATUS MessageDecoderBase::DecodeJson(std::span<BaseField* const> MsgDefFields_, json clJsonFields_, T& vIntermediateFormat_) const
+{
+    const DecodePlan* pstPlan = FindDecodePlan(MsgDefFields_);
+    if (pstPlan != nullptr) { return DecodeJson(*pstPlan, clJsonFields_, vIntermediateFormat_); }
+    return DecodeJson(CompilePlan(MsgDefFields_), clJsonFields_, vIntermediateFormat_);
+}
 
+// -------------------------------------------------------------------------------------------------------
+template <typename T>
+void MessageDecoderBase::DecodeJsonField(const DecodeStep& stStep_, json clJsonField_, T& vIntermediateFormat_) const
+{
+    if (stStep_.pfJsonDecoder == nullptr) { throw std::runtime_error("DecodeJsonField(): Unknown field type\n"); }
+    std::visit([&](const auto& tValue) { vIntermediateFormat_.emplace_back(tValue, stStep_.pclField); },
+               stStep_.pfJsonDecoder(stStep_.pclField, clJsonField_, pclMyMsgDb));
+}
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T>
+void MessageDecoderBase::DecodeJsonField(const BaseField* MessageDataType_, json clJsonField_, T& vIntermediateFormat_) const
+{
+    DecodeJsonField(CompileStep(MessageDataType_), clJsonField_, vIntermediateFormat_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+MessageDecoderBase::GetMsgDefFields(MetaDataBase& stMetaData_, const std::vector<BaseField*>*& pvMsgDefFields_) const
+{
     if (stMetaData_.bResponse)
     {
         if (stMetaData_.eFormat != HEADERFORMAT::BINARY && stMetaData_.eFormat != HEADERFORMAT::SHORT_BINARY &&
@@ -688,35 +819,92 @@ MessageDecoderBase::Decode(unsigned char* pucInData_, IntermediateMessage& stInt
         {
             return STATUS::NO_DEFINITION;
         }
-        vMsgDef = &stMyRespDef;
-        pvCurrentMsgFields = &vMsgDef->fields.at(0);
+        pvMsgDefFields_ = &stMyRespDef.fields.at(0);
+        return STATUS::SUCCESS;
     }
-    else
-    {
-        if (!pclMyMsgDb) { return STATUS::NO_DATABASE; }
 
-        vMsgDef = pclMyMsgDb->GetMsgDef(stMetaData_.usMessageID);
+    if (!pclMyMsgDb) { return STATUS::NO_DATABASE; }
 
-        if (!vMsgDef)
-        {
-            pclMyLogger->warn("No log definition for ID {}", stMetaData_.usMessageID);
-            return STATUS::NO_DEFINITION;
-        }
+    const MessageDefinition* vMsgDef = pclMyMsgDb->GetMsgDef(stMetaData_.usMessageID);
 
-        pvCurrentMsgFields = vMsgDef->GetMsgDefFromCRC(pclMyLogger, stMetaData_.uiMessageCRC);
+    if (!vMsgDef)
+    {
+        pclMyLogger->warn("No log definition for ID {}", stMetaData_.usMessageID);
+        return STATUS::NO_DEFINITION;
     }
 
-    // Expand the intermediate format vector to prevent the copy constructor from being called when the vector grows in size
-    stInterMessage_.clear();
-    stInterMessage_.reserve(pvCurrentMsgFields->size());
+    pvMsgDefFields_ = vMsgDef->GetMsgDefFromCRC(pclMyLogger, stMetaData_.uiMessageCRC);
+    return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T>
+STATUS MessageDecoderBase::DecodeBody(const DecodePlan& stPlan_, unsigned char* pucInData_, T& vIntermediateFormat_, const MetaDataBase& stMetaData_) const
+{
+    unsigned char* pucTempInData = pucInData_;
 
     // Decode the detected format
     return stMetaData_.eFormat == HEADERFORMAT::ASCII || stMetaData_.eFormat == HEADERFORMAT::SHORT_ASCII
-               ? DecodeAscii<false>(*pvCurrentMsgFields, reinterpret_cast<char**>(&pucTempInData), stInterMessage_)
+               ? DecodeAscii<false>(stPlan_, reinterpret_cast<char**>(&pucTempInData), vIntermediateFormat_)
            : stMetaData_.eFormat == HEADERFORMAT::ABB_ASCII || stMetaData_.eFormat == HEADERFORMAT::SHORT_ABB_ASCII
-               ? DecodeAscii<true>(*pvCurrentMsgFields, reinterpret_cast<char**>(&pucTempInData), stInterMessage_)
+               ? DecodeAscii<true>(stPlan_, reinterpret_cast<char**>(&pucTempInData), vIntermediateFormat_)
            : stMetaData_.eFormat == HEADERFORMAT::BINARY || stMetaData_.eFormat == HEADERFORMAT::SHORT_BINARY
-               ? DecodeBinary(*pvCurrentMsgFields, &pucTempInData, stInterMessage_, stMetaData_.uiBinaryMsgLength)
-           : stMetaData_.eFormat == HEADERFORMAT::JSON ? DecodeJson(*pvCurrentMsgFields, json::parse(pucTempInData)["body"], stInterMessage_)
+               ? DecodeBinary(stPlan_, &pucTempInData, vIntermediateFormat_, stMetaData_.uiBinaryMsgLength)
+           : stMetaData_.eFormat == HEADERFORMAT::JSON ? DecodeJson(stPlan_, json::parse(pucTempInData)["body"], vIntermediateFormat_)
                                                        : STATUS::UNKNOWN;
 }
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+MessageDecoderBase::Decode(unsigned char* pucInData_, IntermediateMessage& stInterMessage_, MetaDataBase& stMetaData_)
+{
+    if (pucInData_ == nullptr) { return STATUS::NULL_PROVIDED; }
+
+    const std::vector<BaseField*>* pvCurrentMsgFields = nullptr;
+    const STATUS eStatus = GetMsgDefFields(stMetaData_, pvCurrentMsgFields);
+    if (eStatus != STATUS::SUCCESS) { return eStatus; }
+
+    // Expand the intermediate format vector to prevent the copy constructor from being called when the vector grows in size
+    stInterMessage_.clear();
+    stInterMessage_.reserve(pvCurrentMsgFields->size());
+
+    return DecodeBody(GetDecodePlan(*pvCurrentMsgFields), pucInData_, stInterMessage_, stMetaData_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+MessageDecoderBase::Decode(unsigned char* pucInData_, FlatIntermediateMessage& stInterMessage_, MetaDataBase& stMetaData_)
+{
+    if (pucInData_ == nullptr) { return STATUS::NULL_PROVIDED; }
+
+    const std::vector<BaseField*>* pvCurrentMsgFields = nullptr;
+    const STATUS eStatus = GetMsgDefFields(stMetaData_, pvCurrentMsgFields);
+    if (eStatus != STATUS::SUCCESS) { return eStatus; }
+
+    // Keep the arenas from the previous message, only the contents are discarded
+    stInterMessage_.clear();
+    FlatFieldWriter clWriter(stInterMessage_);
+
+    return DecodeBody(GetDecodePlan(*pvCurrentMsgFields), pucInData_, clWriter, stMetaData_);
+}
+
+// explicit template instantiations
+template STATUS MessageDecoderBase::DecodeBinary(std::span<BaseField* const>, unsigned char**, IntermediateMessage&, uint32_t) const;
+template STATUS MessageDecoderBase::DecodeBinary(std::span<BaseField* const>, unsigned char**, FlatFieldWriter&, uint32_t) const;
+template STATUS MessageDecoderBase::DecodeAscii<true>(std::span<BaseField* const>, char**, IntermediateMessage&) const;
+template STATUS MessageDecoderBase::DecodeAscii<false>(std::span<BaseField* const>, char**, IntermediateMessage&) const;
+template STATUS MessageDecoderBase::DecodeAscii<true>(std::span<BaseField* const>, char**, FlatFieldWriter&) const;
+template STATUS MessageDecoderBase::DecodeAscii<false>(std::span<BaseField* const>, char**, FlatFieldWriter&) const;
+template STATUS MessageDecoderBase::DecodeJson(std::span<BaseField* const>, json, IntermediateMessage&) const;
+template STATUS MessageDecoderBase::DecodeJson(std::span<BaseField* const>, json, FlatFieldWriter&) const;
+template STATUS MessageDecoderBase::DecodeBinary(const DecodePlan&, unsigned char**, IntermediateMessage&, uint32_t) const;
+template STATUS MessageDecoderBase::DecodeBinary(const DecodePlan&, unsigned char**, FlatFieldWriter&, uint32_t) const;
+template STATUS MessageDecoderBase::DecodeAscii<true>(const DecodePlan&, char**, IntermediateMessage&) const;
+template STATUS MessageDecoderBase::DecodeAscii<false>(const DecodePlan&, char**, IntermediateMessage&) const;
+template STATUS MessageDecoderBase::DecodeAscii<true>(const DecodePlan&, char**, FlatFieldWriter&) const;
+template STATUS MessageDecoderBase::DecodeAscii<false>(const DecodePlan&, char**, FlatFieldWriter&) const;
+template STATUS MessageDecoderBase::DecodeJson(const DecodePlan&, json, IntermediateMessage&) const;
+template STATUS MessageDecoderBase::DecodeJson(const DecodePlan&, json, FlatFieldWriter&) const;
+template void MessageDecoderBase::DecodeBinaryField(const BaseField*, unsigned char**, IntermediateMessage&) const;
+template void MessageDecoderBase::DecodeAsciiField(const BaseField*, char**, const size_t, IntermediateMessage&) const;
+template void MessageDecoderBase::DecodeJsonField(const BaseField*, json, IntermediateMessage&) const;
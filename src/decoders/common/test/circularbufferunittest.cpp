@@ -33,6 +33,7 @@
 #include <gtest/gtest.h>
 
 #include "decoders/common/api/circularbuffer.hpp"
+#include "decoders/common/api/crc32.hpp"
 
 class CircularBufferTest : public ::testing::Test
 {
@@ -132,3 +133,96 @@ TEST_F(CircularBufferTest, COPY)
     uint32_t uiBytes_ = cCircularBuffer.Copy(reinterpret_cast<unsigned char*>(pcData_.get()), uiBytes + 1);
     ASSERT_EQ(uiBytes_, uiBytes);
 }
+
+TEST_F(CircularBufferTest, CALCULATE_CRC32)
+{
+    const std::string sData("0123456789abcdefghijklmnopqrstuvwxyz");
+    const auto* pucData = reinterpret_cast<const unsigned char*>(sData.c_str());
+    const auto uiBytes = static_cast<uint32_t>(sData.length());
+
+    CircularBuffer cCircularBuffer;
+    cCircularBuffer.SetCapacity(uiBytes);
+
+    // Move the head near the end of the buffer so the data wraps around
+    cCircularBuffer.Append(pucData, uiBytes - 5);
+    cCircularBuffer.Discard(uiBytes - 5);
+    cCircularBuffer.Append(pucData, uiBytes);
+
+    ASSERT_EQ(cCircularBuffer.CalculateCRC32(0, uiBytes, 0), CalculateBlockCRC32(uiBytes, 0, pucData));
+    ASSERT_EQ(cCircularBuffer.CalculateCRC32(3, 10, 0), CalculateBlockCRC32(10, 0, pucData + 3));
+    ASSERT_EQ(cCircularBuffer.CalculateCRC32(10, 100, 0), CalculateBlockCRC32(uiBytes - 10, 0, pucData + 10));
+    ASSERT_EQ(cCircularBuffer.CalculateCRC32(uiBytes, 1, 0x1234), 0x1234U);
+}
+
+TEST_F(CircularBufferTest, GET_CONTIGUOUS)
+{
+    const std::string sData("0123456789abcdefghijklmnopqrstuvwxyz");
+    const auto* pucData = reinterpret_cast<const unsigned char*>(sData.c_str());
+    const auto uiBytes = static_cast<uint32_t>(sData.length());
+
+    CircularBuffer cCircularBuffer;
+    cCircularBuffer.SetCapacity(uiBytes);
+
+    cCircularBuffer.Append(pucData, uiBytes - 5);
+    cCircularBuffer.Discard(uiBytes - 5);
+    cCircularBuffer.Append(pucData, uiBytes);
+
+    // Ranges before the wrap point are returned in place
+    const unsigned char* pucRange = cCircularBuffer.GetContiguous(1, 4);
+    ASSERT_NE(pucRange, nullptr);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(pucRange), 4), sData.substr(1, 4));
+
+    // Ranges after the wrap point are returned in place
+    pucRange = cCircularBuffer.GetContiguous(5, 10);
+    ASSERT_NE(pucRange, nullptr);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(pucRange), 10), sData.substr(5, 10));
+
+    // Ranges across the wrap point or past the data are not available
+    ASSERT_EQ(cCircularBuffer.GetContiguous(0, uiBytes), nullptr);
+    ASSERT_EQ(cCircularBuffer.GetContiguous(10, uiBytes), nullptr);
+}
+
+TEST_F(CircularBufferTest, MIRRORED)
+{
+    const std::string sData("0123456789abcdefghijklmnopqrstuvwxyz");
+    const auto* pucData = reinterpret_cast<const unsigned char*>(sData.c_str());
+    const auto uiBytes = static_cast<uint32_t>(sData.length());
+
+    CircularBuffer cCircularBuffer;
+    cCircularBuffer.Append(pucData, uiBytes);
+
+    // Existing data must survive switching the kind of memory
+    if (!cCircularBuffer.SetMirrored(true)) GTEST_SKIP() << "Mirrored buffers are not supported on this platform";
+    ASSERT_TRUE(cCircularBuffer.IsMirrored());
+    ASSERT_EQ(cCircularBuffer.GetLength(), uiBytes);
+    ASSERT_GE(cCircularBuffer.GetCapacity(), uiBytes);
+    ASSERT_EQ(cCircularBuffer.GetByte(0), '0');
+
+    // Fill the buffer repeatedly so the data wraps around the end of the mapping
+    const uint32_t uiCapacity = cCircularBuffer.GetCapacity();
+    cCircularBuffer.Discard(uiBytes);
+    for (uint32_t uiWritten = 0; uiWritten < 3 * uiCapacity; uiWritten += uiBytes)
+    {
+        ASSERT_EQ(cCircularBuffer.Append(pucData, uiBytes), uiBytes);
+
+        const unsigned char* pucRange = cCircularBuffer.GetContiguous(0, uiBytes);
+        ASSERT_NE(pucRange, nullptr);
+        ASSERT_EQ(std::string(reinterpret_cast<const char*>(pucRange), uiBytes), sData);
+        ASSERT_EQ(cCircularBuffer.CalculateCRC32(0, uiBytes, 0), CalculateBlockCRC32(uiBytes, 0, pucData));
+        ASSERT_EQ(cCircularBuffer.GetByte(static_cast<int32_t>(uiBytes - 1)), 'z');
+
+        cCircularBuffer.Discard(uiBytes);
+    }
+    ASSERT_EQ(cCircularBuffer.GetCapacity(), uiCapacity);
+
+    // Growing a mirrored buffer keeps it mirrored and keeps the data
+    cCircularBuffer.Append(pucData, uiBytes);
+    cCircularBuffer.SetCapacity(uiCapacity + 1);
+    ASSERT_TRUE(cCircularBuffer.IsMirrored());
+    ASSERT_GT(cCircularBuffer.GetCapacity(), uiCapacity);
+    ASSERT_EQ(cCircularBuffer.CalculateCRC32(0, uiBytes, 0), CalculateBlockCRC32(uiBytes, 0, pucData));
+
+    ASSERT_FALSE(cCircularBuffer.SetMirrored(false));
+    ASSERT_FALSE(cCircularBuffer.IsMirrored());
+    ASSERT_EQ(cCircularBuffer.CalculateCRC32(0, uiBytes, 0), CalculateBlockCRC32(uiBytes, 0, pucData));
+}
@@ -32,6 +32,9 @@
 //-----------------------------------------------------------------------
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include "decoders/common/api/common.hpp"
 #include "decoders/common/api/crc32.hpp"
 #include "decoders/novatel/api/common.hpp"
@@ -65,3 +68,39 @@ TEST_F(CRC32Test, CalculateBlockCRC32)
 
     ASSERT_EQ(uiCalculatedCRC, 0x42d4f5ccUL);
 }
+
+TEST_F(CRC32Test, BlockCRC32MatchesCharacterCRC32)
+{
+    std::vector<unsigned char> vData(4096);
+    for (size_t i = 0; i < vData.size(); i++) { vData[i] = static_cast<unsigned char>((i * 2654435761U) >> 13); }
+
+    // Cover every alignment and lengths either side of the engine block sizes
+    for (uint32_t uiOffset = 0; uiOffset < 16; uiOffset++)
+    {
+        for (uint32_t uiLength : {0U, 1U, 7U, 8U, 15U, 16U, 17U, 63U, 64U, 65U, 127U, 128U, 1000U, 4000U})
+        {
+            uint32_t uiExpectedCRC = 0;
+            for (uint32_t i = 0; i < uiLength; i++) { CalculateCharacterCRC32(uiExpectedCRC, vData[uiOffset + i]); }
+
+            ASSERT_EQ(CalculateBlockCRC32(uiLength, 0, vData.data() + uiOffset), uiExpectedCRC) << "offset " << uiOffset << " length " << uiLength;
+            ASSERT_EQ(CalculateBlockCRC32Slice8(uiLength, 0, vData.data() + uiOffset), uiExpectedCRC) << "offset " << uiOffset << " length " << uiLength;
+        }
+    }
+}
+
+TEST_F(CRC32Test, BlockCRC32Continuation)
+{
+    const std::string sData("The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.");
+    const auto* pucData = reinterpret_cast<const unsigned char*>(sData.data());
+    const auto uiLength = static_cast<uint32_t>(sData.length());
+
+    const uint32_t uiWholeCRC = CalculateBlockCRC32(uiLength, 0, pucData);
+    for (uint32_t uiSplit = 0; uiSplit <= uiLength; uiSplit++)
+    {
+        ASSERT_EQ(CalculateBlockCRC32(uiLength - uiSplit, CalculateBlockCRC32(uiSplit, 0, pucData), pucData + uiSplit), uiWholeCRC);
+    }
+
+    // Standard CRC-32 check value, once the pre and post inversion are applied
+    ASSERT_EQ(~CalculateBlockCRC32(9, 0xFFFFFFFF, reinterpret_cast<const unsigned char*>("123456789")), 0xCBF43926U);
+    ASSERT_NE(GetCRC32EngineName(), nullptr);
+}
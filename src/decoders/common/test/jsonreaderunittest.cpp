@@ -33,9 +33,12 @@
 #include <gtest/gtest.h>
 
 #include <filesystem>
+#include <fstream>
+#include <thread>
 
 #include "decoders/common/api/common.hpp"
 #include "decoders/common/api/jsonreader.hpp"
+#include "decoders/common/api/message_decoder.hpp"
 
 class JsonReaderTest : public testing::Test
 {
@@ -82,3 +85,306 @@ TEST_F(JsonReaderTest, AppendMessages)
     clJson.RemoveMessage(uiMsgID, true);
     ASSERT_EQ(clJson.GetMsgDef(uiMsgID), nullptr);
 }
+
+// -------------------------------------------------------------------------------------------------------
+// JsonReader Cache Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class JsonReaderCacheTest : public testing::Test
+{
+  protected:
+    std::filesystem::path clJsonPath = std::filesystem::temp_directory_path() / "jsonreader_cache_test.json";
+    std::filesystem::path clCachePath = std::filesystem::temp_directory_path() / "jsonreader_cache_test.json.cache";
+
+    static constexpr const char* szDatabase = R"({
+        "enums": [{
+            "_id": "Status", "name": "Status",
+            "enumerators": [
+                { "value": 0, "name": "OK", "description": "All good" }, { "value": 7, "name": "BAD", "description": null }
+            ]
+        }],
+        "messages": [{
+            "_id": "42", "messageID": 42, "name": "TESTMSG", "description": null, "latestMsgDefCrc": "2",
+            "fields": {
+                "1": [
+                    { "name": "status", "description": null, "type": "ENUM", "conversionString": "%s", "enumID": "Status",
+                      "dataType": { "name": "UINT", "length": 4, "description": null } }
+                ],
+                "2": [
+                    { "name": "status", "description": null, "type": "ENUM", "conversionString": "%s", "enumID": "Status",
+                      "dataType": { "name": "UINT", "length": 4, "description": null } },
+                    { "name": "id", "description": "An ID", "type": "STRING", "conversionString": "%s", "arrayLength": 16,
+                      "dataType": { "name": "CHAR", "length": 1, "description": null } },
+                    { "name": "obs", "description": null, "type": "FIELD_ARRAY", "conversionString": null, "arrayLength": 4,
+                      "dataType": { "name": "UNKNOWN", "length": 12, "description": null },
+                      "fields": [
+                          { "name": "psr", "description": null, "type": "SIMPLE", "conversionString": "%.3lf",
+                            "dataType": { "name": "DOUBLE", "length": 8, "description": null,
+                                          "enum": [{ "value": 1, "name": "ONE", "description": null }] } },
+                          { "name": "flags", "description": null, "type": "SIMPLE", "conversionString": "%08lx",
+                            "dataType": { "name": "ULONG", "length": 4, "description": null } }
+                      ]
+                    },
+                    { "name": "values", "description": null, "type": "VARIABLE_LENGTH_ARRAY", "conversionString": "%d", "arrayLength": 8,
+                      "dataType": { "name": "INT", "length": 4, "description": null } }
+                ]
+            }
+        }]
+    })";
+
+    void WriteJson(const std::string& strJson_) { std::ofstream(clJsonPath, std::ios::binary) << strJson_; }
+
+    void SetUp() override
+    {
+        std::filesystem::remove(clCachePath);
+        WriteJson(szDatabase);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(clJsonPath);
+        std::filesystem::remove(clCachePath);
+    }
+
+    static void ExpectSameFields(const std::vector<novatel::edie::BaseField*>& vExpected_, const std::vector<novatel::edie::BaseField*>& vActual_)
+    {
+        ASSERT_EQ(vExpected_.size(), vActual_.size());
+        for (size_t i = 0; i < vExpected_.size(); ++i)
+        {
+            const novatel::edie::BaseField& stExpected = *vExpected_[i];
+            const novatel::edie::BaseField& stActual = *vActual_[i];
+            ASSERT_EQ(stExpected.type, stActual.type);
+            ASSERT_EQ(stExpected.name, stActual.name);
+            ASSERT_EQ(stExpected.description, stActual.description);
+            ASSERT_EQ(stExpected.conversion, stActual.conversion);
+            ASSERT_EQ(stExpected.sConversionStripped, stActual.sConversionStripped);
+            ASSERT_EQ(stExpected.conversionHash, stActual.conversionHash);
+            ASSERT_EQ(stExpected.conversionBeforePoint, stActual.conversionBeforePoint);
+            ASSERT_EQ(stExpected.conversionAfterPoint, stActual.conversionAfterPoint);
+            ASSERT_EQ(stExpected.conversionFormat.cType, stActual.conversionFormat.cType);
+            ASSERT_EQ(stExpected.conversionFormat.ucWidth, stActual.conversionFormat.ucWidth);
+            ASSERT_EQ(stExpected.dataType.name, stActual.dataType.name);
+            ASSERT_EQ(stExpected.dataType.length, stActual.dataType.length);
+            ASSERT_EQ(stExpected.dataType.enums.size(), stActual.dataType.enums.size());
+
+            if (stExpected.type == novatel::edie::FIELD_TYPE::ENUM)
+            {
+                const auto& stExpectedEnum = dynamic_cast<const novatel::edie::EnumField&>(stExpected);
+                const auto& stActualEnum = dynamic_cast<const novatel::edie::EnumField&>(stActual);
+                ASSERT_EQ(stExpectedEnum.enumID, stActualEnum.enumID);
+                ASSERT_EQ(stExpectedEnum.length, stActualEnum.length);
+                ASSERT_NE(stActualEnum.enumDef, nullptr);
+                ASSERT_EQ(stExpectedEnum.enumDef->name, stActualEnum.enumDef->name);
+            }
+            else if (stExpected.type == novatel::edie::FIELD_TYPE::FIELD_ARRAY)
+            {
+                const auto& stExpectedArray = dynamic_cast<const novatel::edie::FieldArrayField&>(stExpected);
+                const auto& stActualArray = dynamic_cast<const novatel::edie::FieldArrayField&>(stActual);
+                ASSERT_EQ(stExpectedArray.arrayLength, stActualArray.arrayLength);
+                ASSERT_EQ(stExpectedArray.fieldSize, stActualArray.fieldSize);
+                ExpectSameFields(stExpectedArray.fields, stActualArray.fields);
+            }
+            else if (stExpected.type != novatel::edie::FIELD_TYPE::SIMPLE)
+            {
+                ASSERT_EQ(dynamic_cast<const novatel::edie::ArrayField&>(stExpected).arrayLength,
+                          dynamic_cast<const novatel::edie::ArrayField&>(stActual).arrayLength);
+            }
+        }
+    }
+};
+
+TEST_F(JsonReaderCacheTest, SaveAndLoad)
+{
+    JsonReader clJson;
+    clJson.LoadFile(clJsonPath.u32string());
+    clJson.SaveCache(clCachePath, clJsonPath);
+
+    JsonReader clCached;
+    ASSERT_TRUE(clCached.LoadCache(clCachePath, clJsonPath));
+
+    const novatel::edie::MessageDefinition* pstExpected = clJson.GetMsgDef(42);
+    const novatel::edie::MessageDefinition* pstActual = clCached.GetMsgDef(42);
+    ASSERT_NE(pstActual, nullptr);
+    ASSERT_EQ(pstActual, clCached.GetMsgDef("TESTMSG"));
+    ASSERT_EQ(pstExpected->_id, pstActual->_id);
+    ASSERT_EQ(pstExpected->description, pstActual->description);
+    ASSERT_EQ(pstExpected->latestMessageCrc, pstActual->latestMessageCrc);
+    ASSERT_EQ(pstExpected->fields.size(), pstActual->fields.size());
+    for (const auto& [uiCrc, vFields] : pstExpected->fields) { ExpectSameFields(vFields, pstActual->fields.at(uiCrc)); }
+
+    const novatel::edie::EnumDefinition* pstEnumDef = clCached.GetEnumDefName("Status");
+    ASSERT_NE(pstEnumDef, nullptr);
+    ASSERT_EQ(pstEnumDef, clCached.GetEnumDefID("Status"));
+    ASSERT_TRUE(pstEnumDef->HasIndexes());
+    ASSERT_EQ(pstEnumDef->FindValue(7)->name, "BAD");
+    ASSERT_EQ(pstEnumDef->FindName("OK")->value, 0U);
+    ASSERT_EQ(pstEnumDef->FindDescription("All good")->name, "OK");
+}
+
+TEST_F(JsonReaderCacheTest, InvalidatedByJsonChange)
+{
+    JsonReader clJson;
+    clJson.LoadFile(clJsonPath.u32string());
+    clJson.SaveCache(clCachePath, clJsonPath);
+
+    // Same size, different contents
+    std::string strChanged = szDatabase;
+    strChanged.replace(strChanged.find("TESTMSG"), 7, "TESTMSX");
+    WriteJson(strChanged);
+
+    JsonReader clCached;
+    ASSERT_FALSE(clCached.LoadCache(clCachePath, clJsonPath));
+    ASSERT_EQ(clCached.GetMsgDef(42), nullptr);
+
+    // Loading through the cache picks up the change and rewrites the cache
+    clCached.LoadFileCached(clJsonPath);
+    ASSERT_NE(clCached.GetMsgDef("TESTMSX"), nullptr);
+    ASSERT_TRUE(JsonReader().LoadCache(clCachePath, clJsonPath));
+}
+
+TEST_F(JsonReaderCacheTest, RejectsCorruptCache)
+{
+    ASSERT_FALSE(JsonReader().LoadCache(clCachePath, clJsonPath));
+
+    JsonReader clJson;
+    clJson.LoadFileCached(clJsonPath, clCachePath);
+    ASSERT_TRUE(std::filesystem::exists(clCachePath));
+
+    // Truncated
+    std::filesystem::resize_file(clCachePath, std::filesystem::file_size(clCachePath) - 1);
+    ASSERT_FALSE(clJson.LoadCache(clCachePath, clJsonPath));
+    ASSERT_NE(clJson.GetMsgDef(42), nullptr);
+
+    // Damaged payload
+    clJson.SaveCache(clCachePath, clJsonPath);
+    {
+        std::fstream clCache(clCachePath, std::ios::binary | std::ios::in | std::ios::out);
+        clCache.seekp(-4, std::ios::end);
+        clCache.put('\x5A');
+    }
+    ASSERT_FALSE(JsonReader().LoadCache(clCachePath, clJsonPath));
+
+    // Damaged payload that still reads as a valid DB
+    clJson.SaveCache(clCachePath, clJsonPath);
+    {
+        std::ifstream clIn(clCachePath, std::ios::binary);
+        std::string strCache((std::istreambuf_iterator<char>(clIn)), std::istreambuf_iterator<char>());
+        clIn.close();
+        const size_t ullName = strCache.find("TESTMSG");
+        ASSERT_NE(ullName, std::string::npos);
+        strCache[ullName + 6] = 'X';
+        std::ofstream(clCachePath, std::ios::binary | std::ios::trunc).write(strCache.data(), static_cast<std::streamsize>(strCache.size()));
+    }
+    ASSERT_FALSE(JsonReader().LoadCache(clCachePath, clJsonPath));
+}
+
+// -------------------------------------------------------------------------------------------------------
+// JsonReader Lazy Loading Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class JsonReaderLazyTest : public JsonReaderCacheTest
+{
+};
+
+TEST_F(JsonReaderLazyTest, BuildsOnFirstUse)
+{
+    JsonReader clJson;
+    clJson.LoadFile(clJsonPath.u32string());
+
+    JsonReader clLazy;
+    clLazy.LoadFileLazy(clJsonPath);
+    ASSERT_TRUE(clLazy.GetMessageDefinitions().empty());
+    ASSERT_NE(clLazy.GetEnumDefName("Status"), nullptr);
+    ASSERT_EQ(clLazy.GetMsgDef(43), nullptr);
+    ASSERT_EQ(clLazy.GetMsgDef("NOTAMSG"), nullptr);
+
+    const novatel::edie::MessageDefinition* pstActual = clLazy.GetMsgDef("TESTMSG");
+    ASSERT_NE(pstActual, nullptr);
+    ASSERT_EQ(pstActual, clLazy.GetMsgDef(42));
+    ASSERT_EQ(clLazy.MsgNameToMsgId("TESTMSGB"), clJson.MsgNameToMsgId("TESTMSGB"));
+    ASSERT_EQ(clLazy.MsgIdToMsgName(clJson.MsgNameToMsgId("TESTMSGA_1")), "TESTMSGA_1");
+
+    const novatel::edie::MessageDefinition* pstExpected = clJson.GetMsgDef(42);
+    ASSERT_EQ(pstExpected->latestMessageCrc, pstActual->latestMessageCrc);
+    ASSERT_EQ(pstExpected->fields.size(), pstActual->fields.size());
+    for (const auto& [uiCrc, vFields] : pstExpected->fields) { ExpectSameFields(vFields, pstActual->fields.at(uiCrc)); }
+
+    // Copies keep the index and build their own definitions
+    JsonReader clCopy(clLazy);
+    ASSERT_NE(clCopy.GetMsgDef(42), nullptr);
+    ASSERT_NE(clCopy.GetMsgDef(42), pstActual);
+
+    clLazy.RemoveMessage(42);
+    ASSERT_EQ(clLazy.GetMsgDef(42), nullptr);
+    ASSERT_EQ(clLazy.GetMsgDef("TESTMSG"), nullptr);
+}
+
+TEST_F(JsonReaderLazyTest, EnumsAppendedAfterFirstUse)
+{
+    class DecoderTester : public novatel::edie::MessageDecoderBase
+    {
+      public:
+        DecoderTester(JsonReader* pclJsonDb_) : MessageDecoderBase(pclJsonDb_) {}
+
+        novatel::edie::STATUS TestDecodeAscii(const std::vector<novatel::edie::BaseField*>& MsgDefFields_, const char* pcLogBuf_,
+                                              std::vector<novatel::edie::FieldContainer>& vIntermediateFormat_)
+        {
+            return DecodeAscii<false>(MsgDefFields_, const_cast<char**>(&pcLogBuf_), vIntermediateFormat_);
+        }
+    };
+
+    JsonReader clLazy;
+    clLazy.LoadFileLazy(clJsonPath);
+    const novatel::edie::MessageDefinition* pstMsgDef = clLazy.GetMsgDef(42);
+    ASSERT_NE(pstMsgDef, nullptr);
+
+    // Appending moves the enums the lazily built definition points into
+    const std::filesystem::path clEnumsPath = std::filesystem::temp_directory_path() / "jsonreader_lazy_test_enums.json";
+    std::ofstream(clEnumsPath, std::ios::binary)
+        << R"({ "enums": [{ "_id": "Other", "name": "Other", "enumerators": [{ "value": 1, "name": "ONE", "description": null }] }] })";
+    clLazy.AppendEnumerations(clEnumsPath.string());
+    std::filesystem::remove(clEnumsPath);
+
+    const std::vector<novatel::edie::BaseField*>& vFields = pstMsgDef->fields.at(2);
+    ASSERT_EQ(dynamic_cast<const novatel::edie::EnumField*>(vFields[0])->enumDef, clLazy.GetEnumDefID("Status"));
+
+    DecoderTester clDecoder(&clLazy);
+    std::vector<novatel::edie::FieldContainer> vIntermediateFormat;
+    ASSERT_EQ(clDecoder.TestDecodeAscii({vFields[0]}, "BAD", vIntermediateFormat), novatel::edie::STATUS::SUCCESS);
+    ASSERT_EQ(vIntermediateFormat.size(), 1U);
+    ASSERT_EQ(std::get<int32_t>(vIntermediateFormat[0].field_value), 7);
+}
+
+TEST_F(JsonReaderLazyTest, ConcurrentFirstUse)
+{
+    JsonReader clLazy;
+    clLazy.LoadFileLazy(clJsonPath);
+
+    std::vector<const novatel::edie::MessageDefinition*> vMsgDefs(8, nullptr);
+    std::vector<std::thread> vThreads;
+    for (size_t i = 0; i < vMsgDefs.size(); ++i)
+    {
+        vThreads.emplace_back([&clLazy, &vMsgDefs, i] { vMsgDefs[i] = clLazy.GetMsgDef(42); });
+    }
+    for (std::thread& clThread : vThreads) { clThread.join(); }
+
+    ASSERT_NE(vMsgDefs[0], nullptr);
+    for (const novatel::edie::MessageDefinition* pstMsgDef : vMsgDefs) { ASSERT_EQ(pstMsgDef, vMsgDefs[0]); }
+}
+
+TEST_F(JsonReaderLazyTest, SaveCache)
+{
+    JsonReader clLazy;
+    clLazy.LoadFileLazy(clJsonPath);
+    clLazy.SaveCache(clCachePath, clJsonPath);
+
+    JsonReader clCached;
+    ASSERT_TRUE(clCached.LoadCache(clCachePath, clJsonPath));
+    ASSERT_EQ(clCached.GetMessageDefinitions().size(), 1U);
+    ASSERT_NE(clCached.GetMsgDef("TESTMSG"), nullptr);
+}
+
+TEST_F(JsonReaderLazyTest, MalformedJson)
+{
+    WriteJson(R"({ "enums": [], "messages": [ { "_id": "1", "messageID": 1, "name": "A" )");
+    JsonReader clLazy;
+    ASSERT_THROW(clLazy.LoadFileLazy(clJsonPath), novatel::edie::JsonReaderFailure);
+}
@@ -32,6 +32,12 @@
 //-----------------------------------------------------------------------
 #include <gtest/gtest.h>
 
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <thread>
+
+#include "decoders/common/api/encoder.hpp"
 #include "decoders/common/api/message_decoder.hpp"
 
 using namespace novatel::edie;
@@ -44,13 +50,13 @@ class MessageDecoderTypesTest : public ::testing::Test
       public:
         DecoderTester(JsonReader* pclJsonDb_) : MessageDecoderBase(pclJsonDb_) {}
 
-        STATUS TestDecodeAscii(const std::vector<BaseField*> MsgDefFields_, const char** ppcLogBuf_,
+        STATUS TestDecodeAscii(const std::vector<BaseField*>& MsgDefFields_, const char** ppcLogBuf_,
                                std::vector<FieldContainer>& vIntermediateFormat_)
         {
             return DecodeAscii<false>(MsgDefFields_, const_cast<char**>(ppcLogBuf_), vIntermediateFormat_);
         }
 
-        STATUS TestDecodeBinary(const std::vector<BaseField*> MsgDefFields_, unsigned char** ppucLogBuf_,
+        STATUS TestDecodeBinary(const std::vector<BaseField*>& MsgDefFields_, unsigned char** ppucLogBuf_,
                                 std::vector<FieldContainer>& vIntermediateFormat_)
         {
             uint16_t MsgDefFieldsSize = 0;
@@ -58,6 +64,23 @@ class MessageDecoderTypesTest : public ::testing::Test
             return DecodeBinary(MsgDefFields_, ppucLogBuf_, vIntermediateFormat_, MsgDefFieldsSize);
         }
 
+        STATUS TestDecodeAscii(const std::vector<BaseField*>& MsgDefFields_, const char** ppcLogBuf_, FlatIntermediateMessage& stFlatMessage_)
+        {
+            stFlatMessage_.clear();
+            FlatFieldWriter clWriter(stFlatMessage_);
+            return DecodeAscii<false>(MsgDefFields_, const_cast<char**>(ppcLogBuf_), clWriter);
+        }
+
+        STATUS TestDecodeBinary(const std::vector<BaseField*>& MsgDefFields_, unsigned char** ppucLogBuf_, uint32_t uiMessageLength_,
+                                FlatIntermediateMessage& stFlatMessage_)
+        {
+            stFlatMessage_.clear();
+            FlatFieldWriter clWriter(stFlatMessage_);
+            return DecodeBinary(MsgDefFields_, ppucLogBuf_, clWriter, uiMessageLength_);
+        }
+
+        DecodePlan TestCompilePlan(const std::vector<BaseField*>& MsgDefFields_) const { return CompilePlan(MsgDefFields_); }
+
         template <typename T, DATA_TYPE D> void ValidSimpleASCIIHelper(std::vector<std::string> vstrTestInput, std::vector<T> vTargets)
         {
             // this test expects the virst two values in the test input to be the min and max, respectively
@@ -130,6 +153,28 @@ class MessageDecoderTypesTest : public ::testing::Test
         }
     };
 
+    class EncoderTester : public EncoderBase
+    {
+      public:
+        template <typename T> std::string TestEncodeAsciiBody(const T& stMessage_)
+        {
+            char acBuffer[MAX_ASCII_MESSAGE_LENGTH];
+            char* pcBuffer = acBuffer;
+            uint32_t uiBytesLeft = sizeof(acBuffer);
+            if (!EncodeAsciiBody<false>(stMessage_, &pcBuffer, uiBytesLeft)) { return ""; }
+            return {acBuffer, pcBuffer};
+        }
+
+        template <typename T> std::string TestEncodeBinaryBody(const T& stMessage_)
+        {
+            alignas(8) unsigned char aucBuffer[MAX_ASCII_MESSAGE_LENGTH];
+            unsigned char* pucBuffer = aucBuffer;
+            uint32_t uiBytesLeft = sizeof(aucBuffer);
+            if (!EncodeBinaryBody<false>(stMessage_, &pucBuffer, uiBytesLeft)) { return ""; }
+            return {reinterpret_cast<char*>(aucBuffer), reinterpret_cast<char*>(pucBuffer)};
+        }
+    };
+
   public:
     std::unique_ptr<JsonReader> pclMyJsonDb;
     std::unique_ptr<DecoderTester> pclMyDecoderTester;
@@ -302,6 +347,257 @@ TEST_F(MessageDecoderTypesTest, ASCII_ENUM_VALID)
     for (size_t sz = 0; sz < vTestInput.size(); ++sz) ASSERT_EQ(std::get<int32_t>(vIntermediateFormat[sz].field_value), vTestInput[sz].second);
 }
 
+TEST_F(MessageDecoderTypesTest, ENUM_INDEX_LOOKUP)
+{
+    for (uint32_t uiOffset : {0U, 100000U}) // dense and sparse value tables
+    {
+        EnumDefinition stEnumDef;
+        for (const auto& [name, description, value] : std::vector<std::tuple<std::string, std::string, uint32_t>>{
+                 {"SATTIME", "Satellite time", 12}, {"UNKNOWN", "Unknown", 2}, {"APPROXIMATE", "Approximate", 6}, {"ALIAS", "Unknown", 2}})
+        {
+            EnumDataType stEnum;
+            stEnum.name = name;
+            stEnum.description = description;
+            stEnum.value = value + uiOffset;
+            stEnumDef.enumerators.push_back(stEnum);
+        }
+
+        for (bool bIndexed : {false, true})
+        {
+            if (bIndexed) { stEnumDef.BuildIndexes(); }
+            ASSERT_EQ(stEnumDef.HasIndexes(), bIndexed);
+            if (bIndexed) { ASSERT_EQ(stEnumDef.bDenseValues, uiOffset == 0); }
+
+            ASSERT_EQ(GetEnumValue(&stEnumDef, std::string_view("APPROXIMATEX", 11)), static_cast<int32_t>(6 + uiOffset));
+            ASSERT_EQ(GetEnumValue(&stEnumDef, "ALIAS"), static_cast<int32_t>(2 + uiOffset));
+            ASSERT_EQ(GetEnumValue(&stEnumDef, "MISSING"), 0);
+            ASSERT_EQ(GetEnumString(&stEnumDef, 12 + uiOffset), "SATTIME");
+            ASSERT_EQ(GetEnumString(&stEnumDef, 2 + uiOffset), "UNKNOWN"); // first definition of a duplicated value wins
+            ASSERT_EQ(GetEnumString(&stEnumDef, 3 + uiOffset), "UNKNOWN");
+            ASSERT_EQ(GetEnumString(&stEnumDef, 6 + uiOffset), "APPROXIMATE");
+            ASSERT_EQ(GetResponseId(&stEnumDef, "Satellite time"), static_cast<int32_t>(12 + uiOffset));
+            ASSERT_EQ(GetResponseId(&stEnumDef, "Unknown"), static_cast<int32_t>(2 + uiOffset));
+            ASSERT_EQ(GetResponseId(&stEnumDef, "Missing"), 0);
+        }
+
+        // Indexes refer to positions, so they stay valid in a copy.
+        const EnumDefinition stCopy = stEnumDef;
+        ASSERT_EQ(GetEnumString(&stCopy, 12 + uiOffset), "SATTIME");
+        ASSERT_EQ(GetEnumString(&stCopy, 12 + uiOffset).data(), stCopy.enumerators[0].name.data());
+    }
+
+    ASSERT_EQ(GetEnumString(nullptr, 1), "UNKNOWN");
+    ASSERT_EQ(GetEnumValue(nullptr, "SATTIME"), 0);
+}
+
+TEST_F(MessageDecoderTypesTest, ASCII_NUMBER_PARSING)
+{
+    // Every token must parse to exactly what the strto* functions give
+    const std::vector<std::string> vTokens = {"0", "42", "+42", "-42", "007", "1.5", "-0.25", "+.5", "1e5", "-1.5E-3", "inf", "nan", "0x1F",
+                                              "0X1f", "+0x1F", "-0x1F", "0x", "0x-5", "+-5", " 7", "", "abc", "1f", "-1", "65536", "4294967296",
+                                              "18446744073709551616", "1e999", "1e-999", "4e-320", "0x1p3"};
+
+    for (const std::string& strToken : vTokens)
+    {
+        SCOPED_TRACE(strToken);
+        const std::string strBuffer = strToken + ",1*";
+        const char* pcToken = strBuffer.c_str();
+        const size_t ullTokenLength = strToken.size();
+
+        ASSERT_EQ(ParseAsciiNumber<int8_t>(pcToken, ullTokenLength), static_cast<int8_t>(strtol(pcToken, nullptr, 10)));
+        ASSERT_EQ(ParseAsciiNumber<int32_t>(pcToken, ullTokenLength), static_cast<int32_t>(strtol(pcToken, nullptr, 10)));
+        ASSERT_EQ(ParseAsciiNumber<int64_t>(pcToken, ullTokenLength), static_cast<int64_t>(strtoll(pcToken, nullptr, 10)));
+        ASSERT_EQ(ParseAsciiNumber<uint16_t>(pcToken, ullTokenLength), static_cast<uint16_t>(strtoul(pcToken, nullptr, 10)));
+        ASSERT_EQ(ParseAsciiNumber<uint32_t>(pcToken, ullTokenLength), static_cast<uint32_t>(strtoul(pcToken, nullptr, 10)));
+        ASSERT_EQ(ParseAsciiNumber<uint64_t>(pcToken, ullTokenLength), static_cast<uint64_t>(strtoull(pcToken, nullptr, 10)));
+        ASSERT_EQ((ParseAsciiNumber<uint8_t, 16>(pcToken, ullTokenLength)), static_cast<uint8_t>(strtoul(pcToken, nullptr, 16)));
+        ASSERT_EQ((ParseAsciiNumber<uint32_t, 16>(pcToken, ullTokenLength)), static_cast<uint32_t>(strtoul(pcToken, nullptr, 16)));
+        ASSERT_EQ((ParseAsciiNumber<int32_t, 16>(pcToken, ullTokenLength)), static_cast<int32_t>(strtol(pcToken, nullptr, 16)));
+
+        // Compare the bit patterns so that NaN compares equal to itself
+        const float fExpected = strtof(pcToken, nullptr);
+        const float fActual = ParseAsciiNumber<float>(pcToken, ullTokenLength);
+        ASSERT_EQ(memcmp(&fExpected, &fActual, sizeof(float)), 0);
+        const double dExpected = strtod(pcToken, nullptr);
+        const double dActual = ParseAsciiNumber<double>(pcToken, ullTokenLength);
+        ASSERT_EQ(memcmp(&dExpected, &dActual, sizeof(double)), 0);
+    }
+}
+
+TEST_F(MessageDecoderTypesTest, CONVERSION_FORMAT_PARSING)
+{
+    constexpr ConversionFormat stFormat = ConversionFormat::Parse("%+08.3lf");
+    ASSERT_EQ(stFormat.cType, 'f');
+    ASSERT_EQ(stFormat.cLength, 'l');
+    ASSERT_TRUE(stFormat.bZeroPad);
+    ASSERT_TRUE(stFormat.bPlusSign);
+    ASSERT_EQ(stFormat.ucWidth, 8);
+    ASSERT_EQ(stFormat.cPrecision, 3);
+
+    ASSERT_EQ(ConversionFormat::Parse("%hhu").cLength, 'H');
+    ASSERT_EQ(ConversionFormat::Parse("%llx").cLength, 'L');
+    ASSERT_EQ(ConversionFormat::Parse("%e").cPrecision, 6);
+
+    // Conversions that have to be printed with printf
+    for (const char* szConversion : {"", "%", "%s", "%c", "%-5d", "%5.2d", "%Lf", "%hf", "%d,", "x%d", "%123d", "%.123f", "%k", "%lk"})
+    {
+        SCOPED_TRACE(szConversion);
+        ASSERT_EQ(ConversionFormat::Parse(szConversion).cType, '\0');
+    }
+}
+
+TEST_F(MessageDecoderTypesTest, FORMAT_MATCHES_PRINTF)
+{
+    // Every value must format to exactly what PrintToBuffer (vsnprintf) gives
+    const auto TestFormat = [](const char* szConversion_, auto tValue_) {
+        char acExpected[512];
+        char acActual[512];
+        char* pcExpected = acExpected;
+        char* pcActual = acActual;
+        uint32_t uiExpectedLeft = sizeof(acExpected);
+        uint32_t uiActualLeft = sizeof(acActual);
+
+        ASSERT_TRUE(PrintToBuffer(&pcExpected, uiExpectedLeft, szConversion_, tValue_));
+        ASSERT_TRUE(FormatToBuffer(&pcActual, uiActualLeft, ConversionFormat::Parse(szConversion_), szConversion_, tValue_));
+        ASSERT_EQ(std::string(acActual), std::string(acExpected)) << szConversion_ << " " << +tValue_;
+        ASSERT_EQ(uiActualLeft, uiExpectedLeft);
+    };
+
+    std::mt19937_64 clRandom(12345);
+
+    const std::vector<const char*> vIntegerConversions = {"%d",   "%i",   "%u",   "%x",    "%X",   "%02x", "%04x", "%08lx", "%lx",
+                                                          "%ld",  "%lu",  "%hd",  "%hu",   "%hhd", "%hhu", "%lld", "%llu",  "%llx",
+                                                          "%+d",  "%+u",  "%5d",  "%05d",  "%+05d", "%12u", "%-5d", "%5.2d"};
+    std::vector<int64_t> vIntegers = {0,          1,           -1,         42,         -42,        127,       -128,      255,
+                                      256,        32767,       -32768,     65535,      65536,      INT32_MAX, INT32_MIN, UINT32_MAX,
+                                      0x08109c04, -0x08109c04, INT64_MAX, INT64_MIN, 1000000007};
+    for (int32_t i = 0; i < 200; ++i) { vIntegers.push_back(static_cast<int64_t>(clRandom() >> (clRandom() % 64))); }
+
+    for (const char* szConversion : vIntegerConversions)
+    {
+        // Only pass 64-bit values to 64-bit conversions, where what printf reads is well-defined
+        const bool bLong = strchr(szConversion, 'l') != nullptr;
+        for (const int64_t llValue : vIntegers)
+        {
+            if (bLong)
+            {
+                TestFormat(szConversion, llValue);
+                TestFormat(szConversion, static_cast<uint64_t>(llValue));
+                continue;
+            }
+            TestFormat(szConversion, static_cast<int8_t>(llValue));
+            TestFormat(szConversion, static_cast<uint8_t>(llValue));
+            TestFormat(szConversion, static_cast<int16_t>(llValue));
+            TestFormat(szConversion, static_cast<uint16_t>(llValue));
+            TestFormat(szConversion, static_cast<int32_t>(llValue));
+            TestFormat(szConversion, static_cast<uint32_t>(llValue));
+        }
+    }
+
+    // The database uses long conversions for 32-bit fields, which must print as the 32-bit value
+    for (const int64_t llValue : vIntegers)
+    {
+        const auto uiValue = static_cast<uint32_t>(llValue);
+        const auto iValue = static_cast<int32_t>(llValue & INT32_MAX);
+        for (const auto& [szLongConversion, szConversion] : {std::pair{"%lx", "%x"}, {"%08lx", "%08x"}, {"%lu", "%u"}, {"%llu", "%u"}})
+        {
+            char acExpected[32];
+            char acActual[32];
+            char* pcActual = acActual;
+            uint32_t uiActualLeft = sizeof(acActual);
+            snprintf(acExpected, sizeof(acExpected), szConversion, uiValue);
+            ASSERT_TRUE(FormatToBuffer(&pcActual, uiActualLeft, ConversionFormat::Parse(szLongConversion), szLongConversion, uiValue));
+            ASSERT_STREQ(acActual, acExpected);
+        }
+        char acExpected[32];
+        char acActual[32];
+        char* pcActual = acActual;
+        uint32_t uiActualLeft = sizeof(acActual);
+        snprintf(acExpected, sizeof(acExpected), "%d", iValue);
+        ASSERT_TRUE(FormatToBuffer(&pcActual, uiActualLeft, ConversionFormat::Parse("%ld"), "%ld", iValue));
+        ASSERT_STREQ(acActual, acExpected);
+    }
+
+    const std::vector<const char*> vFloatConversions = {"%f",   "%lf",   "%.0f", "%.1f",   "%.3f",   "%.3lf", "%.9lf",  "%.17f", "%e",
+                                                        "%.0e", "%.3e",  "%.8e", "%10.2f", "%010.2f", "%+.2f", "%+08.3f", "%15.4e", "%g"};
+    std::vector<double> vFloats = {0.0,     -0.0,     0.5,      1.5,      2.5,      -2.5,    0.125,    0.0005,   -0.0005,   1e-7,
+                                   -1e-7,   9.9995,   0.0015,   1e20,     1e300,    -1e300,  5e-324,   FLT_MAX,  FLT_MIN,   DBL_MAX,
+                                   49.5,    5765.438, -3042.213, 20977560.237, -110237398.651, 244820.0, 0.044, NAN, -NAN, INFINITY,
+                                   -INFINITY};
+    for (int32_t i = 0; i < 200; ++i)
+    {
+        const auto dMantissa = static_cast<double>(static_cast<int64_t>(clRandom())) / static_cast<double>(INT64_MAX);
+        vFloats.push_back(std::ldexp(dMantissa, static_cast<int32_t>(clRandom() % 80) - 40));
+        vFloats.push_back(std::round(dMantissa * 1e9) / 1000.0);
+    }
+
+    for (const char* szConversion : vFloatConversions)
+    {
+        for (const double dValue : vFloats)
+        {
+            TestFormat(szConversion, static_cast<float>(dValue));
+            TestFormat(szConversion, dValue);
+        }
+    }
+}
+
+TEST_F(MessageDecoderTypesTest, JSON_KEY_MATCHES_PRINTF)
+{
+    for (const char* szOpening : {"", "[", "\""})
+    {
+        char acExpected[32];
+        char acActual[32];
+        char* pcActual = acActual;
+        uint32_t uiActualLeft = sizeof(acActual);
+        const int32_t iExpectedLength = snprintf(acExpected, sizeof(acExpected), R"("%s": %s)", "psr_std", szOpening);
+        ASSERT_TRUE(PrintJsonKeyToBuffer(&pcActual, uiActualLeft, "psr_std", szOpening));
+        ASSERT_EQ(std::string(acActual, pcActual), std::string(acExpected));
+        ASSERT_EQ(uiActualLeft, sizeof(acActual) - static_cast<uint32_t>(iExpectedLength));
+    }
+
+    // The key must fit entirely
+    char acBuffer[8];
+    char* pcBuffer = acBuffer;
+    uint32_t uiBytesLeft = sizeof(acBuffer);
+    ASSERT_FALSE(PrintJsonKeyToBuffer(&pcBuffer, uiBytesLeft, "psr_std", "["));
+    ASSERT_EQ(pcBuffer, acBuffer);
+}
+
+TEST_F(MessageDecoderTypesTest, ADAPTIVE_FORMAT_MATCHES_PRINTF)
+{
+    // %k and %lk must format to exactly what the conversion string from MakeConversionString gives
+    const auto TestFormat = [](const BaseField& stField_, auto tValue_) {
+        using T = decltype(tValue_);
+        const FieldContainer stField(tValue_, &stField_);
+        char acExpected[512];
+        char acActual[512];
+        char* pcExpected = acExpected;
+        char* pcActual = acActual;
+        uint32_t uiExpectedLeft = sizeof(acExpected);
+        uint32_t uiActualLeft = sizeof(acActual);
+
+        ASSERT_TRUE(PrintToBuffer(&pcExpected, uiExpectedLeft, MakeConversionString<T>(stField).data(), tValue_));
+        ASSERT_TRUE(FormatAdaptiveToBuffer<T>(&pcActual, uiActualLeft, stField));
+        ASSERT_EQ(std::string(acActual), std::string(acExpected)) << stField_.conversion << " " << tValue_;
+        ASSERT_EQ(uiActualLeft, uiExpectedLeft);
+    };
+
+    const std::vector<double> vValues = {0.0,    -0.0,     1e-9,   -1e-9,    0.001,  0.0049, 0.05,     0.5,       1.0,     9.99,
+                                         9.999,  10.0,     10.001, -12.345,  99.5,   100.0,  1234.5678, -98765.4321, 1e10, -1e10,
+                                         1e-30,  3.14159,  FLT_EPSILON, DBL_EPSILON, NAN, INFINITY, -INFINITY};
+
+    for (const char* szConversion : {"%k", "%2.1k", "%3.2k", "%8.3k", "%0.1k", "%1.0k", "%lk", "%2.1lk", "%12.4lk", "%7.9lk"})
+    {
+        BaseField stFloatField("FLOAT", FIELD_TYPE::SIMPLE, szConversion, 4, DATA_TYPE::FLOAT);
+        BaseField stDoubleField("DOUBLE", FIELD_TYPE::SIMPLE, szConversion, 8, DATA_TYPE::DOUBLE);
+        for (const double dValue : vValues)
+        {
+            TestFormat(stFloatField, static_cast<float>(dValue));
+            TestFormat(stDoubleField, dValue);
+        }
+    }
+}
+
 TEST_F(MessageDecoderTypesTest, ASCII_STRING_VALID)
 {
     MsgDefFields.emplace_back(new BaseField("MESSAGE", FIELD_TYPE::STRING, "", 1, DATA_TYPE::UNKNOWN));
@@ -416,3 +712,152 @@ TEST_F(MessageDecoderTypesTest, SIMPLE_FIELD_WIDTH_VALID)
     //ASSERT_NEAR(std::get<float>(vIntermediateFormat.at(sz++).field_value), 2.54, 0.001);
     //ASSERT_NEAR(std::get<double>(vIntermediateFormat.at(sz++).field_value), 5.44061788e+03, 0.000001);
 }
+
+TEST_F(MessageDecoderTypesTest, FLAT_MESSAGE_MATCHES_INTERMEDIATE_MESSAGE)
+{
+    auto* pclFieldArray = new FieldArrayField();
+    pclFieldArray->name = "OBS";
+    pclFieldArray->type = FIELD_TYPE::FIELD_ARRAY;
+    pclFieldArray->arrayLength = 4;
+    pclFieldArray->dataType.length = 4;
+    pclFieldArray->fields.emplace_back(new BaseField("PRN", FIELD_TYPE::SIMPLE, "%lu", 4, DATA_TYPE::ULONG));
+    pclFieldArray->fields.emplace_back(new BaseField("PSR", FIELD_TYPE::SIMPLE, "%lf", 8, DATA_TYPE::DOUBLE));
+
+    MsgDefFields.emplace_back(new BaseField("WEEK", FIELD_TYPE::SIMPLE, "%lu", 4, DATA_TYPE::ULONG));
+    MsgDefFields.emplace_back(new BaseField("NAME", FIELD_TYPE::STRING, "%s", 1, DATA_TYPE::CHAR));
+    MsgDefFields.emplace_back(pclFieldArray);
+    MsgDefFields.emplace_back(new BaseField("STATUS", FIELD_TYPE::SIMPLE, "%ld", 4, DATA_TYPE::LONG));
+
+    const char* const szInput = "2209,\"a string that is longer than SSO\",3,1,2.5,2,-3.25,17,100.125,-42";
+
+    IntermediateMessage vIntermediateFormat;
+    vIntermediateFormat.reserve(MsgDefFields.size());
+    const char* pcInput = szInput;
+    ASSERT_EQ(STATUS::SUCCESS, pclMyDecoderTester->TestDecodeAscii(MsgDefFields, &pcInput, vIntermediateFormat));
+
+    FlatIntermediateMessage stFlatMessage;
+    pcInput = szInput;
+    ASSERT_EQ(STATUS::SUCCESS, pclMyDecoderTester->TestDecodeAscii(MsgDefFields, &pcInput, stFlatMessage));
+
+    // 4 top level fields, 3 array elements with 2 fields each
+    ASSERT_EQ(stFlatMessage.GetFields().size(), 4U);
+    ASSERT_EQ(stFlatMessage.size(), 4U + 3U + 3U * 2U);
+
+    auto it = stFlatMessage.GetFields().begin();
+    ASSERT_EQ(GetFieldValue<uint32_t>(*it), 2209U);
+    ASSERT_STREQ(GetFieldString(*++it), "a string that is longer than SSO");
+    const FlatFieldRange clObservations = GetArrayField(*++it);
+    ASSERT_EQ(clObservations.size(), 3U);
+    auto itObs = clObservations.begin();
+    ++itObs;
+    const FlatFieldRange clSecond = GetArrayField(*itObs);
+    ASSERT_EQ(GetFieldValue<uint32_t>(*clSecond.begin()), 2U);
+    ASSERT_EQ(GetFieldValue<int32_t>(*++it), -42);
+    ASSERT_THROW(GetFieldValue<int32_t>(*stFlatMessage.GetFields().begin()), std::bad_variant_access);
+
+    // Both representations must encode identically
+    EncoderTester clEncoder;
+    ASSERT_EQ(clEncoder.TestEncodeAsciiBody(vIntermediateFormat), clEncoder.TestEncodeAsciiBody(stFlatMessage.GetFields()));
+
+    const std::string strBinary = clEncoder.TestEncodeBinaryBody(vIntermediateFormat);
+    ASSERT_FALSE(strBinary.empty());
+    ASSERT_EQ(strBinary, clEncoder.TestEncodeBinaryBody(stFlatMessage.GetFields()));
+
+    // Decoding the binary again into the same flat message reuses it from scratch
+    alignas(8) unsigned char aucBinary[MAX_ASCII_MESSAGE_LENGTH];
+    memcpy(aucBinary, strBinary.data(), strBinary.size());
+    unsigned char* pucBinary = aucBinary;
+    ASSERT_EQ(STATUS::SUCCESS,
+              pclMyDecoderTester->TestDecodeBinary(MsgDefFields, &pucBinary, static_cast<uint32_t>(strBinary.size()), stFlatMessage));
+    ASSERT_EQ(stFlatMessage.size(), 4U + 3U + 3U * 2U);
+    ASSERT_EQ(clEncoder.TestEncodeAsciiBody(vIntermediateFormat), clEncoder.TestEncodeAsciiBody(stFlatMessage.GetFields()));
+}
+
+TEST_F(MessageDecoderTypesTest, CONCURRENT_DECODERS_AND_ENCODERS)
+{
+    MsgDefFields.emplace_back(new BaseField("WEEK", FIELD_TYPE::SIMPLE, "%lu", 4, DATA_TYPE::ULONG));
+    MsgDefFields.emplace_back(new BaseField("FLAGS", FIELD_TYPE::SIMPLE, "%XB", 1, DATA_TYPE::HEXBYTE));
+    MsgDefFields.emplace_back(new BaseField("OFFSET", FIELD_TYPE::SIMPLE, "%B", 1, DATA_TYPE::CHAR));
+    MsgDefFields.emplace_back(new BaseField("PSR", FIELD_TYPE::SIMPLE, "%lf", 8, DATA_TYPE::DOUBLE));
+
+    const char* const szInput = "2209,a5,-12,21042318.125";
+
+    IntermediateMessage vReference;
+    vReference.reserve(MsgDefFields.size());
+    const char* pcInput = szInput;
+    ASSERT_EQ(STATUS::SUCCESS, pclMyDecoderTester->TestDecodeAscii(MsgDefFields, &pcInput, vReference));
+    const std::string strReference = EncoderTester().TestEncodeAsciiBody(vReference);
+    ASSERT_FALSE(strReference.empty());
+
+    // Decoders and encoders constructed on several threads share their field tables and the database
+    constexpr uint32_t uiThreads = 8;
+    std::atomic<uint32_t> uiMismatches{0};
+    std::vector<std::thread> vThreads;
+    for (uint32_t uiThread = 0; uiThread < uiThreads; ++uiThread)
+    {
+        vThreads.emplace_back([&] {
+            for (uint32_t uiIteration = 0; uiIteration < 50; ++uiIteration)
+            {
+                DecoderTester clDecoder(pclMyJsonDb.get());
+                EncoderTester clEncoder;
+                IntermediateMessage vIntermediateFormat;
+                vIntermediateFormat.reserve(MsgDefFields.size());
+                const char* pcThreadInput = szInput;
+                if (clDecoder.TestDecodeAscii(MsgDefFields, &pcThreadInput, vIntermediateFormat) != STATUS::SUCCESS ||
+                    clEncoder.TestEncodeAsciiBody(vIntermediateFormat) != strReference)
+                {
+                    ++uiMismatches;
+                }
+            }
+        });
+    }
+    for (std::thread& clThread : vThreads) { clThread.join(); }
+    ASSERT_EQ(uiMismatches.load(), 0U);
+}
+
+TEST_F(MessageDecoderTypesTest, DECODE_PLAN_RESOLVES_FIELDS)
+{
+    auto* pclFieldArray = new FieldArrayField();
+    pclFieldArray->name = "OBS";
+    pclFieldArray->type = FIELD_TYPE::FIELD_ARRAY;
+    pclFieldArray->arrayLength = 4;
+    pclFieldArray->fields.emplace_back(new BaseField("PRN", FIELD_TYPE::SIMPLE, "%lu", 4, DATA_TYPE::ULONG));
+    pclFieldArray->fields.emplace_back(new BaseField("PSR", FIELD_TYPE::SIMPLE, "%lf", 8, DATA_TYPE::DOUBLE));
+
+    auto* pclHexArray = new ArrayField();
+    pclHexArray->name = "DATA";
+    pclHexArray->type = FIELD_TYPE::FIXED_LENGTH_ARRAY;
+    pclHexArray->setConversion("%Z");
+    pclHexArray->dataType.length = 1;
+    pclHexArray->dataType.name = DATA_TYPE::UCHAR;
+    pclHexArray->arrayLength = 16;
+
+    MsgDefFields.emplace_back(new BaseField("WEEK", FIELD_TYPE::SIMPLE, "%hu", 2, DATA_TYPE::USHORT));
+    MsgDefFields.emplace_back(new BaseField("UNKNOWN", FIELD_TYPE::SIMPLE, "%q", 4, DATA_TYPE::ULONG));
+    MsgDefFields.emplace_back(pclHexArray);
+    MsgDefFields.emplace_back(pclFieldArray);
+
+    const DecodePlan stPlan = pclMyDecoderTester->TestCompilePlan(MsgDefFields);
+    ASSERT_EQ(stPlan.vSteps.size(), 4U);
+    ASSERT_EQ(stPlan.vSubPlans.size(), 1U);
+
+    ASSERT_EQ(stPlan.vSteps[0].pclField, MsgDefFields[0]);
+    ASSERT_EQ(stPlan.vSteps[0].ucAlignment, 2U);
+    ASSERT_NE(stPlan.vSteps[0].pfAsciiDecoder, nullptr);
+    ASSERT_NE(stPlan.vSteps[0].pfJsonDecoder, nullptr);
+
+    // Unknown conversions only fail once a field actually uses them
+    ASSERT_EQ(stPlan.vSteps[1].pfAsciiDecoder, nullptr);
+    ASSERT_EQ(stPlan.vSteps[1].pfJsonDecoder, nullptr);
+
+    ASSERT_TRUE(stPlan.vSteps[2].bHexByteArray);
+    ASSERT_FALSE(stPlan.vSteps[2].bCommaSeparated);
+    ASSERT_EQ(stPlan.vSteps[2].uiArrayLength, 16U);
+
+    ASSERT_EQ(stPlan.vSteps[3].uiSubPlan, 0U);
+    ASSERT_EQ(stPlan.vSteps[3].uiArrayLength, 4U);
+    ASSERT_EQ(stPlan.vSteps[3].ucAlignment, 1U);
+    ASSERT_EQ(stPlan.vSubPlans[0].vSteps.size(), 2U);
+    ASSERT_EQ(stPlan.vSubPlans[0].vSteps[1].pclField, pclFieldArray->fields[1]);
+    ASSERT_EQ(stPlan.vSubPlans[0].vSteps[1].ucAlignment, 4U);
+}
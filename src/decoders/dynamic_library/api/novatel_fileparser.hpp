@@ -56,6 +56,8 @@ extern "C"
     DECODERS_EXPORT bool novatel_fileparser_get_ignore_abbrev_ascii_responses(novatel::edie::oem::FileParser* pclFileParser_);
     DECODERS_EXPORT void novatel_fileparser_set_decompress_rangecmp(novatel::edie::oem::FileParser* pclFileParser_, bool bDecompressRangeCmp_);
     DECODERS_EXPORT bool novatel_fileparser_get_decompress_rangecmp(novatel::edie::oem::FileParser* pclFileParser_);
+    DECODERS_EXPORT void novatel_fileparser_set_passthrough(novatel::edie::oem::FileParser* pclFileParser_, bool bPassthrough_);
+    DECODERS_EXPORT bool novatel_fileparser_get_passthrough(novatel::edie::oem::FileParser* pclFileParser_);
     DECODERS_EXPORT void novatel_fileparser_set_return_unknownbytes(novatel::edie::oem::FileParser* pclFileParser_, bool bReturnUnknownBytes_);
     DECODERS_EXPORT bool novatel_fileparser_get_return_unknownbytes(novatel::edie::oem::FileParser* pclFileParser_);
     DECODERS_EXPORT void novatel_fileparser_set_encodeformat(novatel::edie::oem::FileParser* pclFileParser_,
@@ -54,6 +54,8 @@ extern "C"
     DECODERS_EXPORT bool novatel_parser_get_ignore_abbrev_ascii_responses(novatel::edie::oem::Parser* pclParser_);
     DECODERS_EXPORT void novatel_parser_set_decompress_rangecmp(novatel::edie::oem::Parser* pclParser_, bool bDecompressRangeCmp_);
     DECODERS_EXPORT bool novatel_parser_get_decompress_rangecmp(novatel::edie::oem::Parser* pclParser_);
+    DECODERS_EXPORT void novatel_parser_set_passthrough(novatel::edie::oem::Parser* pclParser_, bool bPassthrough_);
+    DECODERS_EXPORT bool novatel_parser_get_passthrough(novatel::edie::oem::Parser* pclParser_);
     DECODERS_EXPORT void novatel_parser_set_return_unknownbytes(novatel::edie::oem::Parser* pclParser_, bool bReturnUnknownBytes_);
     DECODERS_EXPORT bool novatel_parser_get_return_unknownbytes(novatel::edie::oem::Parser* pclParser_);
     DECODERS_EXPORT void novatel_parser_set_encodeformat(novatel::edie::oem::Parser* pclParser_, novatel::edie::ENCODEFORMAT eEncodeFormat_);
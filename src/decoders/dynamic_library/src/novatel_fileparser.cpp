@@ -72,6 +72,13 @@ bool novatel_fileparser_get_decompress_rangecmp(FileParser* pclFileParser_)
     return pclFileParser_ ? pclFileParser_->GetDecompressRangeCmp() : false;
 }
 
+void novatel_fileparser_set_passthrough(FileParser* pclFileParser_, bool bPassthrough_)
+{
+    if (pclFileParser_) { pclFileParser_->SetPassthrough(bPassthrough_); }
+}
+
+bool novatel_fileparser_get_passthrough(FileParser* pclFileParser_) { return pclFileParser_ ? pclFileParser_->GetPassthrough() : false; }
+
 void novatel_fileparser_set_return_unknownbytes(FileParser* pclFileParser_, bool bReturnUnknownBytes_)
 {
     if (pclFileParser_) { pclFileParser_->SetReturnUnknownBytes(bReturnUnknownBytes_); }
@@ -69,6 +69,13 @@ void novatel_parser_set_decompress_rangecmp(Parser* pclParser_, bool bDecompress
 
 bool novatel_parser_get_decompress_rangecmp(Parser* pclParser_) { return pclParser_ ? pclParser_->GetDecompressRangeCmp() : false; }
 
+void novatel_parser_set_passthrough(Parser* pclParser_, bool bPassthrough_)
+{
+    if (pclParser_) { pclParser_->SetPassthrough(bPassthrough_); }
+}
+
+bool novatel_parser_get_passthrough(Parser* pclParser_) { return pclParser_ ? pclParser_->GetPassthrough() : false; }
+
 void novatel_parser_set_return_unknownbytes(Parser* pclParser_, bool bReturnUnknownBytes_)
 {
     if (pclParser_) { pclParser_->SetReturnUnknownBytes(bReturnUnknownBytes_); }
@@ -57,12 +57,22 @@ namespace novatel::edie::oem {
 class Encoder : public EncoderBase
 {
   private:
-    // Enum util functions
-    void InitEnumDefns();
-    static void InitFieldMaps();
+    static void InitFieldMaps(FieldEncoderMap& asciiFieldMap_, FieldEncoderMap& jsonFieldMap_);
+    static const FieldEncoderMaps& OEMFieldMaps();
     std::string JsonHeaderToMsgName(const IntermediateHeader& stInterHeader_) const;
 
+    template <typename T>
+    [[nodiscard]] STATUS EncodeMessage(unsigned char** ppucEncodeBuffer_, uint32_t uiEncodeBufferSize_, IntermediateHeader& stHeader_,
+                                       const T& stMessage_, MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_,
+                                       ENCODEFORMAT eEncodeFormat_);
+    template <typename T>
+    [[nodiscard]] STATUS EncodeMessageBody(unsigned char** ppucEncodeBuffer_, uint32_t uiEncodeBufferSize_, const T& stMessage_,
+                                           MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eEncodeFormat_);
+
   protected:
+    // Enum util functions
+    void InitEnumDefns() override;
+
     char separatorASCII() const override { return OEM4_ASCII_FIELD_SEPARATOR; };
     char separatorAbbASCII() const override { return OEM4_ABBREV_ASCII_SEPARATOR; };
     uint32_t indentationLengthAbbASCII() const override { return OEM4_ABBREV_ASCII_INDENTATION_LENGTH; };
@@ -83,6 +93,11 @@ class Encoder : public EncoderBase
     [[nodiscard]] bool EncodeJsonHeader(const IntermediateHeader& stInterHeader_, char** ppcOutBuf_, uint32_t& uiBytesLeft_);
     [[nodiscard]] bool EncodeJsonShortHeader(const IntermediateHeader& stInterHeader_, char** ppcOutBuf_, uint32_t& uiBytesLeft_);
 
+    // Complete an encoded body
+    [[nodiscard]] bool EncodeAsciiFooter(char** ppcOutBuf_, uint32_t& uiBytesLeft_, const MessageDataStruct& stMessageData_);
+    [[nodiscard]] STATUS EncodeBinaryFooter(const unsigned char* pucBody_, unsigned char** ppucOutBuf_, uint32_t& uiBytesLeft_,
+                                            const MessageDataStruct& stMessageData_, const MetaDataStruct& stMetaData_);
+
   public:
     //----------------------------------------------------------------------------
     //! \brief A constructor for the Encoder class.
@@ -125,6 +140,16 @@ class Encoder : public EncoderBase
                                 IntermediateMessage& stMessage_, MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_,
                                 ENCODEFORMAT eEncodeFormat_);
 
+    //----------------------------------------------------------------------------
+    //! \brief Encode an OEM message from a header and a flat message
+    //! intermediate, as populated by MessageDecoder::Decode.
+    //
+    //! \return The same error codes as the IntermediateMessage overload.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS Encode(unsigned char** ppucEncodeBuffer_, uint32_t uiEncodeBufferSize_, IntermediateHeader& stHeader_,
+                                const FlatIntermediateMessage& stMessage_, MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_,
+                                ENCODEFORMAT eEncodeFormat_);
+
     //----------------------------------------------------------------------------
     //! \brief Encode an OEM message header from the provided intermediate header.
     //
@@ -187,6 +212,14 @@ class Encoder : public EncoderBase
     //----------------------------------------------------------------------------
     [[nodiscard]] STATUS EncodeBody(unsigned char** ppucEncodeBuffer_, uint32_t uiEncodeBufferSize_, IntermediateMessage& stMessage_,
                                     MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eEncodeFormat_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Encode an OEM message body from a flat message intermediate.
+    //
+    //! \return The same error codes as the IntermediateMessage overload.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS EncodeBody(unsigned char** ppucEncodeBuffer_, uint32_t uiEncodeBufferSize_, const FlatIntermediateMessage& stMessage_,
+                                    MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eEncodeFormat_);
 };
 } // namespace novatel::edie::oem
 #endif // NOVATEL_ENCODER_HPP
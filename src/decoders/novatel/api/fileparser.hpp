@@ -36,11 +36,17 @@
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "decoders/common/api/common.hpp"
 #include "decoders/novatel/api/parser.hpp"
 #include "hw_interface/stream_interface/api/inputfilestream.hpp"
+#include "hw_interface/stream_interface/api/inputmappedfilestream.hpp"
 #include "hw_interface/stream_interface/api/outputfilestream.hpp"
 
 namespace novatel::edie::oem {
@@ -58,17 +64,113 @@ class FileParser
     FileParser(const FileParser&&) = delete;
     FileParser& operator=(const FileParser&) = delete;
 
+  public:
+    //! \brief ullDEFAULT_CHUNK_SIZE: the default number of bytes parsed by each chunk thread at a time.
+    static constexpr uint64_t ullDEFAULT_CHUNK_SIZE = 8ULL * 1024 * 1024;
+
   private:
+    static constexpr uint64_t ullFIND_BEGIN = UINT64_MAX;
+
+    //----------------------------------------------------------------------------
+    //! \brief A message returned by a chunk's Parser, with its bytes stored in
+    //! the chunk rather than the Parser's buffers.
+    //----------------------------------------------------------------------------
+    struct ChunkMessage
+    {
+        static constexpr uint64_t ullNO_DATA = UINT64_MAX;
+
+        STATUS eStatus{STATUS::UNKNOWN};
+        MetaDataStruct stMetaData;
+        uint64_t ullEnd{0};    //!< The offset in the file of the first byte after the message.
+        bool bDeferred{false}; //!< Is this a RANGECMP frame that still has to be decompressed?
+        uint64_t ullMessage{ullNO_DATA};
+        uint32_t uiMessageLength{0};
+        uint64_t ullHeader{ullNO_DATA};
+        uint32_t uiHeaderLength{0};
+        uint64_t ullBody{ullNO_DATA};
+        uint32_t uiBodyLength{0};
+    };
+
+    //----------------------------------------------------------------------------
+    //! \brief The messages parsed from one byte range of the file.
+    //----------------------------------------------------------------------------
+    struct Chunk
+    {
+        uint64_t ullBegin{0}; //!< The offset of the first byte of the chunk.
+        uint64_t ullEnd{0};   //!< The offset of the first byte after the chunk.
+        std::vector<unsigned char> vData;
+        std::vector<ChunkMessage> vMessages;
+    };
+
     std::shared_ptr<spdlog::logger> pclMyLogger{Logger::RegisterLogger("novatel_fileparser")};
 
     Parser clMyParser;
     InputFileStream* pclMyInputStream;
+    InputMappedFileStream* pclMyMappedStream{nullptr};
     StreamReadStatus stMyStreamReadStatus;
     ReadDataStructure stMyReadData;
     unsigned char* const pcMyStreamReadBuffer;
 
+    // Chunk threads, only used when more than one is requested
+    uint32_t uiMyChunkThreads{1};
+    uint64_t ullMyChunkSize{ullDEFAULT_CHUNK_SIZE};
+    std::filesystem::path clMyFilePath;
+    uint64_t ullMyFileSize{0};
+    uint64_t ullMyChunkCount{0};
+    uint64_t ullMyNextChunk{0};
+    std::vector<std::unique_ptr<Parser>> vMyChunkParsers;
+    std::unique_ptr<Chunk> pclMyChunk;
+    size_t ulMyChunkMessage{0};
+    uint64_t ullMyChunkEnd{0}; // Where the last chunk read from ended, and so where the next one has to begin
+    // Declared after the Parsers they use, so that the chunks in flight are waited for first
+    std::deque<std::future<std::unique_ptr<Chunk>>> dqMyChunks;
+
     [[nodiscard]] bool ReadStream();
 
+    //----------------------------------------------------------------------------
+    //! \brief Find the first frame at or after an offset in the file that passed
+    //! a CRC check. Abbreviated ASCII, NMEA and JSON frames have no CRC, so they
+    //! are skipped over.
+    //
+    //! \param [in] clFile_ The file to search.
+    //! \param [in] ullOffset_ The offset to start searching from.
+    //
+    //! \return The offset of the frame, or the size of the file if there is none.
+    //----------------------------------------------------------------------------
+    uint64_t FindFrameBoundary(std::istream& clFile_, uint64_t ullOffset_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Parse one chunk of the file. A chunk begins at the first frame that
+    //! passed a CRC check after its nominal start, and ends at the first frame
+    //! boundary its Parser reaches at or after the begin of the next chunk.
+    //! That is where the next chunk begins, unless the next chunk began inside
+    //! a message, such as one embedded in RXCONFIG. ReadChunked() then picks
+    //! the next chunk up from where this one ended.
+    //
+    //! \param [in] ullChunk_ The index of the chunk.
+    //! \param [in] clParser_ The Parser to parse the chunk with.
+    //! \param [in] ullBegin_ The offset to begin the chunk at, or
+    //! ullFIND_BEGIN to find it from the nominal start of the chunk.
+    //
+    //! \return The messages parsed from the chunk.
+    //----------------------------------------------------------------------------
+    std::unique_ptr<Chunk> ParseChunk(uint64_t ullChunk_, Parser& clParser_, uint64_t ullBegin_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Start parsing chunks until uiMyChunkThreads are in flight.
+    //----------------------------------------------------------------------------
+    void LaunchChunks();
+
+    //----------------------------------------------------------------------------
+    //! \brief Wait for the chunks in flight to finish and discard them.
+    //----------------------------------------------------------------------------
+    void DiscardChunks();
+
+    //----------------------------------------------------------------------------
+    //! \brief Read() when chunk threads are in use.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS ReadChunked(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_);
+
   public:
     //----------------------------------------------------------------------------
     //! \brief A constructor for the FileParser class.
@@ -167,6 +269,63 @@ class FileParser
     //----------------------------------------------------------------------------
     bool GetDecompressRangeCmp();
 
+    //----------------------------------------------------------------------------
+    //! \brief Set the passthrough option for messages that are already in the
+    //! encode format.
+    //
+    //! \param [in] bPassthrough_ true to return such messages without decoding
+    //! and re-encoding them.
+    //----------------------------------------------------------------------------
+    void SetPassthrough(bool bPassthrough_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the passthrough option for messages that are already in the
+    //! encode format.
+    //
+    //! \return The current passthrough option.
+    //----------------------------------------------------------------------------
+    bool GetPassthrough();
+
+    //----------------------------------------------------------------------------
+    //! \brief Set the number of threads that decode and encode messages. See
+    //! Parser::SetWorkerThreads().
+    //
+    //! \param [in] uiThreads_ The number of worker threads.
+    //----------------------------------------------------------------------------
+    void SetWorkerThreads(uint32_t uiThreads_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the number of threads that decode and encode messages.
+    //
+    //! \return The number of worker threads.
+    //----------------------------------------------------------------------------
+    uint32_t GetWorkerThreads();
+
+    //----------------------------------------------------------------------------
+    //! \brief Set the number of threads that parse the file in chunks. With
+    //! more than one, the file is split into byte ranges that are framed,
+    //! decoded and encoded independently, each by its own Parser, and Read()
+    //! returns their messages in file order. RANGECMP messages are still
+    //! decompressed in file order by the calling thread.
+    //
+    //! \param [in] uiThreads_ The number of chunk threads. 0 or 1 parses the
+    //! file as a single stream.
+    //! \param [in] ullChunkSize_ The nominal size of each chunk in bytes.
+    //! Each thread holds the messages of one chunk in memory.
+    //! \remark Chunks are found again from the start of the file, so set this
+    //! before reading. Unknown bytes at the end of a chunk are returned as one
+    //! block, which may group them differently than parsing a single stream.
+    //----------------------------------------------------------------------------
+    void SetChunkThreads(uint32_t uiThreads_, uint64_t ullChunkSize_ = ullDEFAULT_CHUNK_SIZE);
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the number of threads that parse the file in chunks.
+    //
+    //! \return The number of chunk threads, 1 if the file is parsed as a single
+    //! stream.
+    //----------------------------------------------------------------------------
+    uint32_t GetChunkThreads();
+
     //----------------------------------------------------------------------------
     //! \brief Set the return option for unknown bytes.
     //
@@ -219,6 +378,21 @@ class FileParser
     //----------------------------------------------------------------------------
     [[nodiscard]] bool SetStream(InputFileStream* pclInputStream_);
 
+    //----------------------------------------------------------------------------
+    //! \brief Set an InputMappedFileStream for the FileParser. Bytes are written
+    //! to the Parser straight from the mapping, without being copied into a
+    //! read buffer first.
+    //
+    //! \remark The Framer still copies the bytes into its circular buffer, as it
+    //! only frames out of its own buffer. So this saves one of the two copies
+    //! that reading an InputFileStream makes, not both.
+    //
+    //! \param [in] pclInputStream_ A pointer to the input stream.
+    //
+    //! \return A boolean describing if the operation was successful
+    //----------------------------------------------------------------------------
+    [[nodiscard]] bool SetStream(InputMappedFileStream* pclInputStream_);
+
     //----------------------------------------------------------------------------
     //! \brief Read a log from the FileParser.
     //
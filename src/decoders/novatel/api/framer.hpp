@@ -65,6 +65,14 @@ class Framer : public FramerBase
     bool IsEmptyAbbrevLine(uint32_t uiCircularBufferPosition_) const;
     bool IsAbbrevAsciiResponse() const;
 
+    //----------------------------------------------------------------------------
+    //! \brief Run the CRC over the rest of a binary header in one step, as far
+    //! as the buffered data allows.
+    //! \param [in] uiHeaderLength_ Length of the binary header being framed.
+    //! \param [out] stMetaData_ Updated with the number of bytes consumed.
+    //----------------------------------------------------------------------------
+    void ConsumeBinaryHeader(uint32_t uiHeaderLength_, MetaDataStruct& stMetaData_);
+
   public:
     //----------------------------------------------------------------------------
     //! \brief A constructor for the Framer class.
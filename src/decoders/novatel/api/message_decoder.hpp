@@ -47,7 +47,9 @@ namespace novatel::edie::oem {
 class MessageDecoder : public MessageDecoderBase
 {
   private:
-    void InitOEMFieldMaps();
+    static void InitOEMFieldMaps(std::unordered_map<uint32_t, AsciiFieldDecoder>& asciiFieldMap_,
+                                 std::unordered_map<uint32_t, JsonFieldDecoder>& jsonFieldMap_);
+    static const FieldDecoderMaps& OEMFieldMaps();
 
   public:
     //----------------------------------------------------------------------------
@@ -36,7 +36,11 @@
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
+#include <atomic>
 #include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include "decoders/common/api/common.hpp"
 #include "decoders/common/api/message_decoder.hpp"
@@ -71,7 +75,45 @@ class Parser
     //! \brief uiPARSER_INTERNAL_BUFFER_SIZE: the size of the parser's internal buffer.
     static constexpr uint32_t uiPARSER_INTERNAL_BUFFER_SIZE = MESSAGE_SIZE_MAX;
 
+    //! \brief uiPIPELINE_SLOTS_PER_WORKER: the number of messages each worker thread may have in flight.
+    static constexpr uint32_t uiPIPELINE_SLOTS_PER_WORKER = 4;
+
   private:
+    //----------------------------------------------------------------------------
+    //! \brief A message on its way through the worker threads. The reading
+    //! thread fills it in and hands it to a worker, which sets bDone once the
+    //! message is ready to be returned.
+    //----------------------------------------------------------------------------
+    struct PipelineSlot
+    {
+        std::atomic<bool> bDone{false};
+        bool bDecode{false};           //!< Should a worker decode and encode the frame?
+        bool bReturn{false};           //!< Should Read() return the result?
+        STATUS eStatus{STATUS::UNKNOWN};
+        ENCODEFORMAT eEncodeFormat{ENCODEFORMAT::ASCII};
+        IntermediateHeader stHeader;
+        MetaDataStruct stMetaData;
+        MessageDataStruct stMessageData;
+        std::exception_ptr pclException;
+        std::vector<unsigned char> vFrame = std::vector<unsigned char>(uiPARSER_INTERNAL_BUFFER_SIZE);
+        std::vector<unsigned char> vEncode = std::vector<unsigned char>(uiPARSER_INTERNAL_BUFFER_SIZE);
+    };
+
+    //----------------------------------------------------------------------------
+    //! \brief A worker thread with its own decoder and encoder. Worker i handles
+    //! every message whose sequence number is i modulo the number of workers.
+    //----------------------------------------------------------------------------
+    struct PipelineWorker
+    {
+        MessageDecoder clMessageDecoder;
+        Encoder clEncoder;
+        FlatIntermediateMessage stMessage;
+        std::atomic<uint64_t> ullPublished{0}; //!< One past the last sequence number handed to this worker.
+        std::thread clThread;
+
+        PipelineWorker(JsonReader* pclJsonDb_) : clMessageDecoder(pclJsonDb_), clEncoder(pclJsonDb_) {}
+    };
+
     std::shared_ptr<spdlog::logger> pclMyLogger{Logger::RegisterLogger("novatel_parser")};
 
     JsonReader clMyJsonReader;
@@ -89,6 +131,9 @@ class Parser
     Filter clMyRangeCmpFilter;
     Filter clMyRxConfigFilter;
 
+    // Decoded message bodies, reused across reads so its storage is only allocated while warming up
+    FlatIntermediateMessage stMyMessage;
+
     unsigned char* const pcMyEncodeBuffer{nullptr};
     unsigned char* pucMyEncodeBufferPointer{nullptr};
     unsigned char* const pcMyFrameBuffer{nullptr};
@@ -96,10 +141,85 @@ class Parser
 
     // Configuration options
     bool bMyDecompressRangeCmp{true};
+    bool bMyDeferRangeCmp{false};
     bool bMyReturnUnknownBytes{true};
     bool bMyIgnoreAbbreviatedASCIIResponse{true};
+    bool bMyPassthrough{false};
+    bool bMyZeroCopy{false};
     ENCODEFORMAT eMyEncodeFormat{ENCODEFORMAT::ASCII};
 
+    // The database the components were loaded with, shared read-only by the worker threads
+    JsonReader* pclMyJsonDb{nullptr};
+
+    // Worker threads, only used when more than one is requested
+    uint32_t uiMyWorkerThreads{1};
+    std::vector<std::unique_ptr<PipelineWorker>> vMyWorkers;
+    std::vector<std::unique_ptr<PipelineSlot>> vMySlots;
+    std::atomic<bool> bMyStopWorkers{false};
+    uint64_t ullMyDispatched{0};
+    uint64_t ullMyConsumed{0};
+    bool bMyHoldingSlot{false};
+
+    //----------------------------------------------------------------------------
+    //! \brief Is a frame in this format already in the encode format?
+    //
+    //! \param [in] eFormat_ The format of the framed message.
+    //
+    //! \return true if the frame can be returned without being re-encoded.
+    //----------------------------------------------------------------------------
+    bool IsPassthroughFormat(HEADERFORMAT eFormat_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Start the worker threads requested with SetWorkerThreads().
+    //----------------------------------------------------------------------------
+    void StartWorkers();
+
+    //----------------------------------------------------------------------------
+    //! \brief Stop and join the worker threads, discarding messages in flight.
+    //
+    //! \return The number of messages framed but not yet returned by Read()
+    //! that were discarded.
+    //----------------------------------------------------------------------------
+    uint64_t StopWorkers();
+
+    //----------------------------------------------------------------------------
+    //! \brief Wait for the messages in flight to finish and discard them.
+    //
+    //! \return The number of messages framed but not yet returned by Read()
+    //! that were discarded.
+    //----------------------------------------------------------------------------
+    uint64_t DiscardInFlight();
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the number of messages framed for the worker threads but not
+    //! yet returned by Read().
+    //----------------------------------------------------------------------------
+    uint64_t GetInFlight() const { return ullMyDispatched - ullMyConsumed - (bMyHoldingSlot ? 1 : 0); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode and encode the messages handed to one worker thread.
+    //
+    //! \param [in] uiWorker_ The index of the worker.
+    //----------------------------------------------------------------------------
+    void RunWorker(uint32_t uiWorker_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Frame the next message and do the work that has to happen in
+    //! stream order: header decoding, filtering, RANGECMP decompression and
+    //! RXCONFIG conversion.
+    //
+    //! \param [in] stSlot_ The slot to fill in.
+    //! \param [in] bDecodeIncompleteAbbv_ See Read().
+    //
+    //! \return false if no more messages can be framed from the data written.
+    //----------------------------------------------------------------------------
+    bool DispatchFrame(PipelineSlot& stSlot_, bool bDecodeIncompleteAbbv_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Read() when worker threads are in use.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS ReadPipelined(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbv_);
+
   public:
     //----------------------------------------------------------------------------
     //! \brief A constructor for the Parser class.
@@ -128,12 +248,23 @@ class Parser
     ~Parser();
 
     //----------------------------------------------------------------------------
-    //! \brief Load a JsonReader object.
+    //! \brief Load a JsonReader object. The JsonReader is shared, not copied,
+    //! so it must outlive the Parser, and one JsonReader can serve Parsers on
+    //! several threads.
     //
     //! \param[in] pclJsonDb_ A pointer to a JsonReader object.
+    //! \remark Messages framed for worker threads but not yet returned by
+    //! Read() are discarded, and a warning is logged with how many.
     //----------------------------------------------------------------------------
     void LoadJsonDb(JsonReader* pclJsonDb_);
 
+    //----------------------------------------------------------------------------
+    //! \brief Get the JsonReader object the Parser was loaded with.
+    //
+    //! \return A pointer to the JsonReader object, or nullptr if none was loaded.
+    //----------------------------------------------------------------------------
+    JsonReader* GetJsonDb();
+
     //----------------------------------------------------------------------------
     //! \brief Get the internal logger.
     //
@@ -191,6 +322,25 @@ class Parser
     //----------------------------------------------------------------------------
     bool GetDecompressRangeCmp();
 
+    //----------------------------------------------------------------------------
+    //! \brief Set the deferral option for RANGECMP messages. When enabled,
+    //! RANGECMP messages that would be decompressed are returned exactly as
+    //! they were framed instead. Decompression keeps state between messages, so
+    //! this lets a caller that parses parts of a stream out of order write them
+    //! to a single Parser later, in stream order.
+    //
+    //! \param [in] bDeferRangeCmp_ true to return RANGECMP messages without
+    //! decompressing them.
+    //----------------------------------------------------------------------------
+    void SetDeferRangeCmp(bool bDeferRangeCmp_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the deferral option for RANGECMP messages.
+    //
+    //! \return The current option for deferring RANGECMP decompression.
+    //----------------------------------------------------------------------------
+    bool GetDeferRangeCmp();
+
     //----------------------------------------------------------------------------
     //! \brief Set the return option for unknown bytes.
     //
@@ -205,6 +355,45 @@ class Parser
     //----------------------------------------------------------------------------
     bool GetReturnUnknownBytes();
 
+    //----------------------------------------------------------------------------
+    //! \brief Set the passthrough option. When enabled, messages that are
+    //! already in the encode format (BINARY, ASCII or abbreviated ASCII, with
+    //! long or short headers) are returned as they were framed. Their headers
+    //! are still decoded for filtering, but their bodies are not decoded or
+    //! re-encoded. RANGECMP messages being decompressed and RXCONFIG messages
+    //! are always converted.
+    //
+    //! \param [in] bPassthrough_ true to pass through messages that are
+    //! already in the encode format.
+    //----------------------------------------------------------------------------
+    void SetPassthrough(bool bPassthrough_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the passthrough option.
+    //
+    //! \return The current option for passing through messages that are already
+    //! in the encode format.
+    //----------------------------------------------------------------------------
+    bool GetPassthrough();
+
+    //----------------------------------------------------------------------------
+    //! \brief Set the zero-copy option. When enabled, messages that would be
+    //! passed through (see SetPassthrough()) are returned pointing directly at
+    //! the framed bytes, without being copied out of the Framer.
+    //
+    //! \param [in] bZeroCopy_ true to return untransformed messages in place.
+    //! \remark Zero-copy implies passthrough. Messages returned in place are
+    //! only valid until the next call to Read(), Write() or Flush().
+    //----------------------------------------------------------------------------
+    void SetZeroCopy(bool bZeroCopy_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the zero-copy option.
+    //
+    //! \return The current option for returning untransformed messages in place.
+    //----------------------------------------------------------------------------
+    bool GetZeroCopy();
+
     //----------------------------------------------------------------------------
     //! \brief Set the encode format for messages.
     //
@@ -220,6 +409,31 @@ class Parser
     ENCODEFORMAT
     GetEncodeFormat();
 
+    //----------------------------------------------------------------------------
+    //! \brief Set the number of threads that decode and encode messages.
+    //! With more than one, Read() frames messages, decodes their headers,
+    //! filters them and decompresses RANGECMP messages on the calling thread,
+    //! and hands their bodies to a pool of worker threads. Messages are still
+    //! returned in the order they were written.
+    //
+    //! \param [in] uiThreads_ The number of worker threads. 0 or 1 decodes and
+    //! encodes everything on the calling thread.
+    //! \remark Messages that were framed but not yet returned by Read() are
+    //! discarded, and a warning is logged with how many, so set this before
+    //! writing data. Messages returned by Read()
+    //! are valid until the next call to Read(), as they are without workers,
+    //! but are always copied out of the Framer even with SetZeroCopy().
+    //----------------------------------------------------------------------------
+    void SetWorkerThreads(uint32_t uiThreads_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the number of threads that decode and encode messages.
+    //
+    //! \return The number of worker threads, 1 if messages are decoded on the
+    //! calling thread.
+    //----------------------------------------------------------------------------
+    uint32_t GetWorkerThreads();
+
     //----------------------------------------------------------------------------
     //! \brief Set the Filter for the FileParser.
     //
@@ -249,7 +463,16 @@ class Parser
     //
     //! \return The number of bytes successfully written to the Parser.
     //----------------------------------------------------------------------------
-    uint32_t Write(unsigned char* pucData_, uint32_t uiDataSize_);
+    uint32_t Write(const unsigned char* pucData_, uint32_t uiDataSize_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the number of bytes written to the Parser that have not been
+    //! framed yet.
+    //
+    //! \return The number of bytes waiting in the Framer.
+    //! \remark Messages framed for worker threads are not counted.
+    //----------------------------------------------------------------------------
+    uint32_t GetBytesInBuffer();
 
     //----------------------------------------------------------------------------
     //! \brief Read a log from the Parser.
@@ -272,7 +495,32 @@ class Parser
     [[nodiscard]] STATUS Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbv = false);
 
     //----------------------------------------------------------------------------
-    //! \brief Flush all bytes from the internal Parser.
+    //! \brief Read the observations of the next RANGE or RANGECMP* message
+    //! from the Parser. The observations are copied out of the RANGE message,
+    //! or decompressed straight out of the RANGECMP* message, without a
+    //! message being encoded.
+    //
+    //! \param [out] stObservations_ The arrays to replace with the observations
+    //! of the message. Reusing them for every message avoids reallocating them.
+    //! \param [out] stMetaData_ A reference to a MetaDataStruct to be populated
+    //! by the Parser. It describes the message as it was framed.
+    //
+    //! \return An error code describing the result of parsing.
+    //!   SUCCESS: The observations of a message that passed the Filter were
+    //! stored in stObservations_.
+    //!   BUFFER_EMPTY: There are no more bytes to parse in the Parser.
+    //! \remark Other messages are framed and skipped, as are RANGE and
+    //! RANGECMP* messages that can't be decoded. RANGECMP* messages are
+    //! decompressed whatever the options for Read() are, keeping the state of
+    //! decompression for later messages. Worker threads are not used, and
+    //! messages framed for them but not yet returned by Read() are discarded.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS ReadObservations(RangeObservations& stObservations_, MetaDataStruct& stMetaData_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Flush all bytes from the internal Parser. Messages framed but not
+    //! yet returned by worker threads are discarded, and a warning logs how
+    //! many.
     //
     //! \param [in] pucBuffer_ A buffer to contain flushed bytes, if desired.
     //! Defaults to NULL.
@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file bitfield_reader.hpp
+//! \brief Reader for the little-endian bit-packed fields of compressed
+//! range messages.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef RANGECMP_BITFIELD_READER_HPP
+#define RANGECMP_BITFIELD_READER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <stdint.h>
+
+#include <bit>
+#include <cstring>
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class BitfieldReader
+//! \brief Reads bitfields, least significant bit first, from a buffer.
+//
+//! Bits are buffered 64 at a time, so a field is extracted with a shift and
+//! a mask rather than bit by bit. Read() doesn't check the end of the buffer:
+//! callers check that a whole block of fields is present with HasBits() and
+//! then read its fields unchecked.
+//============================================================================
+class BitfieldReader
+{
+  public:
+    //! \brief uiMAX_BITFIELD_BITS: the widest bitfield that Read() returns.
+    static constexpr uint32_t uiMAX_BITFIELD_BITS = 64;
+
+    BitfieldReader() = default;
+
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for the BitfieldReader class.
+    //
+    //! \param[in] pucData_ The buffer to read.
+    //! \param[in] uiLength_ The length of the buffer in bytes.
+    //! \param[in] uiBitOffset_ The bit of the first byte to start reading at.
+    //----------------------------------------------------------------------------
+    BitfieldReader(const uint8_t* pucData_, uint32_t uiLength_, uint32_t uiBitOffset_ = 0) { Reset(pucData_, uiLength_, uiBitOffset_); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Start reading a new buffer.
+    //
+    //! \param[in] pucData_ The buffer to read.
+    //! \param[in] uiLength_ The length of the buffer in bytes.
+    //! \param[in] uiBitOffset_ The bit of the first byte to start reading at.
+    //----------------------------------------------------------------------------
+    void Reset(const uint8_t* pucData_, uint32_t uiLength_, uint32_t uiBitOffset_ = 0)
+    {
+        pucMyData = pucData_;
+        pucMyNext = pucData_;
+        pucMyEnd = pucData_ + uiLength_;
+        ullMyBits = 0;
+        uiMyBitCount = 0;
+        if (uiBitOffset_ > 0 && HasBits(uiBitOffset_)) { Read(uiBitOffset_); }
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the number of bits left in the buffer.
+    //
+    //! \return The number of bits that haven't been read.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] uint64_t BitsRemaining() const { return static_cast<uint64_t>(pucMyEnd - pucMyNext) * 8 + uiMyBitCount; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Check that a block of fields is present before reading it.
+    //
+    //! \param[in] ullBits_ The total width of the fields in bits.
+    //
+    //! \return True if at least ullBits_ bits are left in the buffer.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] bool HasBits(uint64_t ullBits_) const { return ullBits_ <= BitsRemaining(); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Read a bitfield.
+    //
+    //! \param[in] uiBits_ The width of the bitfield, at most uiMAX_BITFIELD_BITS.
+    //! It must not be more than BitsRemaining().
+    //
+    //! \return The bitfield, in the low bits of the result.
+    //----------------------------------------------------------------------------
+    uint64_t Read(uint32_t uiBits_)
+    {
+        // Refilling guarantees at least 56 bits, so only the widest fields take two reads
+        if (uiBits_ > uiMAX_REFILL_BITS) [[unlikely]]
+        {
+            const uint64_t ullLow = Read(32);
+            return ullLow | (Read(uiBits_ - 32) << 32);
+        }
+
+        if (uiMyBitCount < uiBits_) { Refill(); }
+        const uint64_t ullBitfield = ullMyBits & ((1ULL << uiBits_) - 1);
+        ullMyBits >>= uiBits_;
+        uiMyBitCount -= uiBits_;
+        return ullBitfield;
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the byte holding the next bit to be read.
+    //
+    //! \return A pointer into the buffer.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const uint8_t* GetCurrentByte() const { return pucMyData + BitsConsumed() / 8; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the position of the next bit to be read within its byte.
+    //
+    //! \return The bit offset, from 0 to 7.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] uint32_t GetBitOffset() const { return static_cast<uint32_t>(BitsConsumed() % 8); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the number of bytes that haven't been read completely.
+    //
+    //! \return The number of bytes from the current byte to the end of the buffer.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] uint32_t GetBytesRemaining() const { return static_cast<uint32_t>(pucMyEnd - GetCurrentByte()); }
+
+  private:
+    static constexpr uint32_t uiMAX_REFILL_BITS = 56;
+
+    const uint8_t* pucMyData{nullptr};
+    const uint8_t* pucMyNext{nullptr}; //!< The first byte that isn't in ullMyBits yet.
+    const uint8_t* pucMyEnd{nullptr};
+    uint64_t ullMyBits{0};     //!< Buffered bits, the next one to be read in bit 0.
+    uint32_t uiMyBitCount{0}; //!< The number of valid bits in ullMyBits.
+
+    [[nodiscard]] uint64_t BitsConsumed() const { return static_cast<uint64_t>(pucMyNext - pucMyData) * 8 - uiMyBitCount; }
+
+    // Top up ullMyBits to at least 56 bits, or to the end of the buffer.
+    void Refill()
+    {
+        if (std::endian::native == std::endian::little && pucMyEnd - pucMyNext >= 8) [[likely]]
+        {
+            // Load a whole word and advance by the number of whole bytes that fit. The bits of the
+            // partial byte above uiMyBitCount are loaded again, unchanged, by the next refill.
+            uint64_t ullWord;
+            memcpy(&ullWord, pucMyNext, sizeof(ullWord));
+            ullMyBits |= ullWord << uiMyBitCount;
+            pucMyNext += (63 - uiMyBitCount) >> 3;
+            uiMyBitCount |= uiMAX_REFILL_BITS;
+        }
+        else
+        {
+            while (uiMyBitCount <= uiMAX_REFILL_BITS && pucMyNext < pucMyEnd)
+            {
+                ullMyBits |= static_cast<uint64_t>(*pucMyNext++) << uiMyBitCount;
+                uiMyBitCount += 8;
+            }
+        }
+    }
+};
+
+} // namespace novatel::edie::oem
+
+#endif // RANGECMP_BITFIELD_READER_HPP
@@ -306,6 +306,9 @@ constexpr uint32_t RC4_SIG_BLK_CNO_BITS = 11;
 constexpr uint32_t RC4_SIG_BLK_LOCK_TIME_BITS = 4;
 constexpr uint32_t RC4_SIG_BLK_PSR_STDDEV_BITS = 4;
 constexpr uint32_t RC4_SIG_BLK_ADR_STDDEV_BITS = 4;
+// Total size of the fields above, which both block types start with
+constexpr uint32_t RC4_SIG_BLK_COMMON_BITS = RC4_SIG_BLK_PARITY_FLAG_BITS + RC4_SIG_BLK_HALF_CYCLE_BITS + RC4_SIG_BLK_CNO_BITS +
+                                             RC4_SIG_BLK_LOCK_TIME_BITS + RC4_SIG_BLK_PSR_STDDEV_BITS + RC4_SIG_BLK_ADR_STDDEV_BITS;
 constexpr float RC4_SIG_BLK_CNO_SCALE_FACTOR = 0.05f;
 constexpr double RC4_SIG_BLK_PSR_SCALE_FACTOR = 0.0005;
 constexpr double RC4_SIG_BLK_PHASERANGE_SCALE_FACTOR = 0.0001;
@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file observation_state_table.hpp
+//! \brief Per-observation state kept by the RangeDecompressor between
+//! messages.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef RANGECMP_OBSERVATION_STATE_TABLE_HPP
+#define RANGECMP_OBSERVATION_STATE_TABLE_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <stdint.h>
+
+#include <array>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class ObservationStateTable
+//! \brief A store of state for each observation, keyed by satellite system,
+//! signal type and PRN.
+//
+//! Each system and signal pair gets an array indexed by PRN, allocated the
+//! first time the pair is seen, so looking up an observation is two indexing
+//! operations. PRNs beyond the arrays, and unexpected enumerations, are kept
+//! in an overflow map instead.
+//
+//! Every slot is stamped with the generation it was written in. Clear()
+//! starts a new generation rather than touching the slots, and a slot from
+//! an older generation reads as empty.
+//
+//! \tparam SystemT The satellite system enumeration.
+//! \tparam SignalT The signal type enumeration.
+//! \tparam T The state stored for each observation.
+//============================================================================
+template <typename SystemT, typename SignalT, typename T> class ObservationStateTable
+{
+  public:
+    //! \brief uiSYSTEM_SLOTS: The number of satellite system values indexed directly.
+    static constexpr uint32_t uiSYSTEM_SLOTS = 16;
+    //! \brief uiSIGNAL_SLOTS: The number of signal type values indexed directly.
+    static constexpr uint32_t uiSIGNAL_SLOTS = 32;
+    //! \brief uiPRN_SLOTS: The number of PRNs, from 1, indexed directly. This covers every
+    //! PRN in a RANGECMP4 satellite mask.
+    static constexpr uint32_t uiPRN_SLOTS = 64;
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the state of an observation, adding it if it isn't stored.
+    //
+    //! \param[in] eSystem_ The satellite system of the observation.
+    //! \param[in] eSignal_ The signal type of the observation.
+    //! \param[in] uiPRN_ The PRN of the observation.
+    //
+    //! \return The stored state, or default-constructed state if it wasn't
+    //! stored.
+    //----------------------------------------------------------------------------
+    T& Get(SystemT eSystem_, SignalT eSignal_, uint32_t uiPRN_)
+    {
+        Slot* pstSlot = FindSlot(eSystem_, eSignal_, uiPRN_, true);
+        if (pstSlot == nullptr) { return mMyOverflow[OverflowKey(eSystem_, eSignal_, uiPRN_)]; }
+
+        if (pstSlot->uiGeneration != uiMyGeneration)
+        {
+            pstSlot->stState = T();
+            pstSlot->uiGeneration = uiMyGeneration;
+        }
+        return pstSlot->stState;
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Find the state of an observation.
+    //
+    //! \param[in] eSystem_ The satellite system of the observation.
+    //! \param[in] eSignal_ The signal type of the observation.
+    //! \param[in] uiPRN_ The PRN of the observation.
+    //
+    //! \return A pointer to the stored state, or nullptr if it isn't stored.
+    //----------------------------------------------------------------------------
+    T* Find(SystemT eSystem_, SignalT eSignal_, uint32_t uiPRN_)
+    {
+        if (IsIndexed(eSystem_, eSignal_, uiPRN_))
+        {
+            Slot* pstSlot = FindSlot(eSystem_, eSignal_, uiPRN_, false);
+            return pstSlot != nullptr && pstSlot->uiGeneration == uiMyGeneration ? &pstSlot->stState : nullptr;
+        }
+
+        auto itState = mMyOverflow.find(OverflowKey(eSystem_, eSignal_, uiPRN_));
+        return itState != mMyOverflow.end() ? &itState->second : nullptr;
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Forget the state of every observation.
+    //----------------------------------------------------------------------------
+    void Clear()
+    {
+        if (++uiMyGeneration == 0)
+        {
+            // The stamps have wrapped around, so slots from the first generation would be current again.
+            for (std::vector<Slot>& vSlots : avMySlots)
+            {
+                for (Slot& stSlot : vSlots) { stSlot.uiGeneration = 0; }
+            }
+            uiMyGeneration = 1;
+        }
+        mMyOverflow.clear();
+    }
+
+  private:
+    struct Slot
+    {
+        uint32_t uiGeneration{0};
+        T stState{};
+    };
+
+    // Slots are stamped with 0 before they are first written, so generations start at 1.
+    uint32_t uiMyGeneration{1};
+    std::array<std::vector<Slot>, uiSYSTEM_SLOTS * uiSIGNAL_SLOTS> avMySlots;
+    std::map<std::tuple<SystemT, SignalT, uint32_t>, T> mMyOverflow;
+
+    // PRN 0 wraps around to fail the PRN check.
+    static bool IsIndexed(SystemT eSystem_, SignalT eSignal_, uint32_t uiPRN_)
+    {
+        return static_cast<uint32_t>(eSystem_) < uiSYSTEM_SLOTS && static_cast<uint32_t>(eSignal_) < uiSIGNAL_SLOTS && uiPRN_ - 1 < uiPRN_SLOTS;
+    }
+
+    static std::tuple<SystemT, SignalT, uint32_t> OverflowKey(SystemT eSystem_, SignalT eSignal_, uint32_t uiPRN_)
+    {
+        return std::make_tuple(eSystem_, eSignal_, uiPRN_);
+    }
+
+    // Get the slot for an observation, or nullptr if it isn't indexed or, unless bAllocate_ is
+    // set, if the PRNs of its system and signal haven't been allocated yet.
+    Slot* FindSlot(SystemT eSystem_, SignalT eSignal_, uint32_t uiPRN_, bool bAllocate_)
+    {
+        if (!IsIndexed(eSystem_, eSignal_, uiPRN_)) { return nullptr; }
+
+        std::vector<Slot>& vSlots = avMySlots[static_cast<uint32_t>(eSystem_) * uiSIGNAL_SLOTS + static_cast<uint32_t>(eSignal_)];
+        if (vSlots.empty())
+        {
+            if (!bAllocate_) { return nullptr; }
+            vSlots.resize(uiPRN_SLOTS);
+        }
+        return &vSlots[uiPRN_ - 1];
+    }
+};
+
+} // namespace novatel::edie::oem
+
+#endif // RANGECMP_OBSERVATION_STATE_TABLE_HPP
@@ -13,7 +13,11 @@
 #include "decoders/novatel/api/framer.hpp"
 #include "decoders/novatel/api/header_decoder.hpp"
 #include "decoders/novatel/api/message_decoder.hpp"
+#include "decoders/novatel/api/rangecmp/bitfield_reader.hpp"
 #include "decoders/novatel/api/rangecmp/common.hpp"
+#include "decoders/novatel/api/rangecmp/observation_state_table.hpp"
+#include "decoders/novatel/api/rangecmp/range_encoder.hpp"
+#include "decoders/novatel/api/rangecmp/range_observations.hpp"
 
 namespace novatel::edie::oem {
 
@@ -43,10 +47,12 @@ class RangeDecompressor
     //----------------------------------------------------------------------------
     void Reset()
     {
-        ammmMyRangeCmp2Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::PRIMARY)].clear();
-        ammmMyRangeCmp2Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::SECONDARY)].clear();
-        ammmMyRangeCmp4Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::PRIMARY)].clear();
-        ammmMyRangeCmp4Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::SECONDARY)].clear();
+        for (uint32_t uiSource = 0; uiSource < static_cast<uint32_t>(MEASUREMENT_SOURCE::MAX); uiSource++)
+        {
+            aclMyReferenceBlocks[uiSource].Clear();
+            aclMyRangeCmp2Locktimes[uiSource].Clear();
+            aclMyRangeCmp4Locktimes[uiSource].Clear();
+        }
     };
 
     //----------------------------------------------------------------------------
@@ -57,11 +63,28 @@ class RangeDecompressor
     [[nodiscard]] STATUS Decompress(unsigned char* pucRangeMessageBuffer_, uint32_t uiRangeMessageBufferSize_, MetaDataStruct& stMetaData_,
                                     ENCODEFORMAT eFormat_ = ENCODEFORMAT::UNSPECIFIED);
 
+    //----------------------------------------------------------------------------
+    //! \brief Get the observations of a RANGE or RANGECMP* message without
+    //! encoding a RANGE message.
+    //
+    //! \param[in] pucRangeMessageBuffer_ The message, including its header.
+    //! Messages that aren't in binary are converted to binary in this buffer.
+    //! \param[in] uiRangeMessageBufferSize_ The length of pucRangeMessageBuffer_.
+    //! \param[in, out] stMetaData_ The MetaDataStruct of the message. It is
+    //! filled in from the header and describes the message as it was given.
+    //! \param[out] stObservations_ The arrays to replace with the observations.
+    //
+    //! \return SUCCESS, or the error codes of Decompress(). UNSUPPORTED is
+    //! returned for messages other than RANGE and RANGECMP*.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS DecompressObservations(unsigned char* pucRangeMessageBuffer_, uint32_t uiRangeMessageBufferSize_,
+                                                MetaDataStruct& stMetaData_, RangeObservations& stObservations_);
+
   private:
     Filter clMyRangeCmpFilter;
     HeaderDecoder clMyHeaderDecoder;
     MessageDecoder clMyMessageDecoder;
-    Encoder clMyEncoder;
+    RangeEncoder clMyEncoder;
 
     std::shared_ptr<spdlog::logger> pclMyLogger;
     JsonReader* pclMyMsgDB;
@@ -69,26 +92,23 @@ class RangeDecompressor
     // Store the last primary reference blocks for each measurement source.
     RangeCmp4MeasurementSignalBlockStruct astMyLastPrimaryReferenceBlocks[static_cast<uint32_t>(MEASUREMENT_SOURCE::MAX)];
 
-    // TODO: Is there a better way to map all this information together?
-    // This is an array of map of map of maps.  Indexed by SYSTEM, RangeCmp4::SIGNAL_TYPE, then PRN
-    // (uint32_t). This will store a header and its reference block for whenever we find
-    // differential data for the System, Signal type and PRN. We must keep track of which
-    // measurement source the reference block came from so any subsequent differential blocks are
-    // correctly decompressed.
-    std::map<SYSTEM, std::map<RangeCmp4::SIGNAL_TYPE,
-                              std::map<uint32_t, std::pair<RangeCmp4MeasurementBlockHeaderStruct, RangeCmp4MeasurementSignalBlockStruct>>>>
-        ammmMyReferenceBlocks[static_cast<uint32_t>(MEASUREMENT_SOURCE::MAX)];
+    // This is an array of tables indexed by SYSTEM, RangeCmp4::SIGNAL_TYPE, then PRN (uint32_t).
+    // This will store a header and its reference block for whenever we find differential data for
+    // the System, Signal type and PRN. We must keep track of which measurement source the
+    // reference block came from so any subsequent differential blocks are correctly decompressed.
+    ObservationStateTable<SYSTEM, RangeCmp4::SIGNAL_TYPE, std::pair<RangeCmp4MeasurementBlockHeaderStruct, RangeCmp4MeasurementSignalBlockStruct>>
+        aclMyReferenceBlocks[static_cast<uint32_t>(MEASUREMENT_SOURCE::MAX)];
 
     // Protected members to be accessed by test child classes.
   protected:
-    std::map<ChannelTrackingStatusStruct::SATELLITE_SYSTEM,
-             std::map<ChannelTrackingStatusStruct::SIGNAL_TYPE, std::map<uint32_t, RangeCmp2LocktimeInfoStruct>>>
-        ammmMyRangeCmp2Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::MAX)];
-    std::map<ChannelTrackingStatusStruct::SATELLITE_SYSTEM,
-             std::map<ChannelTrackingStatusStruct::SIGNAL_TYPE, std::map<uint32_t, RangeCmp4LocktimeInfoStruct>>>
-        ammmMyRangeCmp4Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::MAX)];
+    ObservationStateTable<ChannelTrackingStatusStruct::SATELLITE_SYSTEM, ChannelTrackingStatusStruct::SIGNAL_TYPE, RangeCmp2LocktimeInfoStruct>
+        aclMyRangeCmp2Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::MAX)];
+    ObservationStateTable<ChannelTrackingStatusStruct::SATELLITE_SYSTEM, ChannelTrackingStatusStruct::SIGNAL_TYPE, RangeCmp4LocktimeInfoStruct>
+        aclMyRangeCmp4Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::MAX)];
 
   private:
+    [[nodiscard]] STATUS DecodeRange(unsigned char* pucRangeMessageBuffer_, uint32_t uiRangeMessageBufferSize_, MetaDataStruct& stMetaData_,
+                                     IntermediateHeader& stHeader_, RangeStruct& stRange_, unsigned char** ppucBody_, bool bIncludeRange_);
     double GetSignalWavelength(const ChannelTrackingStatusStruct& stChannelTrackingStatus_, int16_t sGLONASSFrequency_);
     float DetermineRangeCmp2ObservationLocktime(const MetaDataStruct& stMetaData_, uint32_t uiLocktimeBits_,
                                                 ChannelTrackingStatusStruct::SATELLITE_SYSTEM eSystem_,
@@ -96,11 +116,12 @@ class RangeDecompressor
     float DetermineRangeCmp4ObservationLocktime(const MetaDataStruct& stMetaData_, uint8_t ucLocktimeBits_,
                                                 ChannelTrackingStatusStruct::SATELLITE_SYSTEM eSystem_,
                                                 ChannelTrackingStatusStruct::SIGNAL_TYPE eSignal_, uint32_t uiPRN_);
+    void CheckBitsRemaining(const BitfieldReader& clBitfieldReader_, uint64_t ullBitsRequired_);
     template <bool bIsSecondary>
-    void DecompressReferenceBlock(uint8_t** ppucDataPointer_, RangeCmp4MeasurementSignalBlockStruct& stReferenceBlock_,
+    void DecompressReferenceBlock(BitfieldReader& clBitfieldReader_, RangeCmp4MeasurementSignalBlockStruct& stReferenceBlock_,
                                   MEASUREMENT_SOURCE eMeasurementSource_);
     template <bool bIsSecondary>
-    void DecompressDifferentialBlock(uint8_t** ppucDataPointer_, RangeCmp4MeasurementSignalBlockStruct& stDifferentialBlock_,
+    void DecompressDifferentialBlock(BitfieldReader& clBitfieldReader_, RangeCmp4MeasurementSignalBlockStruct& stDifferentialBlock_,
                                      const RangeCmp4MeasurementSignalBlockStruct& stReferenceBlock_, double dSecondOffset_);
     void PopulateNextRangeData(RangeDataStruct& stRangeData_, const RangeCmp4MeasurementSignalBlockStruct& stBlock_,
                                const MetaDataStruct& stMetaData_, const ChannelTrackingStatusStruct& stChannelTrackingStatus_, uint32_t uiPRN_,
@@ -108,13 +129,7 @@ class RangeDecompressor
 
     void RangeCmpToRange(const RangeCmpStruct& stRangeCmpMessage_, RangeStruct& stRangeMessage_);
     void RangeCmp2ToRange(const RangeCmp2Struct& stRangeCmp2Message_, RangeStruct& stRangeMessage_, const MetaDataStruct& stMetaData_);
-    void RangeCmp4ToRange(uint8_t* pucCompressedData_, RangeStruct& stRangeMessage_, const MetaDataStruct& pstMetaData_);
-
-    // Protected members to be accessed by test child classes.
-  protected:
-    uint32_t uiMyBytesRemaining{0U};
-    uint32_t uiMyBitOffset{0U};
-    uint64_t GetBitfieldFromBuffer(uint8_t** ppucDataBuffer_, uint32_t uiBitsInBitfield_);
+    void RangeCmp4ToRange(uint8_t* pucCompressedData_, uint32_t uiBodyLength_, RangeStruct& stRangeMessage_, const MetaDataStruct& pstMetaData_);
 };
 
 } // namespace novatel::edie::oem
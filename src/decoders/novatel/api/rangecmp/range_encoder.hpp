@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file range_encoder.hpp
+//! \brief Encode RANGE messages straight from a RangeStruct.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef RANGECMP_RANGE_ENCODER_HPP
+#define RANGECMP_RANGE_ENCODER_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "decoders/novatel/api/encoder.hpp"
+#include "decoders/novatel/api/rangecmp/common.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class RangeEncoder
+//! \brief Encodes RANGE messages from the RangeStruct produced by the
+//! RangeDecompressor.
+//
+//! A binary RANGE body is a RangeStruct truncated to its observations, so
+//! the observations are encoded field by field straight from the struct
+//! rather than decoded into an IntermediateMessage first. The field names
+//! and conversions still come from the RANGE definition in the database, so
+//! the output is the same as that of the Encoder.
+//============================================================================
+class RangeEncoder : public Encoder
+{
+  private:
+    // The RANGE observation fields with their offsets in a RangeDataStruct.
+    struct RangeField
+    {
+        const BaseField* pclField;
+        uint32_t uiOffset;
+    };
+
+    // The RANGE definition is resolved again on the first Encode() after the database, or its generation, changes.
+    const JsonReader* pclMyRangeDb{nullptr};
+    uint64_t ullMyRangeGeneration{0};
+    const FieldArrayField* pclMyObservationsField{nullptr};
+    std::vector<RangeField> vMyObservationFields;
+
+    [[nodiscard]] bool ResolveRangeDefinition();
+
+    [[nodiscard]] bool EncodeRangeBody(const RangeStruct& stRange_, unsigned char** ppucOutBuf_, uint32_t& uiBytesLeft_, ENCODEFORMAT eFormat_);
+    [[nodiscard]] bool EncodeRangeBinaryBody(const RangeStruct& stRange_, unsigned char** ppucOutBuf_, uint32_t& uiBytesLeft_, bool bFlatten_);
+    [[nodiscard]] bool EncodeRangeAsciiBody(const RangeStruct& stRange_, char** ppcOutBuf_, uint32_t& uiBytesLeft_);
+    [[nodiscard]] bool EncodeRangeJsonBody(const RangeStruct& stRange_, char** ppcOutBuf_, uint32_t& uiBytesLeft_);
+
+  public:
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for the RangeEncoder class.
+    //
+    //! \param[in] pclJsonDb_ A pointer to a JsonReader object.  Defaults to nullptr.
+    //----------------------------------------------------------------------------
+    RangeEncoder(JsonReader* pclJsonDb_ = nullptr);
+
+    //----------------------------------------------------------------------------
+    //! \brief Encode a RANGE message from a header and a RangeStruct.
+    //
+    //! \param[out] ppucEncodeBuffer_ A pointer to the buffer to return the encoded
+    //! message to.
+    //! \param[in] uiEncodeBufferSize_ The length of ppcEncodeBuffer_.
+    //! \param[in] stHeader_ A reference to the RANGE header intermediate.
+    //! \param[in] stRange_ The RANGE message to encode.
+    //! \param[out] stMessageData_ A reference to a MessageDataStruct to be
+    //! populated by the encoder.
+    //! \param[in] stMetaData_ A reference to a populated MetaDataStruct
+    //! containing relevant information about the decoded log.
+    //! \param[in] eEncodeFormat_ The format to encode the message to.
+    //
+    //! \return The same error codes as Encoder::Encode. UNSUPPORTED is also
+    //! returned for ABBREV_ASCII and if the RANGE definition in the database
+    //! doesn't match a RangeStruct, in which case the message can still be
+    //! encoded with Encoder::Encode.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS Encode(unsigned char** ppucEncodeBuffer_, uint32_t uiEncodeBufferSize_, IntermediateHeader& stHeader_,
+                                const RangeStruct& stRange_, MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_,
+                                ENCODEFORMAT eEncodeFormat_);
+
+    using Encoder::Encode;
+};
+
+} // namespace novatel::edie::oem
+
+#endif // RANGECMP_RANGE_ENCODER_HPP
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file range_observations.hpp
+//! \brief Columnar storage for the observations of RANGE messages.
+////////////////////////////////////////////////////////////////////////
+
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef RANGECMP_RANGE_OBSERVATIONS_HPP
+#define RANGECMP_RANGE_OBSERVATIONS_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <stdint.h>
+
+#include <vector>
+
+#include "decoders/novatel/api/rangecmp/common.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \struct RangeObservations
+//! \brief The observations of a RANGE message as one array per field.
+//
+//! Element i of every array belongs to observation i, in the order of the
+//! RANGE message. Assign() resizes the arrays rather than reallocating them,
+//! so a RangeObservations that is reused for every epoch only allocates
+//! when an epoch has more observations than any before it.
+//============================================================================
+struct RangeObservations
+{
+    std::vector<uint16_t> vusPRN;
+    std::vector<int16_t> vsGLONASSFrequency;
+    std::vector<ChannelTrackingStatusStruct::SATELLITE_SYSTEM> veSatelliteSystem;
+    std::vector<ChannelTrackingStatusStruct::SIGNAL_TYPE> veSignalType;
+    std::vector<double> vdPSR;
+    std::vector<float> vfPSRStdDev;
+    std::vector<double> vdADR;
+    std::vector<float> vfADRStdDev;
+    std::vector<float> vfDopplerFrequency;
+    std::vector<float> vfCNo;
+    std::vector<float> vfLockTime;
+    std::vector<uint32_t> vuiChannelTrackingStatus;
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the number of observations.
+    //
+    //! \return The length of each array.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] size_t Size() const { return vusPRN.size(); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Remove every observation, keeping the capacity of the arrays.
+    //----------------------------------------------------------------------------
+    void Clear() { Resize(0); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Replace the observations with those of a RANGE message.
+    //
+    //! \param[in] pstRangeData_ The observations of the RANGE message.
+    //! \param[in] uiNumberOfObservations_ The number of observations.
+    //----------------------------------------------------------------------------
+    void Assign(const RangeDataStruct* pstRangeData_, uint32_t uiNumberOfObservations_)
+    {
+        Resize(uiNumberOfObservations_);
+
+        for (uint32_t i = 0; i < uiNumberOfObservations_; i++)
+        {
+            const RangeDataStruct& stRangeData = pstRangeData_[i];
+            vusPRN[i] = stRangeData.usPRN;
+            vsGLONASSFrequency[i] = stRangeData.sGLONASSFrequency;
+            veSatelliteSystem[i] = static_cast<ChannelTrackingStatusStruct::SATELLITE_SYSTEM>(
+                (stRangeData.uiChannelTrackingStatus & CTS_SATELLITE_SYSTEM_MASK) >> CTS_SATELLITE_SYSTEM_SHIFT);
+            veSignalType[i] = static_cast<ChannelTrackingStatusStruct::SIGNAL_TYPE>(
+                (stRangeData.uiChannelTrackingStatus & CTS_SIGNAL_TYPE_MASK) >> CTS_SIGNAL_TYPE_SHIFT);
+            vdPSR[i] = stRangeData.dPSR;
+            vfPSRStdDev[i] = stRangeData.fPSRStdDev;
+            vdADR[i] = stRangeData.dADR;
+            vfADRStdDev[i] = stRangeData.fADRStdDev;
+            vfDopplerFrequency[i] = stRangeData.fDopplerFrequency;
+            vfCNo[i] = stRangeData.fCNo;
+            vfLockTime[i] = stRangeData.fLockTime;
+            vuiChannelTrackingStatus[i] = stRangeData.uiChannelTrackingStatus;
+        }
+    }
+
+  private:
+    void Resize(size_t sSize_)
+    {
+        vusPRN.resize(sSize_);
+        vsGLONASSFrequency.resize(sSize_);
+        veSatelliteSystem.resize(sSize_);
+        veSignalType.resize(sSize_);
+        vdPSR.resize(sSize_);
+        vfPSRStdDev.resize(sSize_);
+        vdADR.resize(sSize_);
+        vfADRStdDev.resize(sSize_);
+        vfDopplerFrequency.resize(sSize_);
+        vfCNo.resize(sSize_);
+        vfLockTime.resize(sSize_);
+        vuiChannelTrackingStatus.resize(sSize_);
+    }
+};
+
+} // namespace novatel::edie::oem
+
+#endif // RANGECMP_RANGE_OBSERVATIONS_HPP
@@ -37,10 +37,16 @@
 using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
+namespace {
+// The fixed conversions that the field map entries print with
+constexpr FixedConversion stSecondsConversion("%.3lf");
+constexpr FixedConversion stSatelliteConversion("%u");
+constexpr FixedConversion stGloChannelConversion("%+d");
+} // namespace
+
 // -------------------------------------------------------------------------------------------------------
-Encoder::Encoder(JsonReader* pclJsonDb_) : EncoderBase(pclJsonDb_)
+Encoder::Encoder(JsonReader* pclJsonDb_) : EncoderBase(OEMFieldMaps(), pclJsonDb_)
 {
-    InitFieldMaps();
     if (pclJsonDb_ != nullptr) { LoadJsonDb(pclJsonDb_); }
 }
 
@@ -53,57 +59,70 @@ void Encoder::InitEnumDefns()
 }
 
 // -------------------------------------------------------------------------------------------------------
-void Encoder::InitFieldMaps()
+const Encoder::FieldEncoderMaps& Encoder::OEMFieldMaps()
+{
+    // The OEM field encoders extend those of the EncoderBase class
+    static const FieldEncoderMaps stFieldMaps = [] {
+        FieldEncoderMaps stMaps = BaseFieldMaps();
+        InitFieldMaps(stMaps.asciiFieldMap, stMaps.jsonFieldMap);
+        return stMaps;
+    }();
+    return stFieldMaps;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void Encoder::InitFieldMaps(FieldEncoderMap& asciiFieldMap_, FieldEncoderMap& jsonFieldMap_)
 {
     // =========================================================
     // ASCII Field Mapping
     // =========================================================
-    asciiFieldMap[CalculateBlockCRC32("%s")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+    asciiFieldMap_[CalculateBlockCRC32("%s")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
         return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%c",
                              fc_.field_def->dataType.name == DATA_TYPE::UCHAR ? std::get<uint8_t>(fc_.field_value)
                                                                               : std::get<int8_t>(fc_.field_value));
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%m")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+    asciiFieldMap_[CalculateBlockCRC32("%m")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
         return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%s", pclMsgDb->MsgIdToMsgName(std::get<uint32_t>(fc_.field_value)).c_str());
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%T")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
-        return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%.3lf", std::get<uint32_t>(fc_.field_value) / 1000.0);
+    asciiFieldMap_[CalculateBlockCRC32("%T")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
+        return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stSecondsConversion, std::get<uint32_t>(fc_.field_value) / 1000.0);
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%id")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
+    asciiFieldMap_[CalculateBlockCRC32("%id")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                    [[maybe_unused]] JsonReader* pclMsgDb) {
         const uint32_t uiTempID = std::get<uint32_t>(fc_.field_value);
         const uint16_t usSV = uiTempID & 0x0000FFFF;
         const int16_t sGloChan = (uiTempID & 0xFFFF0000) >> 16;
         // short circuit eval when sGloChan == 0, otherwise print to buffer
-        return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%u", usSV) && (sGloChan == 0 || PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%+d", sGloChan));
+        return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stSatelliteConversion, usSV) &&
+               (sGloChan == 0 || FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stGloChannelConversion, sGloChan));
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%P")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+    asciiFieldMap_[CalculateBlockCRC32("%P")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
         const uint8_t uiValue = std::get<uint8_t>(fc_.field_value);
         return uiValue == '\\'                 ? PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "\\\\")              // TODO: add description
                : uiValue > 31 && uiValue < 127 ? PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%c", uiValue)       // print the character
                                                : PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "\\x%02x", uiValue); // print as a hex character within ()
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%k")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
-        return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, MakeConversionString<float>(fc_).data(), std::get<float>(fc_.field_value));
+    asciiFieldMap_[CalculateBlockCRC32("%k")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
+        return FormatAdaptiveToBuffer<float>(ppcOutBuf_, uiBytesLeft_, fc_);
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%lk")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
-        return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, MakeConversionString<double>(fc_).data(), std::get<double>(fc_.field_value));
+    asciiFieldMap_[CalculateBlockCRC32("%lk")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                    [[maybe_unused]] JsonReader* pclMsgDb) {
+        return FormatAdaptiveToBuffer<double>(ppcOutBuf_, uiBytesLeft_, fc_);
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%c")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+    asciiFieldMap_[CalculateBlockCRC32("%c")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
         return fc_.field_def->dataType.length == 1 ? PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%c", std::get<uint8_t>(fc_.field_value))
                : (fc_.field_def->dataType.length == 4 && fc_.field_def->dataType.name == DATA_TYPE::ULONG)
                    ? PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%c", std::get<uint32_t>(fc_.field_value))
@@ -113,20 +132,20 @@ void Encoder::InitFieldMaps()
     // =========================================================
     // Json Field Mapping
     // =========================================================
-    jsonFieldMap[CalculateBlockCRC32("%P")] = BasicMapEntry<uint8_t>("%hhu");
+    jsonFieldMap_[CalculateBlockCRC32("%P")] = BasicMapEntry<uint8_t>("%hhu");
 
-    jsonFieldMap[CalculateBlockCRC32("%T")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                 [[maybe_unused]] JsonReader* pclMsgDb) {
-        return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%.3lf", std::get<uint32_t>(fc_.field_value) / 1000.0);
+    jsonFieldMap_[CalculateBlockCRC32("%T")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+        return FormatToBuffer(ppcOutBuf_, uiBytesLeft_, stSecondsConversion, std::get<uint32_t>(fc_.field_value) / 1000.0);
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%m")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                 [[maybe_unused]] JsonReader* pclMsgDb) {
+    jsonFieldMap_[CalculateBlockCRC32("%m")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
         return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%s")", pclMsgDb->MsgIdToMsgName(std::get<uint32_t>(fc_.field_value)).c_str());
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%id")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+    jsonFieldMap_[CalculateBlockCRC32("%id")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
         const auto uiTempID = std::get<uint32_t>(fc_.field_value);
         const uint16_t usSV = uiTempID & 0x0000FFFF;
         const int16_t sGloChan = (uiTempID & 0xFFFF0000) >> 16;
@@ -135,25 +154,25 @@ void Encoder::InitFieldMaps()
                             : PrintToBuffer(ppcOutBuf_, uiBytesLeft_, R"("%u")", usSV);
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%k")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                 [[maybe_unused]] JsonReader* pclMsgDb) {
-        return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, MakeConversionString<float>(fc_).data(), std::get<float>(fc_.field_value));
+    jsonFieldMap_[CalculateBlockCRC32("%k")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+        return FormatAdaptiveToBuffer<float>(ppcOutBuf_, uiBytesLeft_, fc_);
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%lk")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
-        return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, MakeConversionString<double>(fc_).data(), std::get<double>(fc_.field_value));
+    jsonFieldMap_[CalculateBlockCRC32("%lk")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
+        return FormatAdaptiveToBuffer<double>(ppcOutBuf_, uiBytesLeft_, fc_);
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%s")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                 [[maybe_unused]] JsonReader* pclMsgDb) {
+    jsonFieldMap_[CalculateBlockCRC32("%s")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
         return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%c",
                              (fc_.field_def->dataType.name == DATA_TYPE::UCHAR) ? std::get<uint8_t>(fc_.field_value)
                                                                                 : std::get<int8_t>(fc_.field_value));
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%c")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
-                                                 [[maybe_unused]] JsonReader* pclMsgDb) {
+    jsonFieldMap_[CalculateBlockCRC32("%c")] = [](const FieldContainer& fc_, char** ppcOutBuf_, uint32_t& uiBytesLeft_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
         return (fc_.field_def->dataType.length == 1 && PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "\"%c\"", std::get<uint8_t>(fc_.field_value))) ||
                (fc_.field_def->dataType.length == 4 && fc_.field_def->dataType.name == DATA_TYPE::ULONG &&
                 PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "\"%c\"", std::get<uint32_t>(fc_.field_value)));
@@ -337,9 +356,9 @@ bool Encoder::EncodeJsonShortHeader(const IntermediateHeader& stInterHeader_, ch
 }
 
 // -------------------------------------------------------------------------------------------------------
-STATUS
-Encoder::Encode(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, IntermediateHeader& stHeader_, IntermediateMessage& stMessage_,
-                MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eFormat_)
+template <typename T>
+STATUS Encoder::EncodeMessage(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, IntermediateHeader& stHeader_, const T& stMessage_,
+                              MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eFormat_)
 {
     if (ppucBuffer_ == nullptr || *ppucBuffer_ == nullptr) { return STATUS::NULL_PROVIDED; }
 
@@ -363,7 +382,7 @@ Encoder::Encode(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, Intermediat
         if (!PrintToBuffer(reinterpret_cast<char**>(&pucTempEncodeBuffer), uiBufferSize_, R"(,"body": )")) { return STATUS::BUFFER_FULL; }
     }
 
-    eStatus = EncodeBody(&pucTempEncodeBuffer, uiBufferSize_, stMessage_, stMessageData_, stMetaData_, eFormat_);
+    eStatus = EncodeMessageBody(&pucTempEncodeBuffer, uiBufferSize_, stMessage_, stMessageData_, stMetaData_, eFormat_);
     if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
     pucTempEncodeBuffer += stMessageData_.uiMessageBodyLength;
@@ -379,6 +398,22 @@ Encoder::Encode(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, Intermediat
     return STATUS::SUCCESS;
 }
 
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Encoder::Encode(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, IntermediateHeader& stHeader_, IntermediateMessage& stMessage_,
+                MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eFormat_)
+{
+    return EncodeMessage(ppucBuffer_, uiBufferSize_, stHeader_, stMessage_, stMessageData_, stMetaData_, eFormat_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Encoder::Encode(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, IntermediateHeader& stHeader_, const FlatIntermediateMessage& stMessage_,
+                MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eFormat_)
+{
+    return EncodeMessage(ppucBuffer_, uiBufferSize_, stHeader_, stMessage_.GetFields(), stMessageData_, stMetaData_, eFormat_);
+}
+
 // -------------------------------------------------------------------------------------------------------
 STATUS
 Encoder::EncodeHeader(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, IntermediateHeader& stHeader_, MessageDataStruct& stMessageData_,
@@ -431,10 +466,37 @@ Encoder::EncodeHeader(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, Inter
     return STATUS::SUCCESS;
 }
 
+// -------------------------------------------------------------------------------------------------------
+bool Encoder::EncodeAsciiFooter(char** ppcOutBuf_, uint32_t& uiBytesLeft_, const MessageDataStruct& stMessageData_)
+{
+    (*ppcOutBuf_)--; // Remove last delimiter ','
+    const auto* pucHeader = stMessageData_.pucMessageHeader;
+    uint32_t uiCRC = CalculateBlockCRC32(reinterpret_cast<unsigned char*>(*ppcOutBuf_) - pucHeader - 1, 0, pucHeader + 1);
+    return PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "*%08x\r\n", uiCRC);
+}
+
 // -------------------------------------------------------------------------------------------------------
 STATUS
-Encoder::EncodeBody(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, IntermediateMessage& stMessage_, MessageDataStruct& stMessageData_,
-                    MetaDataStruct& stMetaData_, ENCODEFORMAT eFormat_)
+Encoder::EncodeBinaryFooter(const unsigned char* pucBody_, unsigned char** ppucOutBuf_, uint32_t& uiBytesLeft_,
+                            const MessageDataStruct& stMessageData_, const MetaDataStruct& stMetaData_)
+{
+    // MessageData must have a valid MessageHeader pointer to populate the length field.
+    if (stMessageData_.pucMessageHeader == nullptr) { return STATUS::FAILURE; }
+    // Go back and set the length field in the header.
+    // TODO: this little block of code below is whats blocking us from moving this function to common
+    if (stMetaData_.eFormat == HEADERFORMAT::ASCII || stMetaData_.eFormat == HEADERFORMAT::BINARY || stMetaData_.eFormat == HEADERFORMAT::ABB_ASCII)
+    {
+        reinterpret_cast<OEM4BinaryHeader*>(stMessageData_.pucMessageHeader)->usLength = static_cast<uint16_t>(*ppucOutBuf_ - pucBody_);
+    }
+    else { reinterpret_cast<OEM4BinaryShortHeader*>(stMessageData_.pucMessageHeader)->ucLength = static_cast<uint8_t>(*ppucOutBuf_ - pucBody_); }
+    uint32_t uiCRC = CalculateBlockCRC32(*ppucOutBuf_ - stMessageData_.pucMessageHeader, 0, stMessageData_.pucMessageHeader);
+    return CopyToBuffer(ppucOutBuf_, uiBytesLeft_, &uiCRC) ? STATUS::SUCCESS : STATUS::BUFFER_FULL;
+}
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T>
+STATUS Encoder::EncodeMessageBody(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, const T& stMessage_, MessageDataStruct& stMessageData_,
+                                  MetaDataStruct& stMetaData_, ENCODEFORMAT eFormat_)
 {
     // TODO: this entire function should be in common, only header stuff and map redefinitions belong in this file
     if (ppucBuffer_ == nullptr || *ppucBuffer_ == nullptr) { return STATUS::NULL_PROVIDED; }
@@ -447,9 +509,7 @@ Encoder::EncodeBody(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, Interme
     {
     case ENCODEFORMAT::ASCII: {
         if (!EncodeAsciiBody<false>(stMessage_, reinterpret_cast<char**>(&pucTempBuffer), uiBufferSize_)) { return STATUS::BUFFER_FULL; }
-        pucTempBuffer--; // Remove last delimiter ','
-        uint32_t uiCRC = CalculateBlockCRC32(pucTempBuffer - stMessageData_.pucMessageHeader - 1, 0, stMessageData_.pucMessageHeader + 1);
-        if (!PrintToBuffer(reinterpret_cast<char**>(&pucTempBuffer), uiBufferSize_, "*%08x\r\n", uiCRC)) { return STATUS::BUFFER_FULL; }
+        if (!EncodeAsciiFooter(reinterpret_cast<char**>(&pucTempBuffer), uiBufferSize_, stMessageData_)) { return STATUS::BUFFER_FULL; }
         break;
     }
     case ENCODEFORMAT::ABBREV_ASCII:
@@ -464,21 +524,8 @@ Encoder::EncodeBody(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, Interme
 
     case ENCODEFORMAT::BINARY: {
         if (eFormat_ == ENCODEFORMAT::BINARY && !EncodeBinaryBody<false>(stMessage_, &pucTempBuffer, uiBufferSize_)) { return STATUS::BUFFER_FULL; }
-        // MessageData must have a valid MessageHeader pointer to populate the length field.
-        if (stMessageData_.pucMessageHeader == nullptr) { return STATUS::FAILURE; }
-        // Go back and set the length field in the header.
-        // TODO: this little block of code below is whats blocking us from moving this function to common
-        if (stMetaData_.eFormat == HEADERFORMAT::ASCII || stMetaData_.eFormat == HEADERFORMAT::BINARY ||
-            stMetaData_.eFormat == HEADERFORMAT::ABB_ASCII)
-        {
-            reinterpret_cast<OEM4BinaryHeader*>(stMessageData_.pucMessageHeader)->usLength = static_cast<uint16_t>(pucTempBuffer - *ppucBuffer_);
-        }
-        else
-        {
-            reinterpret_cast<OEM4BinaryShortHeader*>(stMessageData_.pucMessageHeader)->ucLength = static_cast<uint8_t>(pucTempBuffer - *ppucBuffer_);
-        }
-        uint32_t uiCRC = CalculateBlockCRC32(pucTempBuffer - stMessageData_.pucMessageHeader, 0, stMessageData_.pucMessageHeader);
-        if (!CopyToBuffer(&pucTempBuffer, uiBufferSize_, &uiCRC)) { return STATUS::BUFFER_FULL; }
+        const STATUS eStatus = EncodeBinaryFooter(*ppucBuffer_, &pucTempBuffer, uiBufferSize_, stMessageData_, stMetaData_);
+        if (eStatus != STATUS::SUCCESS) { return eStatus; }
         break;
     }
     case ENCODEFORMAT::JSON:
@@ -493,3 +540,19 @@ Encoder::EncodeBody(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, Interme
     stMessageData_.uiMessageBodyLength = pucTempBuffer - stMessageData_.pucMessageBody;
     return STATUS::SUCCESS;
 }
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Encoder::EncodeBody(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, IntermediateMessage& stMessage_, MessageDataStruct& stMessageData_,
+                    MetaDataStruct& stMetaData_, ENCODEFORMAT eFormat_)
+{
+    return EncodeMessageBody(ppucBuffer_, uiBufferSize_, stMessage_, stMessageData_, stMetaData_, eFormat_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Encoder::EncodeBody(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, const FlatIntermediateMessage& stMessage_,
+                    MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eFormat_)
+{
+    return EncodeMessageBody(ppucBuffer_, uiBufferSize_, stMessage_.GetFields(), stMessageData_, stMetaData_, eFormat_);
+}
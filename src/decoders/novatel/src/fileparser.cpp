@@ -32,6 +32,9 @@
 //-----------------------------------------------------------------------
 #include "decoders/novatel/api/fileparser.hpp"
 
+#include <algorithm>
+#include <fstream>
+
 using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
@@ -72,13 +75,21 @@ FileParser::FileParser(JsonReader* pclJsonDb_)
 // -------------------------------------------------------------------------------------------------------
 FileParser::~FileParser()
 {
+    DiscardChunks();
     if (pcMyStreamReadBuffer) { delete[] pcMyStreamReadBuffer; }
 }
 
 // -------------------------------------------------------------------------------------------------------
 void FileParser::LoadJsonDb(JsonReader* pclJsonDb_)
 {
-    if (pclJsonDb_ != nullptr) { clMyParser.LoadJsonDb(pclJsonDb_); }
+    if (pclJsonDb_ != nullptr)
+    {
+        clMyParser.LoadJsonDb(pclJsonDb_);
+
+        // The chunk Parsers are rebuilt over the new database when chunks are next started
+        DiscardChunks();
+        vMyChunkParsers.clear();
+    }
     else { pclMyLogger->debug("JSON DB is a NULL pointer."); }
 }
 
@@ -112,6 +123,31 @@ void FileParser::SetDecompressRangeCmp(bool bDecompressRangeCmp_) { clMyParser.S
 // -------------------------------------------------------------------------------------------------------
 bool FileParser::GetDecompressRangeCmp() { return clMyParser.GetDecompressRangeCmp(); }
 
+// -------------------------------------------------------------------------------------------------------
+void FileParser::SetPassthrough(bool bPassthrough_) { clMyParser.SetPassthrough(bPassthrough_); }
+
+// -------------------------------------------------------------------------------------------------------
+bool FileParser::GetPassthrough() { return clMyParser.GetPassthrough(); }
+
+// -------------------------------------------------------------------------------------------------------
+void FileParser::SetWorkerThreads(uint32_t uiThreads_) { clMyParser.SetWorkerThreads(uiThreads_); }
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t FileParser::GetWorkerThreads() { return clMyParser.GetWorkerThreads(); }
+
+// -------------------------------------------------------------------------------------------------------
+void FileParser::SetChunkThreads(uint32_t uiThreads_, uint64_t ullChunkSize_)
+{
+    DiscardChunks();
+    vMyChunkParsers.clear();
+    uiMyChunkThreads = std::max(uiThreads_, 1U);
+    ullMyChunkSize = std::max<uint64_t>(ullChunkSize_, 1);
+    ullMyNextChunk = 0;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t FileParser::GetChunkThreads() { return uiMyChunkThreads; }
+
 // -------------------------------------------------------------------------------------------------------
 void FileParser::SetReturnUnknownBytes(bool bReturnUnknownBytes_) { clMyParser.SetReturnUnknownBytes(bReturnUnknownBytes_); }
 
@@ -156,6 +192,27 @@ bool FileParser::SetStream(InputFileStream* pclInputStream_)
     stMyReadData.uiDataSize = uiReadSizeSave;
 
     pclMyInputStream = pclInputStream_;
+    pclMyMappedStream = nullptr;
+    clMyFilePath = std::filesystem::path(pclInputStream_->pInFileStream->Get32StringFileName());
+
+    Reset();
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool FileParser::SetStream(InputMappedFileStream* pclInputStream_)
+{
+    if (!pclInputStream_) { return false; }
+
+    // Are there any bytes left to read in the stream?
+    const unsigned char* pucData = nullptr;
+    stMyStreamReadStatus = pclInputStream_->ReadDataInPlace(pucData, 0);
+    if (stMyStreamReadStatus.bEOS || stMyStreamReadStatus.uiPercentStreamRead >= 100) { return false; }
+
+    pclMyMappedStream = pclInputStream_;
+    pclMyInputStream = nullptr;
+    clMyFilePath = pclInputStream_->GetFilePath();
 
     Reset();
 
@@ -165,6 +222,14 @@ bool FileParser::SetStream(InputFileStream* pclInputStream_)
 // -------------------------------------------------------------------------------------------------------
 bool FileParser::ReadStream()
 {
+    if (pclMyMappedStream != nullptr)
+    {
+        const unsigned char* pucData = nullptr;
+        stMyStreamReadStatus = pclMyMappedStream->ReadDataInPlace(pucData, MAX_ASCII_MESSAGE_LENGTH);
+        return stMyStreamReadStatus.uiCurrentStreamRead > 0 &&
+               clMyParser.Write(pucData, stMyStreamReadStatus.uiCurrentStreamRead) == stMyStreamReadStatus.uiCurrentStreamRead;
+    }
+
     stMyReadData.uiDataSize = MAX_ASCII_MESSAGE_LENGTH;
     stMyStreamReadStatus = pclMyInputStream->ReadData(stMyReadData);
     return stMyStreamReadStatus.uiCurrentStreamRead > 0 &&
@@ -175,6 +240,8 @@ bool FileParser::ReadStream()
 // -------------------------------------------------------------------------------------------------------
 [[nodiscard]] STATUS FileParser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_)
 {
+    if (uiMyChunkThreads > 1 && (pclMyInputStream != nullptr || pclMyMappedStream != nullptr)) { return ReadChunked(stMessageData_, stMetaData_); }
+
     STATUS eStatus = STATUS::UNKNOWN;
     while (true)
     {
@@ -201,10 +268,300 @@ bool FileParser::ReadStream()
 // -------------------------------------------------------------------------------------------------------
 bool FileParser::Reset()
 {
+    DiscardChunks();
+    ullMyNextChunk = 0;
     Flush();
     if (pclMyInputStream != nullptr) { pclMyInputStream->Reset(0, std::ios::beg); }
+    if (pclMyMappedStream != nullptr) { pclMyMappedStream->Reset(0, std::ios::beg); }
     return true;
 }
 
 // -------------------------------------------------------------------------------------------------------
 uint32_t FileParser::Flush(unsigned char* pucBuffer_, uint32_t uiBufferSize_) { return clMyParser.Flush(pucBuffer_, uiBufferSize_); }
+
+// -------------------------------------------------------------------------------------------------------
+uint64_t FileParser::FindFrameBoundary(std::istream& clFile_, uint64_t ullOffset_) const
+{
+    Framer clFramer;
+    MetaDataStruct stMetaData;
+    std::vector<unsigned char> vReadBuffer(MAX_ASCII_MESSAGE_LENGTH);
+    std::vector<unsigned char> vFrameBuffer(Parser::uiPARSER_INTERNAL_BUFFER_SIZE);
+    uint64_t ullSkipped = 0;
+    bool bEndOfFile = false;
+
+    clFile_.clear();
+    clFile_.seekg(static_cast<std::streamoff>(ullOffset_));
+
+    while (true)
+    {
+        const STATUS eStatus = clFramer.GetFrame(vFrameBuffer.data(), static_cast<uint32_t>(vFrameBuffer.size()), stMetaData);
+
+        if (eStatus == STATUS::SUCCESS)
+        {
+            switch (stMetaData.eFormat)
+            {
+            case HEADERFORMAT::BINARY:
+            case HEADERFORMAT::SHORT_BINARY:
+            case HEADERFORMAT::PROPRIETARY_BINARY:
+            case HEADERFORMAT::ASCII:
+            case HEADERFORMAT::SHORT_ASCII: return ullOffset_ + ullSkipped;
+            default: ullSkipped += stMetaData.uiLength; break;
+            }
+        }
+        else if (eStatus == STATUS::INCOMPLETE || eStatus == STATUS::BUFFER_EMPTY)
+        {
+            if (bEndOfFile) { return ullMyFileSize; }
+
+            clFile_.read(reinterpret_cast<char*>(vReadBuffer.data()), static_cast<std::streamsize>(vReadBuffer.size()));
+            const auto uiRead = static_cast<uint32_t>(clFile_.gcount());
+            if (uiRead == 0) { bEndOfFile = true; }
+            else { clFramer.Write(vReadBuffer.data(), uiRead); }
+        }
+        else { ullSkipped += stMetaData.uiLength; }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::unique_ptr<FileParser::Chunk> FileParser::ParseChunk(uint64_t ullChunk_, Parser& clParser_, uint64_t ullBegin_) const
+{
+    auto pclChunk = std::make_unique<Chunk>();
+    const bool bLastChunk = ullChunk_ + 1 == ullMyChunkCount;
+
+    // A chunk that failed part way through may have left bytes behind
+    clParser_.Flush();
+
+    std::ifstream clFile(clMyFilePath, std::ios::binary);
+    if (!clFile) { throw std::runtime_error("Could not open " + clMyFilePath.string()); }
+
+    if (ullBegin_ == ullFIND_BEGIN) { ullBegin_ = ullChunk_ == 0 ? 0 : FindFrameBoundary(clFile, ullChunk_ * ullMyChunkSize); }
+    const uint64_t ullNext = bLastChunk ? ullMyFileSize : std::max(ullBegin_, FindFrameBoundary(clFile, (ullChunk_ + 1) * ullMyChunkSize));
+    pclChunk->ullBegin = ullBegin_;
+
+    // Enough of the next chunk to finish any message straddling its begin
+    const uint64_t ullInputEnd =
+        bLastChunk ? ullMyFileSize : std::min(ullMyFileSize, ullNext + Parser::uiPARSER_INTERNAL_BUFFER_SIZE + MAX_ASCII_MESSAGE_LENGTH);
+
+    std::vector<unsigned char> vInput(std::max(ullInputEnd, ullBegin_) - ullBegin_);
+    clFile.clear();
+    clFile.seekg(static_cast<std::streamoff>(ullBegin_));
+    clFile.read(reinterpret_cast<char*>(vInput.data()), static_cast<std::streamsize>(vInput.size()));
+    vInput.resize(static_cast<size_t>(clFile.gcount()));
+
+    const bool bDecompressRangeCmp = clParser_.GetDecompressRangeCmp();
+    MessageDataStruct stMessageData;
+    MetaDataStruct stMetaData;
+    STATUS eStatus;
+    size_t ulPosition = 0;
+
+    // The offset in the file of the first byte that the Parser hasn't framed
+    auto Framed = [&] { return ullBegin_ + ulPosition - clParser_.GetBytesInBuffer(); };
+
+    auto ReadMessage = [&](bool bDecodeIncompleteAbbv_) {
+        stMessageData = MessageDataStruct();
+        return clParser_.Read(stMessageData, stMetaData, bDecodeIncompleteAbbv_);
+    };
+
+    // Keep a copy of a message, pointing into the chunk's data where one part is contained by another
+    auto StoreMessage = [&](STATUS eStatus_) {
+        ChunkMessage& stMessage = pclChunk->vMessages.emplace_back();
+        std::vector<unsigned char>& vData = pclChunk->vData;
+        stMessage.eStatus = eStatus_;
+        stMessage.stMetaData = stMetaData;
+        stMessage.ullEnd = Framed();
+        stMessage.bDeferred = eStatus_ == STATUS::SUCCESS && bDecompressRangeCmp &&
+                              (stMetaData.usMessageID == RANGECMP_MSG_ID || stMetaData.usMessageID == RANGECMP2_MSG_ID ||
+                               stMetaData.usMessageID == RANGECMP3_MSG_ID || stMetaData.usMessageID == RANGECMP4_MSG_ID);
+
+        const unsigned char* pucMessage = stMessageData.pucMessage;
+        if (pucMessage != nullptr)
+        {
+            stMessage.ullMessage = vData.size();
+            stMessage.uiMessageLength = stMessageData.uiMessageLength;
+            vData.insert(vData.end(), pucMessage, pucMessage + stMessageData.uiMessageLength);
+        }
+
+        auto StorePart = [&](const unsigned char* pucPart_, uint32_t uiLength_) {
+            if (pucPart_ == nullptr) { return ChunkMessage::ullNO_DATA; }
+            if (pucMessage != nullptr && pucPart_ >= pucMessage && pucPart_ + uiLength_ <= pucMessage + stMessageData.uiMessageLength)
+            {
+                return stMessage.ullMessage + static_cast<uint64_t>(pucPart_ - pucMessage);
+            }
+            const uint64_t ullPart = vData.size();
+            vData.insert(vData.end(), pucPart_, pucPart_ + uiLength_);
+            return ullPart;
+        };
+        stMessage.ullHeader = StorePart(stMessageData.pucMessageHeader, stMessageData.uiMessageHeaderLength);
+        stMessage.uiHeaderLength = stMessageData.uiMessageHeaderLength;
+        stMessage.ullBody = StorePart(stMessageData.pucMessageBody, stMessageData.uiMessageBodyLength);
+        stMessage.uiBodyLength = stMessageData.uiMessageBodyLength;
+    };
+
+    // The chunk ends on the first frame boundary the Parser reaches at or after the begin of the next chunk. That is
+    // the begin of the next chunk itself, unless the next chunk began inside a message.
+    auto Ended = [&] { return !bLastChunk && Framed() >= ullNext; };
+
+    // Feed the Parser the way ReadStream() does, so that the messages match parsing the file as one stream. A write
+    // stops short at the begin of the next chunk, so that the Parser is seen to reach it.
+    bool bEnded = Ended();
+    while (!bEnded && ulPosition < vInput.size())
+    {
+        const size_t ulLimit = ullBegin_ + ulPosition < ullNext ? std::min<size_t>(ullNext - ullBegin_, vInput.size()) : vInput.size();
+        const auto uiWrite = static_cast<uint32_t>(std::min<size_t>(MAX_ASCII_MESSAGE_LENGTH, ulLimit - ulPosition));
+        const uint32_t uiWritten = clParser_.Write(vInput.data() + ulPosition, uiWrite);
+        ulPosition += uiWritten;
+
+        while (!bEnded && (eStatus = ReadMessage(false)) != STATUS::BUFFER_EMPTY)
+        {
+            StoreMessage(eStatus);
+            bEnded = Ended();
+        }
+        bEnded = Ended();
+        if (uiWritten == 0) { break; }
+    }
+
+    // The file ends with this chunk, so stop where Read() would report STREAM_EMPTY
+    if (!bEnded && ullBegin_ + ulPosition == ullMyFileSize)
+    {
+        while (ReadMessage(true) == STATUS::SUCCESS) { StoreMessage(STATUS::SUCCESS); }
+        clParser_.Flush();
+    }
+
+    // Whatever is left belongs to the next chunk
+    pclChunk->ullEnd = Framed();
+    clParser_.Flush();
+    return pclChunk;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void FileParser::LaunchChunks()
+{
+    while (dqMyChunks.size() < uiMyChunkThreads && ullMyNextChunk < ullMyChunkCount)
+    {
+        // The oldest chunk has been read out of every Parser that is not in flight, so this one is free. Its settings
+        // are taken here, as the chunk thread must not read clMyParser while the caller may change it.
+        std::unique_ptr<Parser>& pclParser = vMyChunkParsers[ullMyNextChunk % vMyChunkParsers.size()];
+        auto ParseNextChunk = [this, &pclParser, ullChunk = ullMyNextChunk, pclJsonDb = clMyParser.GetJsonDb(),
+                               eEncodeFormat = clMyParser.GetEncodeFormat(), pclFilter = clMyParser.GetFilter(),
+                               bIgnoreAbbreviated = clMyParser.GetIgnoreAbbreviatedAsciiResponses(), bPassthrough = clMyParser.GetPassthrough(),
+                               bDecompressRangeCmp = clMyParser.GetDecompressRangeCmp()] {
+            // A Parser is built on the first chunk thread to use it, so the first chunks don't wait on the others
+            if (!pclParser) { pclParser = std::make_unique<Parser>(pclJsonDb); }
+            pclParser->SetEncodeFormat(eEncodeFormat);
+            pclParser->SetFilter(pclFilter);
+            // Unknown bytes are kept to find where chunks end, and dropped by ReadChunked() if they aren't wanted
+            pclParser->SetReturnUnknownBytes(true);
+            pclParser->SetIgnoreAbbreviatedAsciiResponses(bIgnoreAbbreviated);
+            pclParser->SetPassthrough(bPassthrough);
+            pclParser->SetDecompressRangeCmp(bDecompressRangeCmp);
+            pclParser->SetDeferRangeCmp(true);
+            return ParseChunk(ullChunk, *pclParser, ullFIND_BEGIN);
+        };
+
+        dqMyChunks.push_back(std::async(std::launch::async, ParseNextChunk));
+        ++ullMyNextChunk;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------------
+void FileParser::DiscardChunks()
+{
+    for (auto& clChunk : dqMyChunks)
+    {
+        if (clChunk.valid()) { clChunk.wait(); }
+    }
+    dqMyChunks.clear();
+    pclMyChunk.reset();
+    ulMyChunkMessage = 0;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+FileParser::ReadChunked(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_)
+{
+    // Chunks are found from the start of the file on the first read
+    if (ullMyNextChunk == 0 && dqMyChunks.empty() && !pclMyChunk)
+    {
+        std::error_code clError;
+        ullMyFileSize = std::filesystem::file_size(clMyFilePath, clError);
+        if (clError) { return STATUS::STREAM_EMPTY; }
+
+        ullMyChunkCount = (ullMyFileSize + ullMyChunkSize - 1) / ullMyChunkSize;
+        // Each Parser is built by the chunk thread that first uses it
+        if (vMyChunkParsers.empty()) { vMyChunkParsers.resize(uiMyChunkThreads); }
+        ullMyChunkEnd = 0;
+        clMyParser.Flush();
+        LaunchChunks();
+    }
+
+    while (true)
+    {
+        if (pclMyChunk && ulMyChunkMessage < pclMyChunk->vMessages.size())
+        {
+            const ChunkMessage& stMessage = pclMyChunk->vMessages[ulMyChunkMessage++];
+            if (stMessage.eStatus == STATUS::UNKNOWN && !clMyParser.GetReturnUnknownBytes()) { continue; }
+
+            unsigned char* pucData = pclMyChunk->vData.data();
+            auto GetPart = [pucData](uint64_t ullOffset_) { return ullOffset_ == ChunkMessage::ullNO_DATA ? nullptr : pucData + ullOffset_; };
+
+            stMessageData_.pucMessage = GetPart(stMessage.ullMessage);
+            stMessageData_.uiMessageLength = stMessage.uiMessageLength;
+            stMessageData_.pucMessageHeader = GetPart(stMessage.ullHeader);
+            stMessageData_.uiMessageHeaderLength = stMessage.uiHeaderLength;
+            stMessageData_.pucMessageBody = GetPart(stMessage.ullBody);
+            stMessageData_.uiMessageBodyLength = stMessage.uiBodyLength;
+            stMetaData_ = stMessage.stMetaData;
+
+            if (!stMessage.bDeferred) { return stMessage.eStatus; }
+
+            // Decompression depends on the RANGECMP messages before this one, so it happens here in file order
+            clMyParser.Write(stMessageData_.pucMessage, stMessageData_.uiMessageLength);
+            const STATUS eStatus = clMyParser.Read(stMessageData_, stMetaData_);
+            if (eStatus == STATUS::SUCCESS || eStatus == STATUS::UNKNOWN) { return eStatus; }
+            if (eStatus != STATUS::BUFFER_EMPTY)
+            {
+                pclMyLogger->info("Encountered an error: {}\n", static_cast<int32_t>(eStatus));
+                return eStatus;
+            }
+            continue;
+        }
+
+        if (pclMyChunk)
+        {
+            stMyStreamReadStatus.uiPercentStreamRead = ullMyFileSize == 0 ? 100 : static_cast<uint32_t>(pclMyChunk->ullEnd * 100 / ullMyFileSize);
+            ullMyChunkEnd = pclMyChunk->ullEnd;
+            pclMyChunk.reset();
+            ulMyChunkMessage = 0;
+        }
+
+        if (dqMyChunks.empty())
+        {
+            stMyStreamReadStatus.bEOS = true;
+            return STATUS::STREAM_EMPTY;
+        }
+
+        // Rethrows anything thrown while parsing the chunk
+        const uint64_t ullChunk = ullMyNextChunk - dqMyChunks.size();
+        pclMyChunk = dqMyChunks.front().get();
+        dqMyChunks.pop_front();
+
+        // The chunk before ended where its Parser reached a frame boundary, at or after the begin of this chunk. Pick
+        // this chunk up from there, or parse it again from there if its Parser didn't reach the same boundary, as it
+        // began inside a message.
+        if (pclMyChunk->ullBegin != ullMyChunkEnd)
+        {
+            const std::vector<ChunkMessage>& vMessages = pclMyChunk->vMessages;
+            const auto itBoundary = std::find_if(vMessages.begin(), vMessages.end(),
+                                                 [this](const ChunkMessage& stMessage_) { return stMessage_.ullEnd >= ullMyChunkEnd; });
+            if (itBoundary != vMessages.end() && itBoundary->ullEnd == ullMyChunkEnd)
+            {
+                ulMyChunkMessage = static_cast<size_t>(itBoundary - vMessages.begin()) + 1;
+            }
+            else
+            {
+                // None of the chunks in flight use this chunk's Parser until LaunchChunks() is called
+                pclMyChunk = ParseChunk(ullChunk, *vMyChunkParsers[ullChunk % vMyChunkParsers.size()], ullMyChunkEnd);
+            }
+        }
+        LaunchChunks();
+    }
+}
@@ -32,11 +32,37 @@
 //-----------------------------------------------------------------------
 #include "framer.hpp"
 
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+
 #include "crc32.hpp"
 
 using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
+namespace {
+
+//-----------------------------------------------------------------------
+// Lookup tables for the bulk-scan fast path
+//-----------------------------------------------------------------------
+constexpr std::array<bool, 256> MakeByteTable(std::initializer_list<unsigned char> lucBytes_, bool bNonAscii_ = false)
+{
+    std::array<bool, 256> abTable{};
+    for (unsigned char ucByte : lucBytes_) { abTable[ucByte] = true; }
+    for (uint32_t i = 128; bNonAscii_ && i < 256; i++) { abTable[i] = true; }
+    return abTable;
+}
+
+// Bytes that can move the framer out of WAITING_FOR_SYNC
+constexpr auto abSyncBytes = MakeByteTable({OEM4_BINARY_SYNC1, OEM4_ASCII_SYNC, OEM4_SHORT_ASCII_SYNC, NMEA_SYNC, OEM4_ABBREV_ASCII_SYNC});
+constexpr auto abSyncBytesJson = MakeByteTable({OEM4_BINARY_SYNC1, OEM4_ASCII_SYNC, OEM4_SHORT_ASCII_SYNC, NMEA_SYNC, OEM4_ABBREV_ASCII_SYNC, '{'});
+
+// Bytes that end a run of plain ASCII header/body characters
+constexpr auto abAsciiBodyStop = MakeByteTable({OEM4_ASCII_CRC_DELIMITER}, true);
+
+} // namespace
+
 // -------------------------------------------------------------------------------------------------------
 Framer::Framer() : FramerBase("novatel_framer") {}
 
@@ -82,6 +108,16 @@ bool Framer::IsAbbrevAsciiResponse() const
     return false;
 }
 
+// -------------------------------------------------------------------------------------------------------
+void Framer::ConsumeBinaryHeader(const uint32_t uiHeaderLength_, MetaDataStruct& stMetaData_)
+{
+    // The current byte is part of the header, so start the CRC one byte back
+    const uint32_t uiBlockEnd = std::min(uiHeaderLength_, clMyCircularDataBuffer.GetLength());
+    uiMyCalculatedCRC32 = clMyCircularDataBuffer.CalculateCRC32(uiMyByteCount - 1, uiBlockEnd - uiMyByteCount + 1, uiMyCalculatedCRC32);
+    uiMyByteCount = uiBlockEnd;
+    stMetaData_.uiLength = uiMyByteCount;
+}
+
 // -------------------------------------------------------------------------------------------------------
 void Framer::ResetState() { eMyFrameState = NovAtelFrameState::WAITING_FOR_SYNC; }
 
@@ -91,11 +127,22 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
 {
     if (pucFrameBuffer_ == nullptr) { return STATUS::NULL_PROVIDED; }
 
+    // A frame left in place by the previous call is no longer needed
+    ReleaseFrame();
+
     // Loop buffer to complete NovAtel message
     while (eMyFrameState != NovAtelFrameState::COMPLETE_MESSAGE)
     {
         stMetaData_.bResponse = false;
 
+        // Bytes that aren't sync bytes leave the framer waiting for sync, so hop straight to the next candidate.
+        // The scan stops at the frame buffer size so that oversized runs of unknown bytes are split as before.
+        if (bMyBulkScan && eMyFrameState == NovAtelFrameState::WAITING_FOR_SYNC)
+        {
+            uiMyByteCount = clMyCircularDataBuffer.FindFirstOf(uiMyByteCount, std::max(uiMyByteCount, uiFrameBufferSize_),
+                                                               bMyFrameJson ? abSyncBytesJson : abSyncBytes);
+        }
+
         // Read data from circular buffer until we reach the end or we didn't find a complete frame in current data buffer
         if (clMyCircularDataBuffer.GetLength() == uiMyByteCount)
         {
@@ -232,7 +279,8 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
             break;
 
         case NovAtelFrameState::WAITING_FOR_BINARY_HEADER: {
-            CalculateCharacterCRC32(uiMyCalculatedCRC32, ucDataByte);
+            if (bMyBulkScan) { ConsumeBinaryHeader(OEM4_BINARY_HEADER_LENGTH, stMetaData_); }
+            else { CalculateCharacterCRC32(uiMyCalculatedCRC32, ucDataByte); }
 
             if (uiMyByteCount == OEM4_BINARY_HEADER_LENGTH)
             {
@@ -273,7 +321,8 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
             break;
         }
         case NovAtelFrameState::WAITING_FOR_SHORT_BINARY_HEADER: {
-            CalculateCharacterCRC32(uiMyCalculatedCRC32, ucDataByte);
+            if (bMyBulkScan) { ConsumeBinaryHeader(OEM4_SHORT_BINARY_HEADER_LENGTH, stMetaData_); }
+            else { CalculateCharacterCRC32(uiMyCalculatedCRC32, ucDataByte); }
 
             if (uiMyByteCount == OEM4_SHORT_BINARY_HEADER_LENGTH)
             {
@@ -313,8 +362,13 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
             }
             break;
         }
-        case NovAtelFrameState::WAITING_FOR_BINARY_BODY_AND_CRC:
-            CalculateCharacterCRC32(uiMyCalculatedCRC32, ucDataByte);
+        case NovAtelFrameState::WAITING_FOR_BINARY_BODY_AND_CRC: {
+            // The message length is known from the header, so run the CRC over all of the body that has been
+            // buffered in a single block rather than a byte at a time. The current byte is included in the block.
+            const uint32_t uiBlockEnd = std::min(uiMyExpectedMessageLength, clMyCircularDataBuffer.GetLength());
+            uiMyCalculatedCRC32 = clMyCircularDataBuffer.CalculateCRC32(uiMyByteCount - 1, uiBlockEnd - uiMyByteCount + 1, uiMyCalculatedCRC32);
+            uiMyByteCount = uiBlockEnd;
+            stMetaData_.uiLength = uiMyByteCount;
 
             if (uiMyByteCount == uiMyExpectedMessageLength)
             {
@@ -326,11 +380,11 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
                         clMyCircularDataBuffer.Discard((uiMyExpectedMessageLength - uiMyExpectedPayloadLength) + OEM4_BINARY_CRC_LENGTH);
                         clMyCircularDataBuffer.Copy(pucFrameBuffer_, stMetaData_.uiLength);
                         clMyCircularDataBuffer.Discard(uiMyExpectedPayloadLength + OEM4_BINARY_CRC_LENGTH);
+                        pucMyFrame = pucFrameBuffer_;
                     }
                     else
                     {
-                        clMyCircularDataBuffer.Copy(pucFrameBuffer_, stMetaData_.uiLength);
-                        clMyCircularDataBuffer.Discard(stMetaData_.uiLength);
+                        ReturnFrame(pucFrameBuffer_, stMetaData_.uiLength);
                     }
 
                     uiMyByteCount = 0;
@@ -346,7 +400,7 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
                 uiMyExpectedMessageLength = 0;
             }
             break;
-
+        }
         case NovAtelFrameState::WAITING_FOR_ASCII_HEADER_AND_BODY:
             if (ucDataByte == OEM4_ASCII_CRC_DELIMITER)
             {
@@ -380,6 +434,15 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
                 uiMyExpectedPayloadLength = 0;
                 ResetState();
             }
+            else if (bMyBulkScan)
+            {
+                // CRC the current byte along with the run of plain characters after it, stopping at the next
+                // delimiter, non-ASCII byte or the byte that would reach the maximum message length.
+                const uint32_t uiRunEnd = clMyCircularDataBuffer.FindFirstOf(uiMyByteCount, MAX_ASCII_MESSAGE_LENGTH - 1, abAsciiBodyStop);
+                uiMyCalculatedCRC32 = clMyCircularDataBuffer.CalculateCRC32(uiMyByteCount - 1, uiRunEnd - uiMyByteCount + 1, uiMyCalculatedCRC32);
+                uiMyByteCount = uiRunEnd;
+                stMetaData_.uiLength = uiMyByteCount;
+            }
             else { CalculateCharacterCRC32(uiMyCalculatedCRC32, ucDataByte); }
             break;
 
@@ -400,8 +463,7 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
                         return STATUS::BUFFER_FULL;
                     }
 
-                    clMyCircularDataBuffer.Copy(pucFrameBuffer_, stMetaData_.uiLength);
-                    clMyCircularDataBuffer.Discard(stMetaData_.uiLength);
+                    ReturnFrame(pucFrameBuffer_, stMetaData_.uiLength);
                     eMyFrameState = NovAtelFrameState::COMPLETE_MESSAGE;
                 }
                 // End of buffer, can't look ahead but there should be more data
@@ -487,8 +549,7 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
                     return STATUS::BUFFER_FULL;
                 }
 
-                clMyCircularDataBuffer.Copy(pucFrameBuffer_, stMetaData_.uiLength);
-                clMyCircularDataBuffer.Discard(stMetaData_.uiLength);
+                ReturnFrame(pucFrameBuffer_, stMetaData_.uiLength);
 
                 uiMyByteCount = 0;
                 uiMyAbbrevAsciiHeaderPosition = 0;
@@ -526,8 +587,7 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
                         return STATUS::BUFFER_FULL;
                     }
 
-                    clMyCircularDataBuffer.Copy(pucFrameBuffer_, stMetaData_.uiLength);
-                    clMyCircularDataBuffer.Discard(stMetaData_.uiLength);
+                    ReturnFrame(pucFrameBuffer_, stMetaData_.uiLength);
                     eMyFrameState = NovAtelFrameState::COMPLETE_MESSAGE;
                 }
                 else
@@ -578,8 +638,7 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
                         return STATUS::BUFFER_FULL;
                     }
 
-                    clMyCircularDataBuffer.Copy(pucFrameBuffer_, stMetaData_.uiLength);
-                    clMyCircularDataBuffer.Discard(stMetaData_.uiLength);
+                    ReturnFrame(pucFrameBuffer_, stMetaData_.uiLength);
                     uiMyByteCount = 0;
                     eMyFrameState = NovAtelFrameState::COMPLETE_MESSAGE;
                 }
@@ -612,8 +671,7 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, const uint32_t uiFrameBufferSiz
             if (uiMyJsonObjectOpenBraces == 0)
             {
                 stMetaData_.uiLength = uiMyByteCount;
-                clMyCircularDataBuffer.Copy(pucFrameBuffer_, stMetaData_.uiLength);
-                clMyCircularDataBuffer.Discard(stMetaData_.uiLength);
+                ReturnFrame(pucFrameBuffer_, stMetaData_.uiLength);
                 uiMyByteCount = 0;
                 uiMyExpectedPayloadLength = 0;
                 eMyFrameState = NovAtelFrameState::COMPLETE_MESSAGE;
@@ -89,22 +89,22 @@ template <ASCIIHEADER eField> bool HeaderDecoder::DecodeAsciiHeaderField(Interme
     case ASCIIHEADER::MESSAGE_NAME: {
         uint16_t usLogID = 0;
         uint32_t uiSiblingID = 0, uiMsgFormat = 0, uiResponse = 0;
-        UnpackMsgID(pclMyMsgDb->MsgNameToMsgId(std::string(*ppcLogBuf_, ullTokenLength)), usLogID, uiSiblingID, uiMsgFormat, uiResponse);
+        UnpackMsgID(pclMyMsgDb->MsgNameToMsgId(std::string_view(*ppcLogBuf_, ullTokenLength)), usLogID, uiSiblingID, uiMsgFormat, uiResponse);
         stInterHeader_.usMessageID = usLogID;
         stInterHeader_.ucMessageType = PackMsgType(uiSiblingID, uiMsgFormat, uiResponse);
         break;
     }
     case ASCIIHEADER::PORT:
-        stInterHeader_.uiPortAddress = static_cast<uint32_t>(GetEnumValue(vMyPortAddrDefns, std::string(*ppcLogBuf_, ullTokenLength)));
+        stInterHeader_.uiPortAddress = static_cast<uint32_t>(GetEnumValue(vMyPortAddrDefns, std::string_view(*ppcLogBuf_, ullTokenLength)));
         break;
-    case ASCIIHEADER::SEQUENCE: stInterHeader_.usSequence = static_cast<uint16_t>(strtoul(*ppcLogBuf_, nullptr, 10)); break;
-    case ASCIIHEADER::IDLETIME: stInterHeader_.ucIdleTime = static_cast<uint8_t>(2.0 * strtof(*ppcLogBuf_, nullptr)); break;
-    case ASCIIHEADER::TIME_STATUS: stInterHeader_.uiTimeStatus = GetEnumValue(vMyGPSTimeStatusDefns, std::string(*ppcLogBuf_, ullTokenLength)); break;
-    case ASCIIHEADER::WEEK: stInterHeader_.usWeek = static_cast<uint16_t>(strtoul(*ppcLogBuf_, nullptr, 10)); break;
-    case ASCIIHEADER::SECONDS: stInterHeader_.dMilliseconds = 1000.0 * strtod(*ppcLogBuf_, nullptr); break;
-    case ASCIIHEADER::RECEIVER_STATUS: stInterHeader_.uiReceiverStatus = strtoul(*ppcLogBuf_, nullptr, 16); break;
-    case ASCIIHEADER::MSG_DEF_CRC: stInterHeader_.uiMessageDefinitionCRC = strtoul(*ppcLogBuf_, nullptr, 16); break;
-    case ASCIIHEADER::RECEIVER_SW_VERSION: stInterHeader_.usReceiverSwVersion = static_cast<uint16_t>(strtoul(*ppcLogBuf_, nullptr, 10)); break;
+    case ASCIIHEADER::SEQUENCE: stInterHeader_.usSequence = ParseAsciiNumber<uint16_t>(*ppcLogBuf_, ullTokenLength); break;
+    case ASCIIHEADER::IDLETIME: stInterHeader_.ucIdleTime = static_cast<uint8_t>(2.0 * ParseAsciiNumber<float>(*ppcLogBuf_, ullTokenLength)); break;
+    case ASCIIHEADER::TIME_STATUS: stInterHeader_.uiTimeStatus = GetEnumValue(vMyGPSTimeStatusDefns, std::string_view(*ppcLogBuf_, ullTokenLength)); break;
+    case ASCIIHEADER::WEEK: stInterHeader_.usWeek = ParseAsciiNumber<uint16_t>(*ppcLogBuf_, ullTokenLength); break;
+    case ASCIIHEADER::SECONDS: stInterHeader_.dMilliseconds = 1000.0 * ParseAsciiNumber<double>(*ppcLogBuf_, ullTokenLength); break;
+    case ASCIIHEADER::RECEIVER_STATUS: stInterHeader_.uiReceiverStatus = ParseAsciiNumber<uint32_t, 16>(*ppcLogBuf_, ullTokenLength); break;
+    case ASCIIHEADER::MSG_DEF_CRC: stInterHeader_.uiMessageDefinitionCRC = ParseAsciiNumber<uint32_t, 16>(*ppcLogBuf_, ullTokenLength); break;
+    case ASCIIHEADER::RECEIVER_SW_VERSION: stInterHeader_.usReceiverSwVersion = ParseAsciiNumber<uint16_t>(*ppcLogBuf_, ullTokenLength); break;
     default: return false;
     }
     *ppcLogBuf_ += ullTokenLength + 1; // Consume the token and the trailing delimiter
@@ -121,10 +121,10 @@ template <ASCIIHEADER... eFields> bool HeaderDecoder::DecodeAsciiHeaderFields(In
 void HeaderDecoder::DecodeJsonHeader(json clJsonHeader_, IntermediateHeader& stInterHeader_)
 {
     stInterHeader_.usMessageID = clJsonHeader_["id"].get<uint16_t>();
-    stInterHeader_.uiPortAddress = static_cast<uint32_t>(GetEnumValue(vMyPortAddrDefns, clJsonHeader_["port"].get<std::string>()));
+    stInterHeader_.uiPortAddress = static_cast<uint32_t>(GetEnumValue(vMyPortAddrDefns, clJsonHeader_["port"].get_ref<const std::string&>()));
     stInterHeader_.usSequence = clJsonHeader_["sequence_num"].get<uint16_t>();
     stInterHeader_.ucIdleTime = static_cast<uint8_t>(clJsonHeader_["percent_idle_time"].get<float>() * 2.0);
-    stInterHeader_.uiTimeStatus = static_cast<uint32_t>(GetEnumValue(vMyGPSTimeStatusDefns, clJsonHeader_["time_status"].get<std::string>()));
+    stInterHeader_.uiTimeStatus = static_cast<uint32_t>(GetEnumValue(vMyGPSTimeStatusDefns, clJsonHeader_["time_status"].get_ref<const std::string&>()));
     stInterHeader_.usWeek = clJsonHeader_["week"].get<uint16_t>();
     stInterHeader_.dMilliseconds = clJsonHeader_["seconds"].get<double>() * 1000.0;
     stInterHeader_.uiReceiverStatus = clJsonHeader_["receiver_status"].get<uint32_t>();
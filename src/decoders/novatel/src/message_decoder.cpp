@@ -38,43 +38,48 @@
 using namespace novatel::edie::oem;
 
 // -------------------------------------------------------------------------------------------------------
-MessageDecoder::MessageDecoder(JsonReader* pclJsonDb_) : MessageDecoderBase(pclJsonDb_)
+MessageDecoder::MessageDecoder(JsonReader* pclJsonDb_) : MessageDecoderBase(OEMFieldMaps(), pclJsonDb_) {}
+
+// -------------------------------------------------------------------------------------------------------
+const MessageDecoder::FieldDecoderMaps& MessageDecoder::OEMFieldMaps()
 {
-    InitOEMFieldMaps();
-    if (pclJsonDb_ != nullptr) { LoadJsonDb(pclJsonDb_); }
+    // The OEM field decoders extend those of the MessageDecoderBase class
+    static const FieldDecoderMaps stFieldMaps = [] {
+        FieldDecoderMaps stMaps = BaseFieldMaps();
+        InitOEMFieldMaps(stMaps.asciiFieldMap, stMaps.jsonFieldMap);
+        return stMaps;
+    }();
+    return stFieldMaps;
 }
 
 // -------------------------------------------------------------------------------------------------------
-void MessageDecoder::InitOEMFieldMaps()
+void MessageDecoder::InitOEMFieldMaps(std::unordered_map<uint32_t, AsciiFieldDecoder>& asciiFieldMap_,
+                                      std::unordered_map<uint32_t, JsonFieldDecoder>& jsonFieldMap_)
 {
     // =========================================================
     // ASCII Field Mapping
     // =========================================================
-    asciiFieldMap[CalculateBlockCRC32("%c")] = SimpleAsciiMapEntry<uint32_t>();
-    asciiFieldMap[CalculateBlockCRC32("%k")] = SimpleAsciiMapEntry<float>();
-    asciiFieldMap[CalculateBlockCRC32("%lk")] = SimpleAsciiMapEntry<double>();
-
-    asciiFieldMap[CalculateBlockCRC32("%ucb")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                    char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                    [[maybe_unused]] JsonReader* pclMsgDb) {
-        vIntermediateFormat_.emplace_back(static_cast<uint32_t>(std::bitset<8>(*ppcToken_).to_ulong()), MessageDataType_);
+    asciiFieldMap_[CalculateBlockCRC32("%c")] = SimpleAsciiMapEntry<uint32_t>();
+    asciiFieldMap_[CalculateBlockCRC32("%k")] = SimpleAsciiMapEntry<float>();
+    asciiFieldMap_[CalculateBlockCRC32("%lk")] = SimpleAsciiMapEntry<double>();
+
+    asciiFieldMap_[CalculateBlockCRC32("%ucb")] = []([[maybe_unused]] const BaseField* MessageDataType_, char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+        return static_cast<uint32_t>(std::bitset<8>(*ppcToken_).to_ulong());
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%T")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                  char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
-        vIntermediateFormat_.emplace_back(static_cast<uint32_t>(strtod(*ppcToken_, nullptr) * SEC_TO_MSEC), MessageDataType_);
+    asciiFieldMap_[CalculateBlockCRC32("%T")] = []([[maybe_unused]] const BaseField* MessageDataType_, char** ppcToken_, const size_t tokenLength_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+        return static_cast<uint32_t>(ParseAsciiNumber<double>(*ppcToken_, tokenLength_) * SEC_TO_MSEC);
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%m")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                  char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
-        vIntermediateFormat_.emplace_back(pclMsgDb->MsgNameToMsgId(std::string(*ppcToken_, tokenLength_)), MessageDataType_);
+    asciiFieldMap_[CalculateBlockCRC32("%m")] = []([[maybe_unused]] const BaseField* MessageDataType_, char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+        return pclMsgDb->MsgNameToMsgId(std::string_view(*ppcToken_, tokenLength_));
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%id")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                   char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                   [[maybe_unused]] JsonReader* pclMsgDb) {
+    asciiFieldMap_[CalculateBlockCRC32("%id")] = []([[maybe_unused]] const BaseField* MessageDataType_, char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         uint16_t usSlot = 0;
         int16_t sFreq = 0;
 
@@ -83,48 +88,47 @@ void MessageDecoder::InitOEMFieldMaps()
 
         if (pcDelimiter != nullptr)
         {
-            usSlot = static_cast<uint16_t>(strtoul(*ppcToken_, nullptr, 10));
-            sFreq = static_cast<int16_t>(strtol(pcDelimiter, nullptr, 10));
+            usSlot = ParseAsciiNumber<uint16_t>(*ppcToken_, static_cast<size_t>(pcDelimiter - *ppcToken_));
+            sFreq = ParseAsciiNumber<int16_t>(pcDelimiter, static_cast<size_t>(*ppcToken_ + tokenLength_ - pcDelimiter));
         }
-        else { usSlot = static_cast<uint16_t>(strtoul(*ppcToken_, nullptr, 10)); }
+        else { usSlot = ParseAsciiNumber<uint16_t>(*ppcToken_, tokenLength_); }
 
         const uint32_t uiSatID = usSlot | (sFreq << 16);
-        vIntermediateFormat_.emplace_back(uiSatID, MessageDataType_);
+        return uiSatID;
     };
 
-    asciiFieldMap[CalculateBlockCRC32("%R")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                  char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
-                                                  [[maybe_unused]] JsonReader* pclMsgDb) {
+    asciiFieldMap_[CalculateBlockCRC32("%R")] = []([[maybe_unused]] const BaseField* MessageDataType_, char** ppcToken_, [[maybe_unused]] const size_t tokenLength_,
+                                                   [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         // RXCONFIG in ASCII is always #COMMANDNAMEA
-        const MessageDefinition* pclMessageDef = pclMsgDb->GetMsgDef(std::string(*ppcToken_ + 1, tokenLength_ - 2)); // + 1 to Skip the '#'
-        vIntermediateFormat_.emplace_back(pclMessageDef ? CreateMsgID(pclMessageDef->logID, 0, 1, 0) : 0, MessageDataType_);
+        if (tokenLength_ < 2) { return 0U; }
+        const MessageDefinition* pclMessageDef = pclMsgDb->GetMsgDef(std::string_view(*ppcToken_ + 1, tokenLength_ - 2)); // + 1 to Skip the '#'
+        return pclMessageDef ? CreateMsgID(pclMessageDef->logID, 0, 1, 0) : 0;
     };
 
     // =========================================================
     // Json Field Mapping
     // =========================================================
-    jsonFieldMap[CalculateBlockCRC32("%c")] = SimpleJsonMapEntry<uint32_t>();
-    jsonFieldMap[CalculateBlockCRC32("%k")] = SimpleJsonMapEntry<float>();
-    jsonFieldMap[CalculateBlockCRC32("%lk")] = SimpleJsonMapEntry<double>();
-
-    jsonFieldMap[CalculateBlockCRC32("%ucb")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                   json clJsonField_, [[maybe_unused]] JsonReader* pclMsgDb) {
-        vIntermediateFormat_.emplace_back(static_cast<uint32_t>(std::bitset<8>(clJsonField_.get<std::string>().c_str()).to_ulong()),
-                                          MessageDataType_);
+    jsonFieldMap_[CalculateBlockCRC32("%c")] = SimpleJsonMapEntry<uint32_t>();
+    jsonFieldMap_[CalculateBlockCRC32("%k")] = SimpleJsonMapEntry<float>();
+    jsonFieldMap_[CalculateBlockCRC32("%lk")] = SimpleJsonMapEntry<double>();
+
+    jsonFieldMap_[CalculateBlockCRC32("%ucb")] = []([[maybe_unused]] const BaseField* MessageDataType_, json clJsonField_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+        return static_cast<uint32_t>(std::bitset<8>(clJsonField_.get<std::string>().c_str()).to_ulong());
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%m")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                 json clJsonField_, [[maybe_unused]] JsonReader* pclMsgDb) {
-        vIntermediateFormat_.emplace_back(pclMsgDb->MsgNameToMsgId(clJsonField_.get<std::string>()), MessageDataType_);
+    jsonFieldMap_[CalculateBlockCRC32("%m")] = []([[maybe_unused]] const BaseField* MessageDataType_, json clJsonField_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+        return pclMsgDb->MsgNameToMsgId(clJsonField_.get_ref<const std::string&>());
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%T")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                 json clJsonField_, [[maybe_unused]] JsonReader* pclMsgDb) {
-        vIntermediateFormat_.emplace_back(static_cast<uint32_t>(clJsonField_.get<double>() * SEC_TO_MSEC), MessageDataType_);
+    jsonFieldMap_[CalculateBlockCRC32("%T")] = []([[maybe_unused]] const BaseField* MessageDataType_, json clJsonField_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+        return static_cast<uint32_t>(clJsonField_.get<double>() * SEC_TO_MSEC);
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%id")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                  json clJsonField_, [[maybe_unused]] JsonReader* pclMsgDb) {
+    jsonFieldMap_[CalculateBlockCRC32("%id")] = []([[maybe_unused]] const BaseField* MessageDataType_, json clJsonField_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
         std::string sTemp(clJsonField_.get<std::string>());
 
         uint16_t usSlot = 0;
@@ -141,12 +145,12 @@ void MessageDecoder::InitOEMFieldMaps()
         else { usSlot = static_cast<uint16_t>(strtoul(sTemp.c_str(), nullptr, 10)); }
 
         const uint32_t uiSatID = (usSlot | (sFreq << 16));
-        vIntermediateFormat_.emplace_back(uiSatID, MessageDataType_);
+        return uiSatID;
     };
 
-    jsonFieldMap[CalculateBlockCRC32("%R")] = [](std::vector<FieldContainer>& vIntermediateFormat_, const BaseField* MessageDataType_,
-                                                 json clJsonField_, [[maybe_unused]] JsonReader* pclMsgDb) {
-        const MessageDefinition* pclMessageDef = pclMsgDb->GetMsgDef(clJsonField_.get<std::string>());
-        vIntermediateFormat_.emplace_back(pclMessageDef ? CreateMsgID(pclMessageDef->logID, 0, 1, 0) : 0, MessageDataType_);
+    jsonFieldMap_[CalculateBlockCRC32("%R")] = []([[maybe_unused]] const BaseField* MessageDataType_, json clJsonField_,
+                                                  [[maybe_unused]] JsonReader* pclMsgDb) -> FieldValue {
+        const MessageDefinition* pclMessageDef = pclMsgDb->GetMsgDef(clJsonField_.get_ref<const std::string&>());
+        return pclMessageDef ? CreateMsgID(pclMessageDef->logID, 0, 1, 0) : 0;
     };
 }
\ No newline at end of file
@@ -40,6 +40,7 @@ Parser::Parser(const std::string sDbPath_)
     : pcMyEncodeBuffer(new unsigned char[uiPARSER_INTERNAL_BUFFER_SIZE]), pcMyFrameBuffer(new unsigned char[uiPARSER_INTERNAL_BUFFER_SIZE])
 {
     clMyJsonReader.LoadFile(sDbPath_);
+    pclMyJsonDb = &clMyJsonReader;
 
     clMyHeaderDecoder.LoadJsonDb(&clMyJsonReader);
     clMyMessageDecoder.LoadJsonDb(&clMyJsonReader);
@@ -66,6 +67,7 @@ Parser::Parser(const std::u32string sDbPath_)
     : pcMyEncodeBuffer(new unsigned char[uiPARSER_INTERNAL_BUFFER_SIZE]), pcMyFrameBuffer(new unsigned char[uiPARSER_INTERNAL_BUFFER_SIZE])
 {
     clMyJsonReader.LoadFile(sDbPath_);
+    pclMyJsonDb = &clMyJsonReader;
 
     clMyHeaderDecoder.LoadJsonDb(&clMyJsonReader);
     clMyMessageDecoder.LoadJsonDb(&clMyJsonReader);
@@ -91,17 +93,15 @@ Parser::Parser(const std::u32string sDbPath_)
 Parser::Parser(JsonReader* pclJsonDb_)
     : pcMyEncodeBuffer(new unsigned char[uiPARSER_INTERNAL_BUFFER_SIZE]), pcMyFrameBuffer(new unsigned char[uiPARSER_INTERNAL_BUFFER_SIZE])
 {
-    if (pclJsonDb_ != nullptr)
-    {
-        LoadJsonDb(pclJsonDb_);
-        clMyJsonReader = *pclJsonDb_;
-    }
+    if (pclJsonDb_ != nullptr) { LoadJsonDb(pclJsonDb_); }
     pclMyLogger->debug("Parser initialized");
 }
 
 // -------------------------------------------------------------------------------------------------------
 Parser::~Parser()
 {
+    StopWorkers();
+
     if (pcMyFrameBuffer) { delete[] pcMyFrameBuffer; }
 
     if (pcMyEncodeBuffer) { delete[] pcMyEncodeBuffer; }
@@ -129,11 +129,22 @@ void Parser::LoadJsonDb(JsonReader* pclJsonDb_)
         clMyRxConfigFilter.IncludeMessageId(usRXConfigMsgID, HEADERFORMAT::ALL, MEASUREMENT_SOURCE::PRIMARY);
         clMyRxConfigFilter.IncludeMessageId(usRXConfigMsgID, HEADERFORMAT::ALL, MEASUREMENT_SOURCE::SECONDARY);
 
-        clMyJsonReader = *pclJsonDb_;
+        pclMyJsonDb = pclJsonDb_;
+
+        // The workers' decoders and encoders have to be rebuilt over the new database
+        if (!vMyWorkers.empty())
+        {
+            const uint64_t ullDiscarded = StopWorkers();
+            if (ullDiscarded > 0) { pclMyLogger->warn("Discarded {} messages in flight to load the JSON DB", ullDiscarded); }
+            StartWorkers();
+        }
     }
     else { pclMyLogger->debug("JSON DB is a nullptr."); }
 }
 
+// -------------------------------------------------------------------------------------------------------
+JsonReader* Parser::GetJsonDb() { return pclMyJsonDb; }
+
 // -------------------------------------------------------------------------------------------------------
 std::shared_ptr<spdlog::logger> Parser::GetLogger() { return pclMyLogger; }
 
@@ -179,12 +190,37 @@ void Parser::SetDecompressRangeCmp(bool bDecompressRangeCmp_) { bMyDecompressRan
 // -------------------------------------------------------------------------------------------------------
 bool Parser::GetDecompressRangeCmp() { return bMyDecompressRangeCmp; }
 
+// -------------------------------------------------------------------------------------------------------
+void Parser::SetDeferRangeCmp(bool bDeferRangeCmp_) { bMyDeferRangeCmp = bDeferRangeCmp_; }
+
+// -------------------------------------------------------------------------------------------------------
+bool Parser::GetDeferRangeCmp() { return bMyDeferRangeCmp; }
+
 // -------------------------------------------------------------------------------------------------------
 void Parser::SetReturnUnknownBytes(bool bReturnUnknownBytes_) { bMyReturnUnknownBytes = bReturnUnknownBytes_; }
 
 // -------------------------------------------------------------------------------------------------------
 bool Parser::GetReturnUnknownBytes() { return bMyReturnUnknownBytes; }
 
+// -------------------------------------------------------------------------------------------------------
+void Parser::SetPassthrough(bool bPassthrough_) { bMyPassthrough = bPassthrough_; }
+
+// -------------------------------------------------------------------------------------------------------
+bool Parser::GetPassthrough() { return bMyPassthrough; }
+
+// -------------------------------------------------------------------------------------------------------
+void Parser::SetZeroCopy(bool bZeroCopy_)
+{
+    bMyZeroCopy = bZeroCopy_;
+
+    // A mirrored buffer keeps every frame contiguous, so none have to be copied out
+    clMyFramer.SetMirroredBuffer(bMyZeroCopy);
+    clMyFramer.SetFrameInPlace(bMyZeroCopy);
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool Parser::GetZeroCopy() { return bMyZeroCopy; }
+
 // -------------------------------------------------------------------------------------------------------
 void Parser::SetEncodeFormat(ENCODEFORMAT eFormat_) { eMyEncodeFormat = eFormat_; }
 
@@ -192,20 +228,51 @@ void Parser::SetEncodeFormat(ENCODEFORMAT eFormat_) { eMyEncodeFormat = eFormat_
 ENCODEFORMAT
 Parser::GetEncodeFormat() { return eMyEncodeFormat; }
 
+// -------------------------------------------------------------------------------------------------------
+void Parser::SetWorkerThreads(uint32_t uiThreads_)
+{
+    const uint64_t ullDiscarded = StopWorkers();
+    if (ullDiscarded > 0) { pclMyLogger->warn("Discarded {} messages in flight to change the number of worker threads", ullDiscarded); }
+    uiMyWorkerThreads = uiThreads_ > 1 ? uiThreads_ : 1;
+    StartWorkers();
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t Parser::GetWorkerThreads() { return uiMyWorkerThreads; }
+
 // -------------------------------------------------------------------------------------------------------
 unsigned char* Parser::GetInternalBuffer() { return pucMyFrameBufferPointer; }
 
 // -------------------------------------------------------------------------------------------------------
-uint32_t Parser::Write(unsigned char* pcData_, uint32_t uiDataSize_) { return clMyFramer.Write(pcData_, uiDataSize_); }
+uint32_t Parser::Write(const unsigned char* pcData_, uint32_t uiDataSize_) { return clMyFramer.Write(pcData_, uiDataSize_); }
+
+// -------------------------------------------------------------------------------------------------------
+uint32_t Parser::GetBytesInBuffer() { return clMyFramer.GetBytesInBuffer(); }
+
+// -------------------------------------------------------------------------------------------------------
+bool Parser::IsPassthroughFormat(HEADERFORMAT eFormat_) const
+{
+    switch (eFormat_)
+    {
+    case HEADERFORMAT::BINARY: [[fallthrough]];
+    case HEADERFORMAT::SHORT_BINARY: return eMyEncodeFormat == ENCODEFORMAT::BINARY;
+    case HEADERFORMAT::ASCII: [[fallthrough]];
+    case HEADERFORMAT::SHORT_ASCII: return eMyEncodeFormat == ENCODEFORMAT::ASCII;
+    case HEADERFORMAT::ABB_ASCII: [[fallthrough]];
+    case HEADERFORMAT::SHORT_ABB_ASCII: return eMyEncodeFormat == ENCODEFORMAT::ABBREV_ASCII;
+    default: return false;
+    }
+}
 
 // -------------------------------------------------------------------------------------------------------
 STATUS
 Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbv)
 {
+    if (!vMyWorkers.empty()) { return ReadPipelined(stMessageData_, stMetaData_, bDecodeIncompleteAbbv); }
+
     STATUS eStatus = STATUS::UNKNOWN;
 
     IntermediateHeader stHeader;
-    IntermediateMessage stMessage;
 
     while (true)
     {
@@ -213,6 +280,9 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
         pucMyEncodeBufferPointer = pcMyEncodeBuffer; //!< Reset the buffer.
         eStatus = clMyFramer.GetFrame(pucMyFrameBufferPointer, uiPARSER_INTERNAL_BUFFER_SIZE, stMetaData_);
 
+        // The frame may have been left in the framer's buffer rather than copied to ours
+        if (bMyZeroCopy && eStatus == STATUS::SUCCESS) { pucMyFrameBufferPointer = const_cast<unsigned char*>(clMyFramer.GetFrameData()); }
+
         // Datasets ending with a Abbv ASCII message will always return a incomplete framing status
         // as there is no delimiter marking the end of the log.
         // If bDecodeIncompleteAbbv is set, the Framer status is STATUS::INCOMPLETE, and MetaData
@@ -261,8 +331,26 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
             {
                 if ((pclMyUserFilter != nullptr) && (!pclMyUserFilter->DoFiltering(stMetaData_))) { continue; }
 
+                const bool bDecompress = bMyDecompressRangeCmp && clMyRangeCmpFilter.DoFiltering(stMetaData_);
+                const bool bRxConfig = clMyRxConfigFilter.DoFiltering(stMetaData_);
+
+                // Nothing to transform, so hand back the frame exactly as it was framed
+                if (((bMyPassthrough || bMyZeroCopy) && !bDecompress && !bRxConfig && IsPassthroughFormat(stMetaData_.eFormat)) ||
+                    (bDecompress && bMyDeferRangeCmp))
+                {
+                    stMessageData_ = MessageDataStruct(pucMyFrameBufferPointer, stMetaData_.uiLength, stMetaData_.uiHeaderLength);
+                    break;
+                }
+
+                // Everything else is transformed in our own buffer
+                if (pucMyFrameBufferPointer != pcMyFrameBuffer)
+                {
+                    memcpy(pcMyFrameBuffer, pucMyFrameBufferPointer, stMetaData_.uiLength);
+                    pucMyFrameBufferPointer = pcMyFrameBuffer;
+                }
+
                 // Should we decompress this?
-                if (clMyRangeCmpFilter.DoFiltering(stMetaData_) && bMyDecompressRangeCmp)
+                if (bDecompress)
                 {
                     eStatus = clMyRangeDecompressor.Decompress(pucMyFrameBufferPointer, uiPARSER_INTERNAL_BUFFER_SIZE, stMetaData_);
                     if (eStatus == STATUS::SUCCESS) { stHeader.usMessageID = stMetaData_.usMessageID; }
@@ -274,7 +362,7 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
                     // Continue if we succeeded.
                 }
 
-                if (clMyRxConfigFilter.DoFiltering(stMetaData_))
+                if (bRxConfig)
                 {
                     // Use some dummy stuff for the embedded message.  The parser won't handle that
                     // now.
@@ -287,10 +375,10 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
                 }
 
                 pucMyFrameBufferPointer += stMetaData_.uiHeaderLength;
-                eStatus = clMyMessageDecoder.Decode(pucMyFrameBufferPointer, stMessage, stMetaData_);
+                eStatus = clMyMessageDecoder.Decode(pucMyFrameBufferPointer, stMyMessage, stMetaData_);
                 if (eStatus == STATUS::SUCCESS)
                 {
-                    eStatus = clMyEncoder.Encode(&pucMyEncodeBufferPointer, uiPARSER_INTERNAL_BUFFER_SIZE, stHeader, stMessage, stMessageData_,
+                    eStatus = clMyEncoder.Encode(&pucMyEncodeBufferPointer, uiPARSER_INTERNAL_BUFFER_SIZE, stHeader, stMyMessage, stMessageData_,
                                                  stMetaData_, eMyEncodeFormat);
                     if (eStatus == STATUS::SUCCESS)
                     {
@@ -314,9 +402,329 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
     return eStatus;
 }
 
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Parser::ReadObservations(RangeObservations& stObservations_, MetaDataStruct& stMetaData_)
+{
+    if (!vMyWorkers.empty())
+    {
+        const uint64_t ullDiscarded = DiscardInFlight();
+        if (ullDiscarded > 0) { pclMyLogger->warn("Discarded {} messages in flight to read observations", ullDiscarded); }
+    }
+
+    STATUS eStatus = STATUS::UNKNOWN;
+
+    IntermediateHeader stHeader;
+
+    while (true)
+    {
+        pucMyFrameBufferPointer = pcMyFrameBuffer; //!< Reset the buffer.
+        eStatus = clMyFramer.GetFrame(pucMyFrameBufferPointer, uiPARSER_INTERNAL_BUFFER_SIZE, stMetaData_);
+
+        if (eStatus == STATUS::SUCCESS)
+        {
+            // The frame may have been left in the framer's buffer rather than copied to ours
+            if (bMyZeroCopy && clMyFramer.GetFrameData() != pucMyFrameBufferPointer)
+            {
+                memcpy(pucMyFrameBufferPointer, clMyFramer.GetFrameData(), stMetaData_.uiLength);
+            }
+
+            eStatus = clMyHeaderDecoder.Decode(pucMyFrameBufferPointer, stHeader, stMetaData_);
+            if (eStatus != STATUS::SUCCESS)
+            {
+                pclMyLogger->info("HeaderDecoder returned status {}\n", static_cast<int32_t>(eStatus));
+                continue;
+            }
+
+            if ((pclMyUserFilter != nullptr) && (!pclMyUserFilter->DoFiltering(stMetaData_))) { continue; }
+
+            if (stMetaData_.usMessageID != RANGE_MSG_ID && !clMyRangeCmpFilter.DoFiltering(stMetaData_)) { continue; }
+
+            eStatus =
+                clMyRangeDecompressor.DecompressObservations(pucMyFrameBufferPointer, uiPARSER_INTERNAL_BUFFER_SIZE, stMetaData_, stObservations_);
+            if (eStatus == STATUS::SUCCESS) { break; }
+
+            pclMyLogger->info("RangeDecompressor returned status {}\n", static_cast<int32_t>(eStatus));
+        }
+        else if (eStatus == STATUS::INCOMPLETE || eStatus == STATUS::BUFFER_EMPTY)
+        {
+            eStatus = STATUS::BUFFER_EMPTY;
+            break;
+        }
+        else if (eStatus != STATUS::UNKNOWN) { pclMyLogger->info("Framer returned status {}\n", static_cast<int32_t>(eStatus)); }
+    }
+
+    return eStatus;
+}
+
 // -------------------------------------------------------------------------------------------------------
 uint32_t Parser::Flush(unsigned char* pucBuffer_, uint32_t uiBufferSize_)
 {
+    if (!vMyWorkers.empty())
+    {
+        const uint64_t ullDiscarded = DiscardInFlight();
+        if (ullDiscarded > 0) { pclMyLogger->warn("Discarded {} messages in flight to flush the Parser", ullDiscarded); }
+    }
     clMyRangeDecompressor.Reset();
     return clMyFramer.Flush(pucBuffer_, uiBufferSize_);
 }
+
+// -------------------------------------------------------------------------------------------------------
+void Parser::StartWorkers()
+{
+    if (uiMyWorkerThreads <= 1 || pclMyJsonDb == nullptr) { return; }
+
+    vMySlots.clear();
+    for (uint32_t i = 0; i < uiMyWorkerThreads * uiPIPELINE_SLOTS_PER_WORKER; ++i) { vMySlots.push_back(std::make_unique<PipelineSlot>()); }
+    ullMyDispatched = 0;
+    ullMyConsumed = 0;
+    bMyHoldingSlot = false;
+
+    // Every worker is built before any thread starts, as the threads read vMyWorkers and step through it by its size
+    bMyStopWorkers = false;
+    for (uint32_t i = 0; i < uiMyWorkerThreads; ++i) { vMyWorkers.push_back(std::make_unique<PipelineWorker>(pclMyJsonDb)); }
+    for (uint32_t i = 0; i < uiMyWorkerThreads; ++i) { vMyWorkers[i]->clThread = std::thread(&Parser::RunWorker, this, i); }
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint64_t Parser::StopWorkers()
+{
+    const uint64_t ullDiscarded = GetInFlight();
+
+    bMyStopWorkers = true;
+    for (std::unique_ptr<PipelineWorker>& pclWorker : vMyWorkers)
+    {
+        // Wake the worker, which sees the stop request before it looks at another slot
+        pclWorker->ullPublished.fetch_add(1);
+        pclWorker->ullPublished.notify_one();
+    }
+    for (std::unique_ptr<PipelineWorker>& pclWorker : vMyWorkers) { pclWorker->clThread.join(); }
+
+    vMyWorkers.clear();
+    vMySlots.clear();
+    ullMyDispatched = 0;
+    ullMyConsumed = 0;
+    bMyHoldingSlot = false;
+    return ullDiscarded;
+}
+
+// -------------------------------------------------------------------------------------------------------
+uint64_t Parser::DiscardInFlight()
+{
+    const uint64_t ullDiscarded = GetInFlight();
+
+    for (; ullMyConsumed < ullMyDispatched; ++ullMyConsumed)
+    {
+        PipelineSlot& stSlot = *vMySlots[ullMyConsumed % vMySlots.size()];
+        stSlot.bDone.wait(false, std::memory_order_acquire);
+        stSlot.bDone.store(false, std::memory_order_relaxed);
+    }
+    bMyHoldingSlot = false;
+    return ullDiscarded;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void Parser::RunWorker(uint32_t uiWorker_)
+{
+    PipelineWorker& stWorker = *vMyWorkers[uiWorker_];
+
+    for (uint64_t ullSequence = uiWorker_;; ullSequence += vMyWorkers.size())
+    {
+        uint64_t ullPublished = stWorker.ullPublished.load(std::memory_order_acquire);
+        while (ullPublished <= ullSequence)
+        {
+            if (bMyStopWorkers) { return; }
+            stWorker.ullPublished.wait(ullPublished, std::memory_order_acquire);
+            ullPublished = stWorker.ullPublished.load(std::memory_order_acquire);
+        }
+        if (bMyStopWorkers) { return; }
+
+        PipelineSlot& stSlot = *vMySlots[ullSequence % vMySlots.size()];
+        if (stSlot.bDecode)
+        {
+            try
+            {
+                STATUS eStatus = stWorker.clMessageDecoder.Decode(stSlot.vFrame.data() + stSlot.stMetaData.uiHeaderLength, stWorker.stMessage,
+                                                                  stSlot.stMetaData);
+                if (eStatus == STATUS::SUCCESS)
+                {
+                    unsigned char* pucEncodeBuffer = stSlot.vEncode.data();
+                    eStatus = stWorker.clEncoder.Encode(&pucEncodeBuffer, uiPARSER_INTERNAL_BUFFER_SIZE, stSlot.stHeader, stWorker.stMessage,
+                                                        stSlot.stMessageData, stSlot.stMetaData, stSlot.eEncodeFormat);
+                    if (eStatus != STATUS::SUCCESS) { pclMyLogger->info("Encoder returned status {}\n", static_cast<int32_t>(eStatus)); }
+                }
+                else { pclMyLogger->info("MessageDecoder returned status {}\n", static_cast<int32_t>(eStatus)); }
+
+                // Like Read() without workers, messages that fail to convert are skipped
+                stSlot.eStatus = eStatus;
+                stSlot.bReturn = eStatus == STATUS::SUCCESS;
+            }
+            catch (...)
+            {
+                stSlot.pclException = std::current_exception();
+            }
+        }
+
+        stSlot.bDone.store(true, std::memory_order_release);
+        stSlot.bDone.notify_one();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool Parser::DispatchFrame(PipelineSlot& stSlot_, bool bDecodeIncompleteAbbv_)
+{
+    MetaDataStruct& stMetaData = stSlot_.stMetaData;
+
+    while (true)
+    {
+        stSlot_.bDecode = false;
+        stSlot_.bReturn = true;
+        stSlot_.pclException = nullptr;
+        stSlot_.stMessageData = MessageDataStruct();
+
+        unsigned char* pucFrame = stSlot_.vFrame.data();
+        STATUS eStatus = clMyFramer.GetFrame(pucFrame, uiPARSER_INTERNAL_BUFFER_SIZE, stMetaData);
+
+        // The frame has to outlive the framer's buffer while it is in flight
+        if (bMyZeroCopy && eStatus == STATUS::SUCCESS && clMyFramer.GetFrameData() != pucFrame)
+        {
+            memcpy(pucFrame, clMyFramer.GetFrameData(), stMetaData.uiLength);
+        }
+
+        if (bDecodeIncompleteAbbv_ && eStatus == STATUS::INCOMPLETE &&
+            (stMetaData.eFormat == HEADERFORMAT::ABB_ASCII || stMetaData.eFormat == HEADERFORMAT::SHORT_ABB_ASCII))
+        {
+            uint32_t uiFlushSize = clMyFramer.Flush(pucFrame, uiPARSER_INTERNAL_BUFFER_SIZE);
+            if (uiFlushSize > 0)
+            {
+                eStatus = STATUS::SUCCESS;
+                stMetaData.uiLength = uiFlushSize;
+            }
+        }
+
+        if (eStatus == STATUS::UNKNOWN)
+        {
+            if (!bMyReturnUnknownBytes) { continue; }
+
+            stSlot_.eStatus = eStatus;
+            stSlot_.stMessageData.pucMessageHeader = pucFrame;
+            stSlot_.stMessageData.uiMessageHeaderLength = stMetaData.uiLength;
+            return true;
+        }
+        if (eStatus == STATUS::INCOMPLETE || eStatus == STATUS::BUFFER_EMPTY) { return false; }
+        if (eStatus != STATUS::SUCCESS)
+        {
+            pclMyLogger->info("Framer returned status {}\n", static_cast<int32_t>(eStatus));
+            continue;
+        }
+
+        stSlot_.eStatus = STATUS::SUCCESS;
+        if ((!bMyIgnoreAbbreviatedASCIIResponse) && (stMetaData.bResponse) && (stMetaData.eFormat == HEADERFORMAT::ABB_ASCII))
+        {
+            stSlot_.stMessageData.pucMessage = pucFrame;
+            stSlot_.stMessageData.uiMessageLength = stMetaData.uiLength;
+            return true;
+        }
+
+        eStatus = clMyHeaderDecoder.Decode(pucFrame, stSlot_.stHeader, stMetaData);
+        if (eStatus != STATUS::SUCCESS)
+        {
+            pclMyLogger->info("HeaderDecoder returned status {}\n", static_cast<int32_t>(eStatus));
+            continue;
+        }
+
+        if ((pclMyUserFilter != nullptr) && (!pclMyUserFilter->DoFiltering(stMetaData))) { continue; }
+
+        const bool bDecompress = bMyDecompressRangeCmp && clMyRangeCmpFilter.DoFiltering(stMetaData);
+        const bool bRxConfig = clMyRxConfigFilter.DoFiltering(stMetaData);
+
+        if (((bMyPassthrough || bMyZeroCopy) && !bDecompress && !bRxConfig && IsPassthroughFormat(stMetaData.eFormat)) ||
+            (bDecompress && bMyDeferRangeCmp))
+        {
+            stSlot_.stMessageData = MessageDataStruct(pucFrame, stMetaData.uiLength, stMetaData.uiHeaderLength);
+            return true;
+        }
+
+        // Decompression keeps state between messages, so it has to happen here, in stream order
+        if (bDecompress)
+        {
+            eStatus = clMyRangeDecompressor.Decompress(pucFrame, uiPARSER_INTERNAL_BUFFER_SIZE, stMetaData);
+            if (eStatus != STATUS::SUCCESS)
+            {
+                pclMyLogger->info("RangeDecompressor returned status {}\n", static_cast<int32_t>(eStatus));
+                stSlot_.eStatus = eStatus;
+                return true;
+            }
+            stSlot_.stHeader.usMessageID = stMetaData.usMessageID;
+        }
+
+        if (bRxConfig)
+        {
+            MessageDataStruct stRxConfigMessageData;
+            MessageDataStruct stEmbeddedMessageData;
+            MetaDataStruct stEmbeddedMetaData;
+            clMyRxConfigHandler.Write(pucFrame, stMetaData.uiLength);
+            stSlot_.eStatus = clMyRxConfigHandler.Convert(stRxConfigMessageData, stMetaData, stEmbeddedMessageData, stEmbeddedMetaData, eMyEncodeFormat);
+            if (stSlot_.eStatus != STATUS::SUCCESS)
+            {
+                pclMyLogger->info("RxConfigHandler returned status {}\n", static_cast<int32_t>(stSlot_.eStatus));
+                return true;
+            }
+
+            // The handler reuses its buffer for the next RXCONFIG message, so keep a copy
+            unsigned char* pucMessage = stSlot_.vEncode.data();
+            memcpy(pucMessage, stRxConfigMessageData.pucMessage, stRxConfigMessageData.uiMessageLength);
+            stSlot_.stMessageData.pucMessage = pucMessage;
+            stSlot_.stMessageData.uiMessageLength = stRxConfigMessageData.uiMessageLength;
+            stSlot_.stMessageData.pucMessageHeader = pucMessage + (stRxConfigMessageData.pucMessageHeader - stRxConfigMessageData.pucMessage);
+            stSlot_.stMessageData.uiMessageHeaderLength = stRxConfigMessageData.uiMessageHeaderLength;
+            stSlot_.stMessageData.pucMessageBody = pucMessage + (stRxConfigMessageData.pucMessageBody - stRxConfigMessageData.pucMessage);
+            stSlot_.stMessageData.uiMessageBodyLength = stRxConfigMessageData.uiMessageBodyLength;
+            return true;
+        }
+
+        stSlot_.bDecode = true;
+        stSlot_.eEncodeFormat = eMyEncodeFormat;
+        return true;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+Parser::ReadPipelined(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbv_)
+{
+    while (true)
+    {
+        // The message returned by the last call is no longer needed
+        if (bMyHoldingSlot)
+        {
+            vMySlots[ullMyConsumed % vMySlots.size()]->bDone.store(false, std::memory_order_relaxed);
+            ++ullMyConsumed;
+            bMyHoldingSlot = false;
+        }
+
+        // Keep every worker busy while we wait for the oldest message
+        while (ullMyDispatched - ullMyConsumed < vMySlots.size())
+        {
+            if (!DispatchFrame(*vMySlots[ullMyDispatched % vMySlots.size()], bDecodeIncompleteAbbv_)) { break; }
+
+            PipelineWorker& stWorker = *vMyWorkers[ullMyDispatched % vMyWorkers.size()];
+            stWorker.ullPublished.store(++ullMyDispatched, std::memory_order_release);
+            stWorker.ullPublished.notify_one();
+        }
+
+        if (ullMyConsumed == ullMyDispatched) { return STATUS::BUFFER_EMPTY; }
+
+        PipelineSlot& stSlot = *vMySlots[ullMyConsumed % vMySlots.size()];
+        stSlot.bDone.wait(false, std::memory_order_acquire);
+        bMyHoldingSlot = true;
+
+        if (stSlot.pclException) { std::rethrow_exception(stSlot.pclException); }
+        if (!stSlot.bReturn) { continue; }
+
+        pucMyFrameBufferPointer = stSlot.vFrame.data();
+        stMessageData_ = stSlot.stMessageData;
+        stMetaData_ = stSlot.stMetaData;
+        return stSlot.eStatus;
+    }
+}
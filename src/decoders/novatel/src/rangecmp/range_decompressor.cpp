@@ -1,5 +1,6 @@
 #include "decoders/novatel/api/rangecmp/range_decompressor.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
 using namespace novatel::edie;
@@ -266,54 +267,17 @@ double RangeDecompressor::GetSignalWavelength(const ChannelTrackingStatusStruct&
 }
 
 //------------------------------------------------------------------------------
-//! Bitfield helper function.  This will collect the number of bits specified
-//! from the provided buffer pointer.  It will keep an internal track of the
-//! current bit offset within a given byte.
+//! Bitfield helper function.  Fails the decompression if the buffer doesn't
+//! hold the number of bits specified, so that a block of fields can then be
+//! read without checking each one.
 //------------------------------------------------------------------------------
-uint64_t RangeDecompressor::GetBitfieldFromBuffer(uint8_t** ppucDataBuffer_, uint32_t uiBitsInBitfield_)
+void RangeDecompressor::CheckBitsRemaining(const BitfieldReader& clBitfieldReader_, uint64_t ullBitsRequired_)
 {
-    // If the user is asking for too many bits, don't do anything.
-    if (uiBitsInBitfield_ > (sizeof(uint64_t) * BITS_PER_BYTE))
+    if (!clBitfieldReader_.HasBits(ullBitsRequired_))
     {
-        pclMyLogger->critical("Too many bits requested! Requested {}, max {}.", uiBitsInBitfield_, (sizeof(uint64_t) * BITS_PER_BYTE));
-        return 0;
+        pclMyLogger->critical("Not enough bits in this buffer. Required {}, have {}.", ullBitsRequired_, clBitfieldReader_.BitsRemaining());
+        throw std::runtime_error("CheckBitsRemaining(): Compressed data is truncated");
     }
-
-    // If the user is asking for more bits than are avalable in the buffer, don't do anything.
-    uint32_t uiRemainderBits = uiBitsInBitfield_ % BITS_PER_BYTE;
-    uint32_t uiBytesRequired = uiBitsInBitfield_ / BITS_PER_BYTE + (uiRemainderBits ? 1 : 0);
-    if (uiBytesRequired > uiMyBytesRemaining)
-    {
-        pclMyLogger->critical("Not enough bytes in this buffer. Required {}, have {}.", uiBytesRequired, uiMyBytesRemaining);
-        return 0;
-    }
-
-    // If the requested number of bits does not run into the next byte, let the remaining bits cound
-    // as a remaining byte.
-    uiMyBytesRemaining -= uiBytesRequired - (((uiRemainderBits + uiMyBitOffset) < BITS_PER_BYTE) ? 1 : 0);
-
-    uint64_t ulBitfield = 0;
-    uint32_t uiByteOffset = 0;
-    uint8_t ucCurrentByte = **ppucDataBuffer_;
-
-    // Iterate over each bit, adding the bit to the 64-bit return value if it is set.
-    for (uint32_t uiBitsConsumed = 0; uiBitsConsumed < uiBitsInBitfield_; uiBitsConsumed++)
-    {
-        if (ucCurrentByte & (1UL << uiMyBitOffset)) { ulBitfield |= (1ULL << uiBitsConsumed); }
-
-        // Rollover to the next byte when we reach the end of the current byte.
-        uiMyBitOffset++;
-        if (uiMyBitOffset == BITS_PER_BYTE)
-        {
-            uiMyBitOffset = 0;
-            uiByteOffset++;
-            ucCurrentByte = *(*ppucDataBuffer_ + uiByteOffset);
-        }
-    }
-
-    // Advance the data buffer we received by the amount of bytes that we moved.
-    *ppucDataBuffer_ += uiByteOffset;
-    return ulBitfield;
 }
 
 //------------------------------------------------------------------------------
@@ -336,7 +300,7 @@ float RangeDecompressor::DetermineRangeCmp2ObservationLocktime(const MetaDataStr
     float fLocktimeMilliseconds = static_cast<float>(uiLocktimeBits_);
 
     RangeCmp2LocktimeInfoStruct& stLocktimeInfo =
-        ammmMyRangeCmp2Locktimes[static_cast<uint32_t>(stMetaData_.eMeasurementSource)][eSystem_][eSignal_][static_cast<uint32_t>(usPRN_)];
+        aclMyRangeCmp2Locktimes[static_cast<uint32_t>(stMetaData_.eMeasurementSource)].Get(eSystem_, eSignal_, static_cast<uint32_t>(usPRN_));
     if (uiLocktimeBits_ == (RC2_SIG_LOCKTIME_MASK >> RC2_SIG_LOCKTIME_SHIFT))
     {
         // If the locktime was already saturated, use the stored time to add the missing offset.
@@ -425,7 +389,7 @@ float RangeDecompressor::DetermineRangeCmp4ObservationLocktime(const MetaDataStr
 {
     // Store the locktime if it is different then the once we have currently.
     RangeCmp4LocktimeInfoStruct& stLocktimeInfo =
-        ammmMyRangeCmp4Locktimes[static_cast<uint32_t>(stMetaData_.eMeasurementSource)][eSystem_][eSignal_][uiPRN_];
+        aclMyRangeCmp4Locktimes[static_cast<uint32_t>(stMetaData_.eMeasurementSource)].Get(eSystem_, eSignal_, uiPRN_);
 
     // Is the locktime relative and has a bitfield change been found?
     if ((!stLocktimeInfo.bLocktimeAbsolute) && (ucLocktimeBits_ != stLocktimeInfo.ucLocktimeBits))
@@ -488,22 +452,26 @@ float RangeDecompressor::DetermineRangeCmp4ObservationLocktime(const MetaDataStr
 //! provided reference block struct.
 //------------------------------------------------------------------------------
 template <bool bSecondary>
-void RangeDecompressor::DecompressReferenceBlock(uint8_t** ppucDataPointer_, RangeCmp4MeasurementSignalBlockStruct& stReferenceBlock_,
+void RangeDecompressor::DecompressReferenceBlock(BitfieldReader& clBitfieldReader_, RangeCmp4MeasurementSignalBlockStruct& stReferenceBlock_,
                                                  MEASUREMENT_SOURCE eMeasurementSource_)
 {
+    constexpr uint32_t uiBlockBits =
+        RC4_SIG_BLK_COMMON_BITS + RC4_RBLK_PSR_BITS[bSecondary] + RC4_RBLK_PHASERANGE_BITS[bSecondary] + RC4_RBLK_DOPPLER_BITS[bSecondary];
+    CheckBitsRemaining(clBitfieldReader_, uiBlockBits);
+
     // These fields are the same size regardless of the reference block being primary or secondary.
-    stReferenceBlock_.bParityKnown = static_cast<bool>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_PARITY_FLAG_BITS));
-    stReferenceBlock_.bHalfCycleAdded = static_cast<bool>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_HALF_CYCLE_BITS));
-    stReferenceBlock_.fCNo = static_cast<float>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_CNO_BITS)) * RC4_SIG_BLK_CNO_SCALE_FACTOR;
-    stReferenceBlock_.ucLockTimeBitfield = static_cast<uint8_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_LOCK_TIME_BITS));
-    stReferenceBlock_.ucPSRBitfield = static_cast<uint8_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_PSR_STDDEV_BITS));
-    stReferenceBlock_.ucADRBitfield = static_cast<uint8_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_ADR_STDDEV_BITS));
-
-    auto llPSRBitfield = static_cast<int64_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_RBLK_PSR_BITS[bSecondary]));
+    stReferenceBlock_.bParityKnown = static_cast<bool>(clBitfieldReader_.Read(RC4_SIG_BLK_PARITY_FLAG_BITS));
+    stReferenceBlock_.bHalfCycleAdded = static_cast<bool>(clBitfieldReader_.Read(RC4_SIG_BLK_HALF_CYCLE_BITS));
+    stReferenceBlock_.fCNo = static_cast<float>(clBitfieldReader_.Read(RC4_SIG_BLK_CNO_BITS)) * RC4_SIG_BLK_CNO_SCALE_FACTOR;
+    stReferenceBlock_.ucLockTimeBitfield = static_cast<uint8_t>(clBitfieldReader_.Read(RC4_SIG_BLK_LOCK_TIME_BITS));
+    stReferenceBlock_.ucPSRBitfield = static_cast<uint8_t>(clBitfieldReader_.Read(RC4_SIG_BLK_PSR_STDDEV_BITS));
+    stReferenceBlock_.ucADRBitfield = static_cast<uint8_t>(clBitfieldReader_.Read(RC4_SIG_BLK_ADR_STDDEV_BITS));
+
+    auto llPSRBitfield = static_cast<int64_t>(clBitfieldReader_.Read(RC4_RBLK_PSR_BITS[bSecondary]));
     if (bSecondary && llPSRBitfield & RC4_SSIG_RBLK_PSR_SIGNBIT_MASK) { llPSRBitfield |= RC4_SSIG_RBLK_PSR_SIGNEXT_MASK; }
-    auto iPhaseRangeBitfield = static_cast<int32_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_RBLK_PHASERANGE_BITS[bSecondary]));
+    auto iPhaseRangeBitfield = static_cast<int32_t>(clBitfieldReader_.Read(RC4_RBLK_PHASERANGE_BITS[bSecondary]));
     if (iPhaseRangeBitfield & RC4_RBLK_PHASERANGE_SIGNBIT_MASK) { iPhaseRangeBitfield |= RC4_RBLK_PHASERANGE_SIGNEXT_MASK; }
-    auto iDopplerBitfield = static_cast<int32_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_RBLK_DOPPLER_BITS[bSecondary]));
+    auto iDopplerBitfield = static_cast<int32_t>(clBitfieldReader_.Read(RC4_RBLK_DOPPLER_BITS[bSecondary]));
     if (iDopplerBitfield & RC4_RBLK_DOPPLER_SIGNBIT_MASK[bSecondary]) { iDopplerBitfield |= RC4_RBLK_DOPPLER_SIGNEXT_MASK[bSecondary]; }
 
     stReferenceBlock_.bValidPSR = llPSRBitfield != RC4_RBLK_INVALID_PSR[bSecondary];
@@ -529,22 +497,26 @@ void RangeDecompressor::DecompressReferenceBlock(uint8_t** ppucDataPointer_, Ran
 //! reference block from the same RANGECMP4 message.
 //------------------------------------------------------------------------------
 template <bool bIsSecondary>
-void RangeDecompressor::DecompressDifferentialBlock(uint8_t** ppucDataPointer_, RangeCmp4MeasurementSignalBlockStruct& stDifferentialBlock_,
+void RangeDecompressor::DecompressDifferentialBlock(BitfieldReader& clBitfieldReader_, RangeCmp4MeasurementSignalBlockStruct& stDifferentialBlock_,
                                                     const RangeCmp4MeasurementSignalBlockStruct& stReferenceBlock_, double dSecondOffset_)
 {
+    constexpr uint32_t uiBlockBits =
+        RC4_SIG_BLK_COMMON_BITS + RC4_SIG_DBLK_PSR_BITS + RC4_SIG_DBLK_PHASERANGE_BITS + RC4_DBLK_DOPPLER_BITS[bIsSecondary];
+    CheckBitsRemaining(clBitfieldReader_, uiBlockBits);
+
     // These fields are the same size regardless of the reference block being primary or secondary.
-    stDifferentialBlock_.bParityKnown = static_cast<bool>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_PARITY_FLAG_BITS));
-    stDifferentialBlock_.bHalfCycleAdded = static_cast<bool>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_HALF_CYCLE_BITS));
-    stDifferentialBlock_.fCNo = static_cast<float>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_CNO_BITS)) * RC4_SIG_BLK_CNO_SCALE_FACTOR;
-    stDifferentialBlock_.ucLockTimeBitfield = static_cast<uint8_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_LOCK_TIME_BITS));
-    stDifferentialBlock_.ucPSRBitfield = static_cast<uint8_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_PSR_STDDEV_BITS));
-    stDifferentialBlock_.ucADRBitfield = static_cast<uint8_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_BLK_ADR_STDDEV_BITS));
-
-    auto iPSRBitfield = static_cast<int32_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_DBLK_PSR_BITS));
+    stDifferentialBlock_.bParityKnown = static_cast<bool>(clBitfieldReader_.Read(RC4_SIG_BLK_PARITY_FLAG_BITS));
+    stDifferentialBlock_.bHalfCycleAdded = static_cast<bool>(clBitfieldReader_.Read(RC4_SIG_BLK_HALF_CYCLE_BITS));
+    stDifferentialBlock_.fCNo = static_cast<float>(clBitfieldReader_.Read(RC4_SIG_BLK_CNO_BITS)) * RC4_SIG_BLK_CNO_SCALE_FACTOR;
+    stDifferentialBlock_.ucLockTimeBitfield = static_cast<uint8_t>(clBitfieldReader_.Read(RC4_SIG_BLK_LOCK_TIME_BITS));
+    stDifferentialBlock_.ucPSRBitfield = static_cast<uint8_t>(clBitfieldReader_.Read(RC4_SIG_BLK_PSR_STDDEV_BITS));
+    stDifferentialBlock_.ucADRBitfield = static_cast<uint8_t>(clBitfieldReader_.Read(RC4_SIG_BLK_ADR_STDDEV_BITS));
+
+    auto iPSRBitfield = static_cast<int32_t>(clBitfieldReader_.Read(RC4_SIG_DBLK_PSR_BITS));
     if (iPSRBitfield & RC4_SIG_DBLK_PSR_SIGNBIT_MASK) { iPSRBitfield |= RC4_SIG_DBLK_PSR_SIGNEXT_MASK; }
-    auto iPhaseRangeBitfield = static_cast<int32_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_SIG_DBLK_PHASERANGE_BITS));
+    auto iPhaseRangeBitfield = static_cast<int32_t>(clBitfieldReader_.Read(RC4_SIG_DBLK_PHASERANGE_BITS));
     if (iPhaseRangeBitfield & RC4_SIG_DBLK_PHASERANGE_SIGNBIT_MASK) { iPhaseRangeBitfield |= RC4_SIG_DBLK_PHASERANGE_SIGNEXT_MASK; }
-    auto iDopplerBitfield = static_cast<int32_t>(GetBitfieldFromBuffer(ppucDataPointer_, RC4_DBLK_DOPPLER_BITS[bIsSecondary]));
+    auto iDopplerBitfield = static_cast<int32_t>(clBitfieldReader_.Read(RC4_DBLK_DOPPLER_BITS[bIsSecondary]));
     if (iDopplerBitfield & RC4_DBLK_DOPPLER_SIGNBIT_MASK[bIsSecondary]) { iDopplerBitfield |= RC4_DBLK_DOPPLER_SIGNEXT_MASK[bIsSecondary]; }
 
     stDifferentialBlock_.bValidPSR = iPSRBitfield != RC4_SIG_DBLK_INVALID_PSR;
@@ -743,14 +715,14 @@ void RangeDecompressor::RangeCmp2ToRange(const RangeCmp2Struct& stRangeCmp2Messa
 //! Decompress a buffer containing a RANGECMP4 message and translate it into
 //! a RANGE message.
 //------------------------------------------------------------------------------
-void RangeDecompressor::RangeCmp4ToRange(uint8_t* pucCompressedData_, RangeStruct& stRangeMessage_, const MetaDataStruct& stMetaData_)
+void RangeDecompressor::RangeCmp4ToRange(uint8_t* pucCompressedData_, uint32_t uiBodyLength_, RangeStruct& stRangeMessage_,
+                                         const MetaDataStruct& stMetaData_)
 {
-    uint8_t* pucTempDataPointer = pucCompressedData_;
-
     MEASUREMENT_SOURCE eMeasurementSource = stMetaData_.eMeasurementSource;
     double dSecondOffset = static_cast<double>(static_cast<uint32_t>(stMetaData_.dMilliseconds) % SEC_TO_MSEC) / SEC_TO_MSEC;
+    auto& clReferenceBlocks = aclMyReferenceBlocks[static_cast<uint32_t>(eMeasurementSource)];
     // Clear any dead reference blocks on the whole second.  We should be storing new ones.
-    if (dSecondOffset == 0.0) { ammmMyReferenceBlocks[static_cast<uint32_t>(eMeasurementSource)].clear(); }
+    if (dSecondOffset == 0.0) { clReferenceBlocks.Clear(); }
 
     SYSTEM eCurrentSatelliteSystem = SYSTEM::UNKNOWN;
     std::vector<RangeCmp4::SIGNAL_TYPE> vSignals;  // All available signals
@@ -770,16 +742,20 @@ void RangeDecompressor::RangeCmp4ToRange(uint8_t* pucCompressedData_, RangeStruc
     RangeCmp4MeasurementBlockHeaderStruct stMeasurementBlockHeader;
     RangeCmp4MeasurementSignalBlockStruct stMeasurementBlock;
 
-    // Reset bit offset and 0 the observation count.
-    uiMyBitOffset = 0;
+    // 0 the observation count.
     stRangeMessage_.uiNumberOfObservations = 0;
 
+    // The compressed data is prefixed with its length in bytes. The message can't be trusted to
+    // give the right length, so never read past the end of its body.
+    if (uiBodyLength_ < sizeof(uint32_t)) { throw std::runtime_error("RangeCmp4ToRange(): Compressed data is truncated"); }
+    uint32_t uiCompressedDataLength;
+    memcpy(&uiCompressedDataLength, pucCompressedData_, sizeof(uiCompressedDataLength));
+    uiCompressedDataLength = std::min(uiCompressedDataLength, static_cast<uint32_t>(uiBodyLength_ - sizeof(uint32_t)));
+    BitfieldReader clBitfieldReader(pucCompressedData_ + sizeof(uint32_t), uiCompressedDataLength);
+
     // Pull out the first few fields.
-    // We have to set uiMyBytesRemaining by typecasting because GetBitfieldFromBuffer() relies on
-    // it.
-    uiMyBytesRemaining = *reinterpret_cast<uint32_t*>(pucTempDataPointer);
-    pucTempDataPointer += sizeof(uint32_t);
-    usSatelliteSystems = static_cast<uint16_t>(GetBitfieldFromBuffer(&pucTempDataPointer, RC4_SATELLITE_SYSTEMS_BITS));
+    CheckBitsRemaining(clBitfieldReader, RC4_SATELLITE_SYSTEMS_BITS);
+    usSatelliteSystems = static_cast<uint16_t>(clBitfieldReader.Read(RC4_SATELLITE_SYSTEMS_BITS));
 
     // For each satellite system, we will decode a series of measurement block headers, each with
     // their own subsequent reference signal measurement blocks.
@@ -792,8 +768,9 @@ void RangeDecompressor::RangeCmp4ToRange(uint8_t* pucCompressedData_, RangeStruc
         // Does this message have any data for this satellite system?
         if (usSatelliteSystems & (1UL << static_cast<uint16_t>(eCurrentSatelliteSystem)))
         {
-            ulSatellites = GetBitfieldFromBuffer(&pucTempDataPointer, RC4_SATELLITES_BITS);
-            usSignals = static_cast<uint16_t>(GetBitfieldFromBuffer(&pucTempDataPointer, RC4_SIGNALS_BITS));
+            CheckBitsRemaining(clBitfieldReader, RC4_SATELLITES_BITS + RC4_SIGNALS_BITS);
+            ulSatellites = clBitfieldReader.Read(RC4_SATELLITES_BITS);
+            usSignals = static_cast<uint16_t>(clBitfieldReader.Read(RC4_SIGNALS_BITS));
 
             // Collect the signals tracked in this satellite system.
             for (RangeCmp4::SIGNAL_TYPE eCurrentSignalType : mvTheRangeCmp4SystemSignalMasks[eCurrentSatelliteSystem])
@@ -814,11 +791,12 @@ void RangeDecompressor::RangeCmp4ToRange(uint8_t* pucCompressedData_, RangeStruc
             // Iterate through the PRNs once to collect the signals tracked by each.  We need this
             // info before we can start decompressing.
             mIncludedSignals.clear();
+            CheckBitsRemaining(clBitfieldReader, static_cast<uint64_t>(vPRNs.size()) * vSignals.size());
             for (const auto& uiPRN : vPRNs)
             {
                 // Get the m*n bit matrix that describes the included signals in this RANGECMP4
                 // message.
-                mIncludedSignals[uiPRN] = GetBitfieldFromBuffer(&pucTempDataPointer, static_cast<uint32_t>(vSignals.size()));
+                mIncludedSignals[uiPRN] = clBitfieldReader.Read(static_cast<uint32_t>(vSignals.size()));
             }
 
             // Check each PRN against the signals tracked in this satellite system to see if the
@@ -826,17 +804,18 @@ void RangeDecompressor::RangeCmp4ToRange(uint8_t* pucCompressedData_, RangeStruc
             for (const auto& uiPRN : vPRNs)
             {
                 // Begin decoding Reference Measurement Block Header.
-                stMeasurementBlockHeader.bIsDifferentialData =
-                    static_cast<bool>(GetBitfieldFromBuffer(&pucTempDataPointer, RC4_MBLK_HDR_DATAFORMAT_FLAG_BITS));
+                CheckBitsRemaining(clBitfieldReader, RC4_MBLK_HDR_DATAFORMAT_FLAG_BITS + RC4_MBLK_HDR_REFERENCE_DATABLOCK_ID_BITS);
+                stMeasurementBlockHeader.bIsDifferentialData = static_cast<bool>(clBitfieldReader.Read(RC4_MBLK_HDR_DATAFORMAT_FLAG_BITS));
                 stMeasurementBlockHeader.ucReferenceDataBlockID =
-                    static_cast<uint8_t>(GetBitfieldFromBuffer(&pucTempDataPointer, RC4_MBLK_HDR_REFERENCE_DATABLOCK_ID_BITS));
+                    static_cast<uint8_t>(clBitfieldReader.Read(RC4_MBLK_HDR_REFERENCE_DATABLOCK_ID_BITS));
                 stMeasurementBlockHeader.cGLONASSFrequencyNumber = 0;
 
                 // This field is only present for GLONASS and reference blocks.
                 if (eCurrentSatelliteSystem == SYSTEM::GLONASS && !stMeasurementBlockHeader.bIsDifferentialData)
                 {
+                    CheckBitsRemaining(clBitfieldReader, RC4_MBLK_HDR_GLONASS_FREQUENCY_NUMBER_BITS);
                     stMeasurementBlockHeader.cGLONASSFrequencyNumber =
-                        static_cast<uint8_t>(GetBitfieldFromBuffer(&pucTempDataPointer, RC4_MBLK_HDR_GLONASS_FREQUENCY_NUMBER_BITS));
+                        static_cast<uint8_t>(clBitfieldReader.Read(RC4_MBLK_HDR_GLONASS_FREQUENCY_NUMBER_BITS));
                 }
 
                 uiSignalsForPRN = 0;
@@ -862,37 +841,30 @@ void RangeDecompressor::RangeCmp4ToRange(uint8_t* pucCompressedData_, RangeStruc
                         {
                             if (bPrimaryBlock)
                             {
-                                DecompressReferenceBlock<false>(&pucTempDataPointer, stMeasurementBlock, eMeasurementSource);
+                                DecompressReferenceBlock<false>(clBitfieldReader, stMeasurementBlock, eMeasurementSource);
                                 bPrimaryBlock = false;
                             }
-                            else { DecompressReferenceBlock<true>(&pucTempDataPointer, stMeasurementBlock, eMeasurementSource); }
+                            else { DecompressReferenceBlock<true>(clBitfieldReader, stMeasurementBlock, eMeasurementSource); }
 
                             stChannelTrackingStatus = ChannelTrackingStatusStruct(eCurrentSatelliteSystem, eCurrentSignalType, stMeasurementBlock);
                             PopulateNextRangeData((stRangeMessage_.astRangeData[stRangeMessage_.uiNumberOfObservations++]), stMeasurementBlock,
                                                   stMetaData_, stChannelTrackingStatus, uiPRN, stMeasurementBlockHeader.cGLONASSFrequencyNumber);
 
                             // Always store reference blocks.
-                            ammmMyReferenceBlocks[static_cast<uint32_t>(eMeasurementSource)][eCurrentSatelliteSystem][eCurrentSignalType][uiPRN] =
+                            clReferenceBlocks.Get(eCurrentSatelliteSystem, eCurrentSignalType, uiPRN) =
                                 std::pair(stMeasurementBlockHeader, stMeasurementBlock);
                         }
                         else // This is a differential block.
                         {
+                            auto* pstReference = clReferenceBlocks.Find(eCurrentSatelliteSystem, eCurrentSignalType, uiPRN);
                             RangeCmp4MeasurementBlockHeaderStruct* pstReferenceBlockHeader = nullptr;
                             RangeCmp4MeasurementSignalBlockStruct* pstReferenceBlock = nullptr;
-                            try
+                            if (pstReference != nullptr)
                             {
-                                pstReferenceBlockHeader = &ammmMyReferenceBlocks[static_cast<uint32_t>(eMeasurementSource)]
-                                                               .at(eCurrentSatelliteSystem)
-                                                               .at(eCurrentSignalType)
-                                                               .at(uiPRN)
-                                                               .first;
-                                pstReferenceBlock = &ammmMyReferenceBlocks[static_cast<uint32_t>(eMeasurementSource)]
-                                                         .at(eCurrentSatelliteSystem)
-                                                         .at(eCurrentSignalType)
-                                                         .at(uiPRN)
-                                                         .second;
+                                pstReferenceBlockHeader = &pstReference->first;
+                                pstReferenceBlock = &pstReference->second;
                             }
-                            catch (...)
+                            else
                             {
                                 pclMyLogger->warn("No reference data exists for SATELLITE_SYSTEM {}, SIGNAL_TYPE "
                                                   "{}, PRN {}, ID {}",
@@ -907,13 +879,12 @@ void RangeDecompressor::RangeCmp4ToRange(uint8_t* pucCompressedData_, RangeStruc
                                 {
                                     if (bPrimaryBlock)
                                     {
-                                        DecompressDifferentialBlock<false>(&pucTempDataPointer, stMeasurementBlock, *pstReferenceBlock,
-                                                                           dSecondOffset);
+                                        DecompressDifferentialBlock<false>(clBitfieldReader, stMeasurementBlock, *pstReferenceBlock, dSecondOffset);
                                         bPrimaryBlock = false;
                                     }
                                     else
                                     {
-                                        DecompressDifferentialBlock<true>(&pucTempDataPointer, stMeasurementBlock, *pstReferenceBlock, dSecondOffset);
+                                        DecompressDifferentialBlock<true>(clBitfieldReader, stMeasurementBlock, *pstReferenceBlock, dSecondOffset);
                                     }
 
                                     stChannelTrackingStatus =
@@ -953,12 +924,14 @@ void RangeDecompressor::RangeCmp4ToRange(uint8_t* pucCompressedData_, RangeStruc
 }
 
 //------------------------------------------------------------------------------
-//! This method will decompress the range message provided in pucRangeMessageBuffer_
-//! and overwrite the contents with the decompressed message.
+//! Decode the header of the range message provided in pucRangeMessageBuffer_
+//! and convert its body to a RangeStruct. Messages that aren't in binary are
+//! encoded to binary in the buffer first, and ppucBody_ is left pointing at the
+//! binary body. RANGE messages are only accepted if bIncludeRange_ is set.
 //------------------------------------------------------------------------------
 STATUS
-RangeDecompressor::Decompress(unsigned char* pucRangeMessageBuffer_, uint32_t uiRangeMessageBufferSize_, MetaDataStruct& stMetaData_,
-                              ENCODEFORMAT eFormat_)
+RangeDecompressor::DecodeRange(unsigned char* pucRangeMessageBuffer_, uint32_t uiRangeMessageBufferSize_, MetaDataStruct& stMetaData_,
+                               IntermediateHeader& stHeader_, RangeStruct& stRange_, unsigned char** ppucBody_, bool bIncludeRange_)
 {
     // Check for buffer validity
     if (!pucRangeMessageBuffer_) { return STATUS::NULL_PROVIDED; }
@@ -966,55 +939,90 @@ RangeDecompressor::Decompress(unsigned char* pucRangeMessageBuffer_, uint32_t ui
     if (!pclMyMsgDB) { return STATUS::NO_DATABASE; }
 
     MessageDataStruct stMessageData;
-    IntermediateHeader stHeader;
     IntermediateMessage stMessage;
     STATUS eStatus = STATUS::UNKNOWN;
 
     unsigned char* pucTempMessagePointer = pucRangeMessageBuffer_;
-    eStatus = clMyHeaderDecoder.Decode(pucTempMessagePointer, stHeader, stMetaData_);
+    eStatus = clMyHeaderDecoder.Decode(pucTempMessagePointer, stHeader_, stMetaData_);
     if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
-    if (!clMyRangeCmpFilter.DoFiltering(stMetaData_)) { return STATUS::UNSUPPORTED; }
+    const bool bRange = bIncludeRange_ && stMetaData_.usMessageID == RANGE_MSG_ID;
+    if (!bRange && !clMyRangeCmpFilter.DoFiltering(stMetaData_)) { return STATUS::UNSUPPORTED; }
 
-    HEADERFORMAT eInitialFormat = stMetaData_.eFormat;
     pucTempMessagePointer += stMetaData_.uiHeaderLength;
+    uint32_t uiBodyLength = stMetaData_.uiBinaryMsgLength;
     // If the message is already in binary format, we don't need to do anything.
     // If the message is not in binary format, we need to ensure that it is encoded to binary so
     // that it can be decompressed.
-    if (eInitialFormat != HEADERFORMAT::BINARY)
+    if (stMetaData_.eFormat != HEADERFORMAT::BINARY)
     {
         eStatus = clMyMessageDecoder.Decode(pucTempMessagePointer, stMessage, stMetaData_);
         if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
-        eStatus = clMyEncoder.Encode(&pucRangeMessageBuffer_, uiRangeMessageBufferSize_, stHeader, stMessage, stMessageData, stMetaData_,
+        eStatus = clMyEncoder.Encode(&pucRangeMessageBuffer_, uiRangeMessageBufferSize_, stHeader_, stMessage, stMessageData, stMetaData_,
                                      ENCODEFORMAT::FLATTENED_BINARY);
         if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
         pucTempMessagePointer = stMessageData.pucMessageBody;
+        uiBodyLength = stMessageData.uiMessageBodyLength;
     }
+    *ppucBody_ = pucTempMessagePointer;
 
     // Convert the RANGECMPx message to a RANGE message
     try
     {
-        RangeStruct stRange;
         switch (stMetaData_.usMessageID)
         {
-        case RANGECMP_MSG_ID: RangeCmpToRange(*reinterpret_cast<RangeCmpStruct*>(pucTempMessagePointer), stRange); break;
-        case RANGECMP2_MSG_ID: RangeCmp2ToRange(*reinterpret_cast<RangeCmp2Struct*>(pucTempMessagePointer), stRange, stMetaData_); break;
+        case RANGE_MSG_ID:
+            if (!bRange) { return STATUS::UNSUPPORTED; }
+            // A binary RANGE body is already a RangeStruct, truncated to its observations.
+            memcpy(&stRange_.uiNumberOfObservations, pucTempMessagePointer, sizeof(stRange_.uiNumberOfObservations));
+            if (stRange_.uiNumberOfObservations > RANGE_RECORD_MAX ||
+                uiBodyLength < sizeof(stRange_.uiNumberOfObservations) + (stRange_.uiNumberOfObservations * sizeof(RangeDataStruct)))
+            {
+                return STATUS::MALFORMED_INPUT;
+            }
+            memcpy(stRange_.astRangeData, pucTempMessagePointer + sizeof(stRange_.uiNumberOfObservations),
+                   stRange_.uiNumberOfObservations * sizeof(RangeDataStruct));
+            break;
+        case RANGECMP_MSG_ID: RangeCmpToRange(*reinterpret_cast<RangeCmpStruct*>(pucTempMessagePointer), stRange_); break;
+        case RANGECMP2_MSG_ID: RangeCmp2ToRange(*reinterpret_cast<RangeCmp2Struct*>(pucTempMessagePointer), stRange_, stMetaData_); break;
         case RANGECMP3_MSG_ID: [[fallthrough]];
-        case RANGECMP4_MSG_ID: RangeCmp4ToRange(pucTempMessagePointer, stRange, stMetaData_); break;
+        case RANGECMP4_MSG_ID: RangeCmp4ToRange(pucTempMessagePointer, uiBodyLength, stRange_, stMetaData_); break;
         default: return STATUS::UNSUPPORTED;
         }
-
-        // Set the binary message length in the metadata for decoding purposes.
-        stMetaData_.uiBinaryMsgLength = sizeof(stRange.uiNumberOfObservations) + (stRange.uiNumberOfObservations * sizeof(RangeDataStruct));
-        memcpy(pucTempMessagePointer, &stRange, stMetaData_.uiBinaryMsgLength);
     }
     catch (...)
     {
         return STATUS::DECOMPRESSION_FAILURE;
     }
 
+    return STATUS::SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+//! This method will decompress the range message provided in pucRangeMessageBuffer_
+//! and overwrite the contents with the decompressed message.
+//------------------------------------------------------------------------------
+STATUS
+RangeDecompressor::Decompress(unsigned char* pucRangeMessageBuffer_, uint32_t uiRangeMessageBufferSize_, MetaDataStruct& stMetaData_,
+                              ENCODEFORMAT eFormat_)
+{
+    MessageDataStruct stMessageData;
+    IntermediateHeader stHeader;
+    IntermediateMessage stMessage;
+    RangeStruct stRange;
+    unsigned char* pucTempMessagePointer = nullptr;
+
+    STATUS eStatus =
+        DecodeRange(pucRangeMessageBuffer_, uiRangeMessageBufferSize_, stMetaData_, stHeader, stRange, &pucTempMessagePointer, false);
+    if (eStatus != STATUS::SUCCESS) { return eStatus; }
+
+    HEADERFORMAT eInitialFormat = stMetaData_.eFormat;
+
+    // Set the binary message length in the metadata for decoding purposes.
+    stMetaData_.uiBinaryMsgLength = sizeof(stRange.uiNumberOfObservations) + (stRange.uiNumberOfObservations * sizeof(RangeDataStruct));
+
     // Adjust metadata/header data
     stHeader.usMessageID = RANGE_MSG_ID;
     stMetaData_.usMessageID = RANGE_MSG_ID;
@@ -1022,11 +1030,6 @@ RangeDecompressor::Decompress(unsigned char* pucRangeMessageBuffer_, uint32_t ui
     memcpy(stMetaData_.acMessageName, "RANGE", 6);
 
     // The message should be returned in its original format
-    stMetaData_.eFormat = HEADERFORMAT::BINARY;
-    stMessage.clear();
-    eStatus = clMyMessageDecoder.Decode(pucTempMessagePointer, stMessage, stMetaData_);
-    if (eStatus != STATUS::SUCCESS) { return eStatus; }
-
     stMetaData_.eFormat = eInitialFormat;
     // Re-encode to the original format if a format was not specified.
     if (eFormat_ == ENCODEFORMAT::UNSPECIFIED)
@@ -1041,8 +1044,22 @@ RangeDecompressor::Decompress(unsigned char* pucRangeMessageBuffer_, uint32_t ui
                                                      : ENCODEFORMAT::ASCII; // Default to ASCII
     }
 
-    // Re-encode the data back into the range message buffer.
-    eStatus = clMyEncoder.Encode(&pucRangeMessageBuffer_, uiRangeMessageBufferSize_, stHeader, stMessage, stMessageData, stMetaData_, eFormat_);
+    // Encode the RANGE message straight from the RangeStruct back into the range message buffer.
+    eStatus = clMyEncoder.Encode(&pucRangeMessageBuffer_, uiRangeMessageBufferSize_, stHeader, stRange, stMessageData, stMetaData_, eFormat_);
+
+    // Formats and RANGE definitions that can't be encoded from a RangeStruct need the binary RANGE
+    // message decoded first.
+    if (eStatus == STATUS::UNSUPPORTED)
+    {
+        memcpy(pucTempMessagePointer, &stRange, stMetaData_.uiBinaryMsgLength);
+        stMetaData_.eFormat = HEADERFORMAT::BINARY;
+        stMessage.clear();
+        eStatus = clMyMessageDecoder.Decode(pucTempMessagePointer, stMessage, stMetaData_);
+        stMetaData_.eFormat = eInitialFormat;
+        if (eStatus != STATUS::SUCCESS) { return eStatus; }
+
+        eStatus = clMyEncoder.Encode(&pucRangeMessageBuffer_, uiRangeMessageBufferSize_, stHeader, stMessage, stMessageData, stMetaData_, eFormat_);
+    }
     if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
     // Final adjustments to MetaData
@@ -1051,3 +1068,22 @@ RangeDecompressor::Decompress(unsigned char* pucRangeMessageBuffer_, uint32_t ui
 
     return STATUS::SUCCESS;
 }
+
+//------------------------------------------------------------------------------
+//! This method will convert the range message provided in pucRangeMessageBuffer_
+//! to a RangeStruct and copy its observations into the arrays provided.
+//------------------------------------------------------------------------------
+STATUS
+RangeDecompressor::DecompressObservations(unsigned char* pucRangeMessageBuffer_, uint32_t uiRangeMessageBufferSize_, MetaDataStruct& stMetaData_,
+                                          RangeObservations& stObservations_)
+{
+    IntermediateHeader stHeader;
+    RangeStruct stRange;
+    unsigned char* pucBody = nullptr;
+
+    const STATUS eStatus = DecodeRange(pucRangeMessageBuffer_, uiRangeMessageBufferSize_, stMetaData_, stHeader, stRange, &pucBody, true);
+    if (eStatus != STATUS::SUCCESS) { return eStatus; }
+
+    stObservations_.Assign(stRange.astRangeData, stRange.uiNumberOfObservations);
+    return STATUS::SUCCESS;
+}
@@ -0,0 +1,292 @@
+////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT NovAtel Inc, 2022. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////
+//                            DESCRIPTION
+//
+//! \file range_encoder.cpp
+//! \brief Encode RANGE messages straight from a RangeStruct.
+////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include "decoders/novatel/api/rangecmp/range_encoder.hpp"
+
+#include <algorithm>
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+namespace {
+
+// -------------------------------------------------------------------------------------------------------
+template <typename T> T ReadValue(const unsigned char* pucValue_)
+{
+    T tValue;
+    memcpy(&tValue, pucValue_, sizeof(T));
+    return tValue;
+}
+
+// -------------------------------------------------------------------------------------------------------
+// The binary length of the types that RANGE observation fields can be encoded from, or 0 if the type
+// isn't supported.
+uint32_t ObservationValueLength(DATA_TYPE eDataType_)
+{
+    switch (eDataType_)
+    {
+    case DATA_TYPE::HEXBYTE: [[fallthrough]];
+    case DATA_TYPE::UCHAR: [[fallthrough]];
+    case DATA_TYPE::CHAR: return 1;
+    case DATA_TYPE::USHORT: [[fallthrough]];
+    case DATA_TYPE::SHORT: return 2;
+    case DATA_TYPE::UINT: [[fallthrough]];
+    case DATA_TYPE::ULONG: [[fallthrough]];
+    case DATA_TYPE::INT: [[fallthrough]];
+    case DATA_TYPE::LONG: [[fallthrough]];
+    case DATA_TYPE::FLOAT: return 4;
+    case DATA_TYPE::ULONGLONG: [[fallthrough]];
+    case DATA_TYPE::LONGLONG: [[fallthrough]];
+    case DATA_TYPE::DOUBLE: return 8;
+    default: return 0;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------------
+// Read a field of a binary observation into a FieldContainer, as MessageDecoder would, and pass it to
+// fEncode_.
+template <typename F> bool EncodeObservationValue(const BaseField* pclField_, const unsigned char* pucValue_, F&& fEncode_)
+{
+    switch (pclField_->dataType.name)
+    {
+    case DATA_TYPE::HEXBYTE: [[fallthrough]];
+    case DATA_TYPE::UCHAR: return fEncode_(FieldContainer(ReadValue<uint8_t>(pucValue_), pclField_));
+    case DATA_TYPE::CHAR: return fEncode_(FieldContainer(ReadValue<int8_t>(pucValue_), pclField_));
+    case DATA_TYPE::USHORT: return fEncode_(FieldContainer(ReadValue<uint16_t>(pucValue_), pclField_));
+    case DATA_TYPE::SHORT: return fEncode_(FieldContainer(ReadValue<int16_t>(pucValue_), pclField_));
+    case DATA_TYPE::UINT: [[fallthrough]];
+    case DATA_TYPE::ULONG: return fEncode_(FieldContainer(ReadValue<uint32_t>(pucValue_), pclField_));
+    case DATA_TYPE::INT: [[fallthrough]];
+    case DATA_TYPE::LONG: return fEncode_(FieldContainer(ReadValue<int32_t>(pucValue_), pclField_));
+    case DATA_TYPE::ULONGLONG: return fEncode_(FieldContainer(ReadValue<uint64_t>(pucValue_), pclField_));
+    case DATA_TYPE::LONGLONG: return fEncode_(FieldContainer(ReadValue<int64_t>(pucValue_), pclField_));
+    case DATA_TYPE::FLOAT: return fEncode_(FieldContainer(ReadValue<float>(pucValue_), pclField_));
+    case DATA_TYPE::DOUBLE: return fEncode_(FieldContainer(ReadValue<double>(pucValue_), pclField_));
+    default: return false;
+    }
+}
+
+} // namespace
+
+// -------------------------------------------------------------------------------------------------------
+RangeEncoder::RangeEncoder(JsonReader* pclJsonDb_) : Encoder(pclJsonDb_) {}
+
+// -------------------------------------------------------------------------------------------------------
+bool RangeEncoder::ResolveRangeDefinition()
+{
+    pclMyObservationsField = nullptr;
+    vMyObservationFields.clear();
+
+    const MessageDefinition* pclMsgDef = pclMyMsgDb->GetMsgDef(static_cast<int32_t>(RANGE_MSG_ID));
+    if (pclMsgDef == nullptr) { return false; }
+
+    // The RangeDecompressor asks for the definition with CRC 0, which falls back to the latest one.
+    auto itFields = pclMsgDef->fields.find(0);
+    if (itFields == pclMsgDef->fields.end()) { itFields = pclMsgDef->fields.find(pclMsgDef->latestMessageCrc); }
+    if (itFields == pclMsgDef->fields.end()) { return false; }
+
+    // RANGE is an array of observations. Each observation field must be a simple value at the same
+    // offset, and with the same alignment, as in a RangeDataStruct.
+    const std::vector<BaseField*>& vFields = itFields->second;
+    if (vFields.size() != 1 || vFields[0]->type != FIELD_TYPE::FIELD_ARRAY) { return false; }
+
+    const auto* pclObservationsField = static_cast<const FieldArrayField*>(vFields[0]);
+    uint32_t uiOffset = 0;
+    for (const BaseField* pclField : pclObservationsField->fields)
+    {
+        const uint32_t uiLength = pclField->dataType.length;
+        if (pclField->type != FIELD_TYPE::SIMPLE || uiLength == 0 || uiLength != ObservationValueLength(pclField->dataType.name) ||
+            uiOffset % std::min(4U, uiLength) != 0)
+        {
+            return false;
+        }
+        vMyObservationFields.push_back({pclField, uiOffset});
+        uiOffset += uiLength;
+    }
+    if (uiOffset != sizeof(RangeDataStruct)) { return false; }
+
+    pclMyObservationsField = pclObservationsField;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool RangeEncoder::EncodeRangeBinaryBody(const RangeStruct& stRange_, unsigned char** ppucOutBuf_, uint32_t& uiBytesLeft_, bool bFlatten_)
+{
+    // Realign to the byte boundary of the observations field as EncodeBinaryBody would
+    const uint32_t uiAlign = std::clamp(static_cast<uint32_t>(pclMyObservationsField->dataType.length), 1U, 4U);
+    if (auto ullRem = reinterpret_cast<uint64_t>(*ppucOutBuf_) % uiAlign; ullRem && !SetInBuffer(ppucOutBuf_, uiBytesLeft_, 0, uiAlign - ullRem))
+    {
+        return false;
+    }
+
+    // The observation count and the observations are laid out exactly as in the RangeStruct
+    const uint32_t uiObservationsLength = stRange_.uiNumberOfObservations * sizeof(RangeDataStruct);
+    const uint32_t uiBodyLength = sizeof(stRange_.uiNumberOfObservations) + uiObservationsLength;
+    if (uiBytesLeft_ < uiBodyLength) { return false; }
+    memcpy(*ppucOutBuf_, &stRange_, uiBodyLength);
+    *ppucOutBuf_ += uiBodyLength;
+    uiBytesLeft_ -= uiBodyLength;
+
+    // For a flattened version of the log, fill in the remaining observations with 0x00.
+    const uint32_t uiMaxObservationsLength = pclMyObservationsField->fieldSize;
+    return !bFlatten_ || uiObservationsLength >= uiMaxObservationsLength ||
+           SetInBuffer(ppucOutBuf_, uiBytesLeft_, '\0', uiMaxObservationsLength - uiObservationsLength);
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool RangeEncoder::EncodeRangeAsciiBody(const RangeStruct& stRange_, char** ppcOutBuf_, uint32_t& uiBytesLeft_)
+{
+    char cSeparator = separatorASCII();
+    if (!PrintToBuffer(ppcOutBuf_, uiBytesLeft_, "%u%c", stRange_.uiNumberOfObservations, cSeparator)) { return false; }
+
+    const auto fEncodeField = [&](const FieldContainer& fc_) {
+        return FieldToAscii(fc_, ppcOutBuf_, uiBytesLeft_) && CopyToBuffer(reinterpret_cast<unsigned char**>(ppcOutBuf_), uiBytesLeft_, &cSeparator);
+    };
+
+    for (uint32_t uiObservation = 0; uiObservation < stRange_.uiNumberOfObservations; uiObservation++)
+    {
+        const auto* pucObservation = reinterpret_cast<const unsigned char*>(&stRange_.astRangeData[uiObservation]);
+        for (const RangeField& stField : vMyObservationFields)
+        {
+            if (!EncodeObservationValue(stField.pclField, pucObservation + stField.uiOffset, fEncodeField)) { return false; }
+        }
+    }
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool RangeEncoder::EncodeRangeJsonBody(const RangeStruct& stRange_, char** ppcOutBuf_, uint32_t& uiBytesLeft_)
+{
+    auto ppucOutBuf = reinterpret_cast<unsigned char**>(ppcOutBuf_);
+    if (!CopyToBuffer(ppucOutBuf, uiBytesLeft_, "{") || !PrintJsonKeyToBuffer(ppcOutBuf_, uiBytesLeft_, pclMyObservationsField->name, "["))
+    {
+        return false;
+    }
+
+    const auto fEncodeField = [&](const FieldContainer& fc_) {
+        return PrintJsonKeyToBuffer(ppcOutBuf_, uiBytesLeft_, fc_.field_def->name) && FieldToJson(fc_, ppcOutBuf_, uiBytesLeft_) &&
+               CopyToBuffer(ppucOutBuf, uiBytesLeft_, ",");
+    };
+
+    if (stRange_.uiNumberOfObservations == 0) { return CopyToBuffer(ppucOutBuf, uiBytesLeft_, "]}"); }
+
+    for (uint32_t uiObservation = 0; uiObservation < stRange_.uiNumberOfObservations; uiObservation++)
+    {
+        if (!CopyToBuffer(ppucOutBuf, uiBytesLeft_, "{")) { return false; }
+
+        const auto* pucObservation = reinterpret_cast<const unsigned char*>(&stRange_.astRangeData[uiObservation]);
+        for (const RangeField& stField : vMyObservationFields)
+        {
+            if (!EncodeObservationValue(stField.pclField, pucObservation + stField.uiOffset, fEncodeField)) { return false; }
+        }
+        *(*ppcOutBuf_ - 1) = '}';
+        if (!CopyToBuffer(ppucOutBuf, uiBytesLeft_, ",")) { return false; }
+    }
+    *(*ppcOutBuf_ - 1) = ']';
+    return CopyToBuffer(ppucOutBuf, uiBytesLeft_, "}");
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool RangeEncoder::EncodeRangeBody(const RangeStruct& stRange_, unsigned char** ppucOutBuf_, uint32_t& uiBytesLeft_, ENCODEFORMAT eFormat_)
+{
+    switch (eFormat_)
+    {
+    case ENCODEFORMAT::ASCII: return EncodeRangeAsciiBody(stRange_, reinterpret_cast<char**>(ppucOutBuf_), uiBytesLeft_);
+    case ENCODEFORMAT::BINARY: return EncodeRangeBinaryBody(stRange_, ppucOutBuf_, uiBytesLeft_, false);
+    case ENCODEFORMAT::FLATTENED_BINARY: return EncodeRangeBinaryBody(stRange_, ppucOutBuf_, uiBytesLeft_, true);
+    case ENCODEFORMAT::JSON: return EncodeRangeJsonBody(stRange_, reinterpret_cast<char**>(ppucOutBuf_), uiBytesLeft_);
+    default: return false;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+RangeEncoder::Encode(unsigned char** ppucBuffer_, uint32_t uiBufferSize_, IntermediateHeader& stHeader_, const RangeStruct& stRange_,
+                     MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, ENCODEFORMAT eFormat_)
+{
+    if (ppucBuffer_ == nullptr || *ppucBuffer_ == nullptr) { return STATUS::NULL_PROVIDED; }
+
+    if (!pclMyMsgDb) { return STATUS::NO_DATABASE; }
+
+    if (eFormat_ != ENCODEFORMAT::ASCII && eFormat_ != ENCODEFORMAT::BINARY && eFormat_ != ENCODEFORMAT::FLATTENED_BINARY &&
+        eFormat_ != ENCODEFORMAT::JSON)
+    {
+        return STATUS::UNSUPPORTED;
+    }
+
+    if (stRange_.uiNumberOfObservations > RANGE_RECORD_MAX) { return STATUS::FAILURE; }
+
+    // The fields point into the database's definitions, which are rebuilt whenever it changes
+    if (pclMyRangeDb != pclMyMsgDb || ullMyRangeGeneration != pclMyMsgDb->GetGeneration())
+    {
+        pclMyRangeDb = pclMyMsgDb;
+        ullMyRangeGeneration = pclMyMsgDb->GetGeneration();
+        if (!ResolveRangeDefinition()) { return STATUS::UNSUPPORTED; }
+    }
+    if (pclMyObservationsField == nullptr) { return STATUS::UNSUPPORTED; }
+
+    unsigned char* pucTempEncodeBuffer = *ppucBuffer_;
+    auto ppcTempEncodeBuffer = reinterpret_cast<char**>(&pucTempEncodeBuffer);
+
+    if (eFormat_ == ENCODEFORMAT::JSON && !PrintToBuffer(ppcTempEncodeBuffer, uiBufferSize_, R"({"header": )")) { return STATUS::BUFFER_FULL; }
+
+    const STATUS eStatus = EncodeHeader(&pucTempEncodeBuffer, uiBufferSize_, stHeader_, stMessageData_, stMetaData_, eFormat_);
+    if (eStatus != STATUS::SUCCESS) { return eStatus; }
+
+    pucTempEncodeBuffer += stMessageData_.uiMessageHeaderLength;
+    uiBufferSize_ -= stMessageData_.uiMessageHeaderLength;
+
+    if (eFormat_ == ENCODEFORMAT::JSON && !PrintToBuffer(ppcTempEncodeBuffer, uiBufferSize_, R"(,"body": )")) { return STATUS::BUFFER_FULL; }
+
+    unsigned char* pucBody = pucTempEncodeBuffer;
+    if (!EncodeRangeBody(stRange_, &pucTempEncodeBuffer, uiBufferSize_, eFormat_)) { return STATUS::BUFFER_FULL; }
+
+    if (eFormat_ == ENCODEFORMAT::ASCII)
+    {
+        if (!EncodeAsciiFooter(ppcTempEncodeBuffer, uiBufferSize_, stMessageData_)) { return STATUS::BUFFER_FULL; }
+    }
+    else if (eFormat_ == ENCODEFORMAT::BINARY || eFormat_ == ENCODEFORMAT::FLATTENED_BINARY)
+    {
+        const STATUS eFooterStatus = EncodeBinaryFooter(pucBody, &pucTempEncodeBuffer, uiBufferSize_, stMessageData_, stMetaData_);
+        if (eFooterStatus != STATUS::SUCCESS) { return eFooterStatus; }
+    }
+
+    stMessageData_.pucMessageBody = pucBody;
+    stMessageData_.uiMessageBodyLength = pucTempEncodeBuffer - pucBody;
+
+    if (eFormat_ == ENCODEFORMAT::JSON && !PrintToBuffer(ppcTempEncodeBuffer, uiBufferSize_, R"(})")) { return STATUS::BUFFER_FULL; }
+
+    stMessageData_.pucMessage = *ppucBuffer_;
+    stMessageData_.uiMessageLength = pucTempEncodeBuffer - *ppucBuffer_;
+
+    return STATUS::SUCCESS;
+}
@@ -907,6 +907,183 @@ TEST_F(FramerTest, NULL_FRAME)
    ASSERT_EQ(STATUS::NULL_PROVIDED, pclMyFramer->GetFrame(nullptr, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
 }
 
+TEST_F(FramerTest, BULK_SCAN_MATCHES_STATE_MACHINE)
+{
+   struct FrameResult
+   {
+      STATUS eStatus;
+      MetaDataStruct stMetaData;
+      std::vector<unsigned char> vBytes;
+   };
+
+   // Frame a file and record every result, including the bytes of framed and unknown data
+   auto FrameFile = [this](const std::string& sFilename_, uint32_t uiFrameBufferSize_, bool bBulkScan_)
+   {
+      std::vector<FrameResult> vResults;
+      pclMyFramer->SetBulkScan(bBulkScan_);
+      WriteFileStreamToFramer(sFilename_);
+
+      STATUS eStatus;
+      do
+      {
+         FrameResult stResult;
+         eStatus = stResult.eStatus = pclMyFramer->GetFrame(pucMyTestFrameBuffer.get(), uiFrameBufferSize_, stResult.stMetaData);
+         if (eStatus == STATUS::SUCCESS || eStatus == STATUS::UNKNOWN)
+         {
+            stResult.vBytes.assign(pucMyTestFrameBuffer.get(), pucMyTestFrameBuffer.get() + stResult.stMetaData.uiLength);
+         }
+         vResults.push_back(stResult);
+      } while (eStatus == STATUS::SUCCESS || eStatus == STATUS::UNKNOWN);
+
+      FlushFramer();
+      return vResults;
+   };
+
+   for (const std::string sFilename : { "BESTUTMBIN.GPS", "abbreviated_ascii_sync_error.ASC", "ascii_sync_error.ASC", "binary_sync_error.BIN",
+                                        "nmea_sync_error.txt", "proprietary_binary_sync_error.BIN", "short_ascii_sync_error.ASC", "short_binary_sync_error.BIN" })
+   {
+      for (uint32_t uiFrameBufferSize : { static_cast<uint32_t>(MAX_ASCII_MESSAGE_LENGTH), 100U })
+      {
+         const std::vector<FrameResult> vExpected = FrameFile(sFilename, uiFrameBufferSize, false);
+         const std::vector<FrameResult> vBulkScan = FrameFile(sFilename, uiFrameBufferSize, true);
+
+         ASSERT_EQ(vExpected.size(), vBulkScan.size()) << sFilename;
+         for (size_t i = 0; i < vExpected.size(); i++)
+         {
+            ASSERT_EQ(vExpected[i].eStatus, vBulkScan[i].eStatus) << sFilename << " frame " << i;
+            ASSERT_EQ(vExpected[i].stMetaData, vBulkScan[i].stMetaData) << sFilename << " frame " << i;
+            ASSERT_EQ(vExpected[i].vBytes, vBulkScan[i].vBytes) << sFilename << " frame " << i;
+         }
+      }
+   }
+
+   pclMyFramer->SetBulkScan(true);
+}
+
+TEST_F(FramerTest, BULK_SCAN_SPLIT_WRITES)
+{
+   // Frame bytes written in pieces of the given sizes, taken in turn, framing after every write. A fresh Framer keeps
+   // its buffer small, so the bytes wrap around it many times. Runs of unknown bytes are merged, as a write can end
+   // inside one.
+   auto FrameBytes = [this](const std::vector<unsigned char>& vBytes_, const std::vector<size_t>& vPieces_, bool bBulkScan_)
+   {
+      Framer clFramer;
+      clFramer.SetReportUnknownBytes(true);
+      clFramer.SetPayloadOnly(false);
+      clFramer.SetBulkScan(bBulkScan_);
+
+      std::vector<std::pair<STATUS, std::vector<unsigned char>>> vResults;
+      auto Store = [&vResults](STATUS eStatus_, const unsigned char* pucBytes_, uint32_t uiLength_)
+      {
+         if (eStatus_ == STATUS::UNKNOWN && !vResults.empty() && vResults.back().first == STATUS::UNKNOWN)
+         {
+            vResults.back().second.insert(vResults.back().second.end(), pucBytes_, pucBytes_ + uiLength_);
+         }
+         else if (uiLength_ > 0) { vResults.emplace_back(eStatus_, std::vector<unsigned char>(pucBytes_, pucBytes_ + uiLength_)); }
+      };
+
+      // The Framer keeps the format of a partial frame in the metadata, so it lasts across writes
+      STATUS eStatus;
+      MetaDataStruct stMetaData;
+      size_t ulPosition = 0;
+      for (size_t ulPiece = 0; ulPosition < vBytes_.size(); ulPiece++)
+      {
+         const size_t ulWrite = std::min(vPieces_[ulPiece % vPieces_.size()], vBytes_.size() - ulPosition);
+         EXPECT_EQ(clFramer.Write(vBytes_.data() + ulPosition, static_cast<uint32_t>(ulWrite)), ulWrite);
+         ulPosition += ulWrite;
+
+         while ((eStatus = clFramer.GetFrame(pucMyTestFrameBuffer.get(), MAX_ASCII_MESSAGE_LENGTH, stMetaData)) == STATUS::SUCCESS ||
+                eStatus == STATUS::UNKNOWN)
+         {
+            Store(eStatus, pucMyTestFrameBuffer.get(), stMetaData.uiLength);
+         }
+      }
+
+      uint32_t uiFlushed;
+      while ((uiFlushed = clFramer.Flush(pucMyTestFrameBuffer.get(), MAX_ASCII_MESSAGE_LENGTH)) > 0)
+      {
+         Store(STATUS::UNKNOWN, pucMyTestFrameBuffer.get(), uiFlushed);
+      }
+      return vResults;
+   };
+
+   auto ReadFile = [](const std::string& sFilename_)
+   {
+      std::ifstream clFile(std::filesystem::path(std::getenv("TEST_RESOURCE_PATH")) / sFilename_, std::ios::binary);
+      return std::vector<unsigned char>((std::istreambuf_iterator<char>(clFile)), std::istreambuf_iterator<char>());
+   };
+
+   std::vector<std::pair<std::string, std::vector<unsigned char>>> vInputs;
+   for (const std::string sFilename : { "BESTUTMBIN.GPS", "abbreviated_ascii_sync_error.ASC", "ascii_sync_error.ASC", "binary_sync_error.BIN",
+                                        "nmea_sync_error.txt", "proprietary_binary_sync_error.BIN", "short_ascii_sync_error.ASC", "short_binary_sync_error.BIN" })
+   {
+      vInputs.emplace_back(sFilename, ReadFile(sFilename));
+      ASSERT_FALSE(vInputs.back().second.empty()) << sFilename;
+   }
+
+   // The sync error files are mostly unknown bytes, so frames of every format are mixed with junk in a stream of their own
+   const std::string sFrames = "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n"
+                               "junk%RAWIMUSXA,1692,484620.664;00,11,1692,484620.664389000,00801503,43110635,-817242,-202184,-215194,-41188,-9895*a5db8c7b\r\n"
+                               "$GPALM,30,01,01,2029,00,4310,7b,145f,fd44,a10ce4,1c5b11,0b399f,2bc421,f80,ffe*29\r\n"
+                               "<BESTPOS COM1 0 72.0 FINESTEERING 2215 148248.000 02000020 cdba 32768\r\n"
+                               "<     SOL_COMPUTED SINGLE 51.15043711386 -114.03067767000 1097.2099 -17.0000 WGS84 0.9038 0.8534 1.7480 \"\" 0.000 0.000 35 30 30 30 00 06 39 33\r\n[COM1]";
+   const std::vector<unsigned char> vBinaryFrames = vInputs.front().second;
+   std::vector<unsigned char> vMixed;
+   for (uint32_t i = 0; i < 200; i++)
+   {
+      vMixed.insert(vMixed.end(), sFrames.begin(), sFrames.end());
+      vMixed.insert(vMixed.end(), vBinaryFrames.begin(), vBinaryFrames.end());
+   }
+   vInputs.emplace_back("mixed frames", vMixed);
+
+   for (const auto& [sInput, vBytes] : vInputs)
+   {
+      for (const bool bBulkScan : { true, false })
+      {
+         const auto vExpected = FrameBytes(vBytes, { vBytes.size() }, bBulkScan);
+         const auto IsFrame = [](const auto& stResult_) { return stResult_.first == STATUS::SUCCESS; };
+         if (sInput == "mixed frames") { ASSERT_EQ(std::count_if(vExpected.begin(), vExpected.end(), IsFrame), 1000); }
+         ASSERT_EQ(vExpected, FrameBytes(vBytes, { 1 }, bBulkScan)) << sInput << " in 1-byte writes";
+         ASSERT_EQ(vExpected, FrameBytes(vBytes, { 3, 17, 1, 251, 7, 1021 }, bBulkScan)) << sInput << " in odd-sized writes";
+      }
+   }
+}
+
+TEST_F(FramerTest, FRAME_IN_PLACE_MATCHES_COPY)
+{
+   // Frame a file and record the bytes of every frame and unknown data
+   auto FrameFile = [this](const std::string& sFilename_, bool bInPlace_)
+   {
+      std::vector<std::vector<unsigned char>> vFrames;
+      pclMyFramer->SetFrameInPlace(bInPlace_);
+      WriteFileStreamToFramer(sFilename_);
+
+      STATUS eStatus;
+      MetaDataStruct stMetaData;
+      while ((eStatus = pclMyFramer->GetFrame(pucMyTestFrameBuffer.get(), MAX_ASCII_MESSAGE_LENGTH, stMetaData)) == STATUS::SUCCESS ||
+             eStatus == STATUS::UNKNOWN)
+      {
+         const unsigned char* pucFrame = eStatus == STATUS::SUCCESS ? pclMyFramer->GetFrameData() : pucMyTestFrameBuffer.get();
+         if (bInPlace_ && eStatus == STATUS::SUCCESS) { EXPECT_NE(pucFrame, pucMyTestFrameBuffer.get()) << sFilename_; }
+         vFrames.emplace_back(pucFrame, pucFrame + stMetaData.uiLength);
+      }
+
+      FlushFramer();
+      return vFrames;
+   };
+
+   if (!pclMyFramer->SetMirroredBuffer(true)) { GTEST_SKIP() << "Mirrored buffers are not supported on this platform"; }
+
+   for (const std::string sFilename : { "BESTUTMBIN.GPS", "ascii_sync_error.ASC", "binary_sync_error.BIN", "short_ascii_sync_error.ASC",
+                                        "short_binary_sync_error.BIN" })
+   {
+      ASSERT_EQ(FrameFile(sFilename, false), FrameFile(sFilename, true)) << sFilename;
+   }
+
+   pclMyFramer->SetFrameInPlace(false);
+   pclMyFramer->SetMirroredBuffer(false);
+}
+
 // -------------------------------------------------------------------------------------------------------
 // Decode/Encode Unit Tests
 // -------------------------------------------------------------------------------------------------------
@@ -2846,6 +3023,14 @@ TEST_F(FileParserTest, RANGE_CMP)
    ASSERT_FALSE(pclFp->GetDecompressRangeCmp());
 }
 
+TEST_F(FileParserTest, PASSTHROUGH)
+{
+   pclFp->SetPassthrough(true);
+   ASSERT_TRUE(pclFp->GetPassthrough());
+   pclFp->SetPassthrough(false);
+   ASSERT_FALSE(pclFp->GetPassthrough());
+}
+
 TEST_F(FileParserTest, UNKNOWN_BYTES)
 {
    pclFp->SetReturnUnknownBytes(true);
@@ -2896,6 +3081,39 @@ TEST_F(FileParserTest, PARSE_FILE_WITH_FILTER)
    ASSERT_EQ(numSuccess, 2);
 }
 
+TEST_F(FileParserTest, PARSE_FILE_WITH_PASSTHROUGH)
+{
+   pclFp = std::make_unique<FileParser>(std::getenv("TEST_DATABASE_PATH"));
+
+   // Parse the file once with decoding and encoding, then again with passthrough
+   auto ParseFile = [](FileParser& clFileParser_)
+   {
+      std::vector<std::vector<unsigned char>> vMessages;
+      std::filesystem::path test_gps_file = std::filesystem::path(std::getenv("TEST_RESOURCE_PATH")) / "BESTUTMBIN.GPS";
+      InputFileStream clInputFileStream(test_gps_file.string().c_str());
+      EXPECT_TRUE(clFileParser_.SetStream(&clInputFileStream));
+      clFileParser_.SetEncodeFormat(ENCODEFORMAT::BINARY);
+
+      MetaDataStruct stMetaData;
+      MessageDataStruct stMessageData;
+      STATUS eStatus;
+      while ((eStatus = clFileParser_.Read(stMessageData, stMetaData)) != STATUS::STREAM_EMPTY)
+      {
+         if (eStatus != STATUS::SUCCESS) { continue; }
+         EXPECT_EQ(stMessageData.uiMessageHeaderLength + stMessageData.uiMessageBodyLength, stMessageData.uiMessageLength);
+         vMessages.emplace_back(stMessageData.pucMessage, stMessageData.pucMessage + stMessageData.uiMessageLength);
+      }
+      return vMessages;
+   };
+
+   const std::vector<std::vector<unsigned char>> vExpected = ParseFile(*pclFp);
+   ASSERT_EQ(vExpected.size(), 2U);
+
+   pclFp->SetPassthrough(true);
+   ASSERT_EQ(ParseFile(*pclFp), vExpected);
+   pclFp->SetPassthrough(false);
+}
+
 TEST_F(FileParserTest, RESET)
 {
    pclFp = std::make_unique<FileParser>();
@@ -2903,6 +3121,544 @@ TEST_F(FileParserTest, RESET)
    ASSERT_TRUE(pclFp->Reset());
 }
 
+// -------------------------------------------------------------------------------------------------------
+// Parser Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class ParserTest : public ::testing::Test
+{
+protected:
+   // A message small enough to write by hand, so that these tests don't depend on the database. RANGE is what
+   // RANGECMP2 and RANGECMP4 logs are decompressed to, and they and RXCONFIG only need a name.
+   static constexpr const char* szJsonDb = R"({
+      "enums": [
+         { "_id": "PortAddress", "name": "PortAddress", "enumerators": [{ "value": 32, "name": "COM1", "description": null }] },
+         { "_id": "GPSTimeStatus", "name": "GPSTimeStatus", "enumerators": [{ "value": 180, "name": "FINESTEERING", "description": null }] }
+      ],
+      "logs": [{
+         "_id": "2000", "messageID": 2000, "name": "TESTLOG", "description": null, "latestMsgDefCrc": "0",
+         "fields": { "0": [
+            { "name": "value", "description": null, "type": "SIMPLE", "conversionString": "%lu",
+              "dataType": { "name": "ULONG", "length": 4, "description": null } },
+            { "name": "reading", "description": null, "type": "SIMPLE", "conversionString": "%.3lf",
+              "dataType": { "name": "DOUBLE", "length": 8, "description": null } }
+         ]}
+      }, {
+         "_id": "1273", "messageID": 1273, "name": "RANGECMP2", "description": null, "latestMsgDefCrc": "0", "fields": { "0": [] }
+      }, {
+         "_id": "2050", "messageID": 2050, "name": "RANGECMP4", "description": null, "latestMsgDefCrc": "0", "fields": { "0": [] }
+      }, {
+         "_id": "128", "messageID": 128, "name": "RXCONFIG", "description": null, "latestMsgDefCrc": "0", "fields": { "0": [] }
+      }, {
+         "_id": "43", "messageID": 43, "name": "RANGE", "description": null, "latestMsgDefCrc": "0",
+         "fields": { "0": [{
+            "name": "obs", "description": null, "type": "FIELD_ARRAY", "conversionString": null, "arrayLength": 325,
+            "dataType": { "name": "UNKNOWN", "length": 44, "description": null },
+            "fields": [
+               { "name": "sv_prn", "description": null, "type": "SIMPLE", "conversionString": "%hu",
+                 "dataType": { "name": "USHORT", "length": 2, "description": null } },
+               { "name": "glo_freq", "description": null, "type": "SIMPLE", "conversionString": "%hu",
+                 "dataType": { "name": "USHORT", "length": 2, "description": null } },
+               { "name": "psr", "description": null, "type": "SIMPLE", "conversionString": "%.3lf",
+                 "dataType": { "name": "DOUBLE", "length": 8, "description": null } },
+               { "name": "psr_std", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+                 "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+               { "name": "adr", "description": null, "type": "SIMPLE", "conversionString": "%.3lf",
+                 "dataType": { "name": "DOUBLE", "length": 8, "description": null } },
+               { "name": "adr_std", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+                 "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+               { "name": "dopp", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+                 "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+               { "name": "cno", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+                 "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+               { "name": "locktime", "description": null, "type": "SIMPLE", "conversionString": "%.3f",
+                 "dataType": { "name": "FLOAT", "length": 4, "description": null } },
+               { "name": "ch_tr_status", "description": null, "type": "SIMPLE", "conversionString": "%lx",
+                 "dataType": { "name": "ULONG", "length": 4, "description": null } }
+            ]
+         }]}
+      }]
+   })";
+
+   // The first satellites of a receiver's RANGECMP2A log, whose locktimes are all saturated
+   static constexpr const char* szRangeCmp2Data =
+      "000200c8ba5b859afb2fe1ffff6b3f0651e830813d00e4ffff43bac60a006c803d0001140034b7f884a8ff2fe1ffff6b3fa428a83c82f0ffe4ffff43"
+      "9c4404c8cb82f0ff021d00043bfd04720330e1ffff6b3f2628086b811200e4ffff439ca605283f811200e5ffff095d860f50b081120003060020dbf8"
+      "854ef94fe1ffff6b954a513855800a00e4ffff43d56a798813800a00e5ffff09782a88a836800a00e7ffff031ca4a8706980f7ff";
+
+   // The compressed data of a receiver's RANGECMP4A log
+   static constexpr const char* szRangeCmp4Data =
+      "030000421204000000009200df7688831f611fd87ca0b03a00638bbdf7b82f49b080fd0ec0ff1f091f8214ff4d4d00a1009cbf1751f6911f5141f87f"
+      "d9571a96dbd7040c8090f87f0080fcf722fe9bfa8a49a8ff4f299d7f96fb9afefc771800fcffd0063f02cde01f3c7dd3ffb75240886f5fa2b0ff91f5"
+      "7f00003edf8b78868c882878014065dbf7d3ed6b722680d5fc0f00a4c08730fe7fecf8bffa3f003008000000002001f03fa019f8136a11273649b8fc"
+      "efab9c434c7b89e71560dbfe070030b2e04fd841f33125320b80b0ecefa5ee21243ac0bb03e0ffc36a813fb13bbe5791a0f5ff9e3bdbffbb87f0cb80"
+      "64f03f0000e4b67dd15bc5f4a50a3a006ca72fdee53ec86405b2c0fffa3fa450f725d5bfed7c49b1fb0fb16b45a87a9adb0740cbfe0700";
+
+   JsonReader clJsonDb;
+
+   void SetUp() override { clJsonDb.ParseJson(szJsonDb); }
+
+   // A binary log with a body, header and CRC
+   static std::vector<unsigned char> MakeLog(uint32_t uiMessageID_, double dMilliseconds_, const std::vector<unsigned char>& vBody_)
+   {
+      IntermediateHeader stHeader;
+      stHeader.usMessageID = static_cast<uint16_t>(uiMessageID_);
+      stHeader.uiPortAddress = 32;
+      stHeader.uiTimeStatus = 180;
+      stHeader.usWeek = 2167;
+      stHeader.dMilliseconds = dMilliseconds_;
+      stHeader.usLength = static_cast<uint16_t>(vBody_.size());
+      const OEM4BinaryHeader stBinaryHeader(stHeader);
+
+      std::vector<unsigned char> vLog(sizeof(stBinaryHeader) + vBody_.size() + OEM4_BINARY_CRC_LENGTH);
+      memcpy(vLog.data(), &stBinaryHeader, sizeof(stBinaryHeader));
+      memcpy(vLog.data() + sizeof(stBinaryHeader), vBody_.data(), vBody_.size());
+      const uint32_t uiCrc = CalculateBlockCRC32(static_cast<uint32_t>(vLog.size() - OEM4_BINARY_CRC_LENGTH), 0, vLog.data());
+      memcpy(vLog.data() + vLog.size() - OEM4_BINARY_CRC_LENGTH, &uiCrc, sizeof(uiCrc));
+      return vLog;
+   }
+
+   // A binary TESTLOG followed by a few junk bytes every so often
+   static std::vector<unsigned char> MakeStream(uint32_t uiLogs_)
+   {
+      std::vector<unsigned char> vStream;
+      for (uint32_t i = 0; i < uiLogs_; ++i)
+      {
+         const double dReading = 1000.0 / (i + 1);
+         std::vector<unsigned char> vBody(sizeof(i) + sizeof(dReading));
+         memcpy(vBody.data(), &i, sizeof(i));
+         memcpy(vBody.data() + sizeof(i), &dReading, sizeof(dReading));
+
+         const std::vector<unsigned char> vLog = MakeLog(2000, 244820000.0 + 50.0 * i, vBody);
+         vStream.insert(vStream.end(), vLog.begin(), vLog.end());
+         if (i % 17 == 5) { vStream.insert(vStream.end(), { 'j', 'u', 'n', 'k' }); }
+      }
+      return vStream;
+   }
+
+   // A binary RANGECMP2 or RANGECMP4 log, its body the length of the compressed data and the data itself
+   static std::vector<unsigned char> MakeRangeCmpLog(uint32_t uiMessageID_, double dMilliseconds_, const std::string& strData_)
+   {
+      const auto uiDataLength = static_cast<uint32_t>(strData_.size() / 2);
+      std::vector<unsigned char> vBody(sizeof(uiDataLength));
+      memcpy(vBody.data(), &uiDataLength, sizeof(uiDataLength));
+      for (size_t i = 0; i < strData_.size(); i += 2) { vBody.push_back(static_cast<unsigned char>(std::stoul(strData_.substr(i, 2), nullptr, 16))); }
+      return MakeLog(uiMessageID_, dMilliseconds_, vBody);
+   }
+
+   // An epoch a second long for each of uiEpochs_: TESTLOGs, a RANGECMP2 log, an RXCONFIG log with a complete TESTLOG
+   // embedded in it, and a RANGECMP4 log
+   static std::vector<unsigned char> MakeRangeCmpStream(uint32_t uiEpochs_)
+   {
+      std::vector<unsigned char> vStream;
+      for (uint32_t uiEpoch = 0; uiEpoch < uiEpochs_; ++uiEpoch)
+      {
+         const double dMilliseconds = 244820000.0 + 1000.0 * uiEpoch;
+         for (const std::vector<unsigned char>& vLog : { MakeStream(2), MakeRangeCmpLog(RANGECMP2_MSG_ID, dMilliseconds, szRangeCmp2Data),
+                                                         MakeLog(128, dMilliseconds, MakeStream(1)),
+                                                         MakeRangeCmpLog(RANGECMP4_MSG_ID, dMilliseconds, szRangeCmp4Data) })
+         {
+            vStream.insert(vStream.end(), vLog.begin(), vLog.end());
+         }
+      }
+      return vStream;
+   }
+
+   // Feed the stream to the parser a chunk at a time and collect everything it returns
+   static std::vector<std::pair<STATUS, std::vector<unsigned char>>> ParseStream(Parser& clParser_, std::vector<unsigned char>& vStream_)
+   {
+      std::vector<std::pair<STATUS, std::vector<unsigned char>>> vResults;
+      MessageDataStruct stMessageData;
+      MetaDataStruct stMetaData;
+
+      for (size_t ullOffset = 0; ullOffset < vStream_.size();)
+      {
+         ullOffset += clParser_.Write(vStream_.data() + ullOffset, static_cast<uint32_t>(std::min<size_t>(vStream_.size() - ullOffset, 1000)));
+
+         STATUS eStatus;
+         while ((eStatus = clParser_.Read(stMessageData, stMetaData)) != STATUS::BUFFER_EMPTY)
+         {
+            // Unknown bytes are returned as a header
+            const unsigned char* pucData = eStatus == STATUS::UNKNOWN ? stMessageData.pucMessageHeader : stMessageData.pucMessage;
+            const uint32_t uiLength = eStatus == STATUS::UNKNOWN ? stMessageData.uiMessageHeaderLength : stMessageData.uiMessageLength;
+            vResults.emplace_back(eStatus, std::vector<unsigned char>(pucData, pucData + uiLength));
+         }
+      }
+      return vResults;
+   }
+
+   static std::filesystem::path WriteFile(const std::string& strName_, const std::vector<unsigned char>& vStream_)
+   {
+      const std::filesystem::path clPath = std::filesystem::temp_directory_path() / strName_;
+      std::ofstream clFile(clPath, std::ios::binary);
+      clFile.write(reinterpret_cast<const char*>(vStream_.data()), static_cast<std::streamsize>(vStream_.size()));
+      return clPath;
+   }
+
+   // Read the whole file through the FileParser and collect everything it returns
+   template <typename InputStream>
+   static std::vector<std::pair<STATUS, std::vector<unsigned char>>> ParseFile(FileParser& clFileParser_, const std::filesystem::path& clPath_)
+   {
+      std::vector<std::pair<STATUS, std::vector<unsigned char>>> vResults;
+      InputStream clInputStream(clPath_.string().c_str());
+      EXPECT_TRUE(clFileParser_.SetStream(&clInputStream));
+
+      MessageDataStruct stMessageData;
+      MetaDataStruct stMetaData;
+      STATUS eStatus;
+      while ((eStatus = clFileParser_.Read(stMessageData, stMetaData)) != STATUS::STREAM_EMPTY)
+      {
+         const unsigned char* pucData = eStatus == STATUS::UNKNOWN ? stMessageData.pucMessageHeader : stMessageData.pucMessage;
+         const uint32_t uiLength = eStatus == STATUS::UNKNOWN ? stMessageData.uiMessageHeaderLength : stMessageData.uiMessageLength;
+         vResults.emplace_back(eStatus, std::vector<unsigned char>(pucData, pucData + uiLength));
+      }
+      EXPECT_EQ(clFileParser_.GetPercentRead(), 100U);
+      return vResults;
+   }
+};
+
+TEST_F(ParserTest, WORKER_THREADS)
+{
+   Parser clParser(&clJsonDb);
+   ASSERT_EQ(clParser.GetWorkerThreads(), 1U);
+   clParser.SetWorkerThreads(4);
+   ASSERT_EQ(clParser.GetWorkerThreads(), 4U);
+   clParser.SetWorkerThreads(0);
+   ASSERT_EQ(clParser.GetWorkerThreads(), 1U);
+}
+
+TEST_F(ParserTest, WORKER_THREADS_PRESERVE_ORDER)
+{
+   std::vector<unsigned char> vStream = MakeStream(500);
+
+   for (ENCODEFORMAT eFormat : { ENCODEFORMAT::ASCII, ENCODEFORMAT::JSON, ENCODEFORMAT::BINARY })
+   {
+      Parser clSerialParser(&clJsonDb);
+      clSerialParser.SetEncodeFormat(eFormat);
+      const auto vExpected = ParseStream(clSerialParser, vStream);
+      ASSERT_GT(vExpected.size(), 500U);
+
+      Parser clPipelinedParser(&clJsonDb);
+      clPipelinedParser.SetEncodeFormat(eFormat);
+      clPipelinedParser.SetWorkerThreads(4);
+      ASSERT_EQ(ParseStream(clPipelinedParser, vStream), vExpected);
+   }
+}
+
+TEST_F(ParserTest, WORKER_THREADS_FLUSH)
+{
+   std::vector<unsigned char> vStream = MakeStream(50);
+   Parser clParser(&clJsonDb);
+   clParser.SetWorkerThreads(3);
+
+   // Leave messages in flight, then flush them away
+   MessageDataStruct stMessageData;
+   MetaDataStruct stMetaData;
+   clParser.Write(vStream.data(), static_cast<uint32_t>(vStream.size()));
+   ASSERT_EQ(clParser.Read(stMessageData, stMetaData), STATUS::SUCCESS);
+   clParser.Flush();
+   ASSERT_EQ(clParser.Read(stMessageData, stMetaData), STATUS::BUFFER_EMPTY);
+
+   Parser clSerialParser(&clJsonDb);
+   ASSERT_EQ(ParseStream(clParser, vStream), ParseStream(clSerialParser, vStream));
+}
+
+TEST_F(ParserTest, WORKER_THREADS_RANGECMP)
+{
+   // RANGECMP logs are decompressed in stream order before their RANGE logs are encoded on the workers
+   std::vector<unsigned char> vStream = MakeRangeCmpStream(20);
+
+   for (ENCODEFORMAT eFormat : { ENCODEFORMAT::ASCII, ENCODEFORMAT::JSON, ENCODEFORMAT::BINARY })
+   {
+      Parser clSerialParser(&clJsonDb);
+      clSerialParser.SetEncodeFormat(eFormat);
+      const auto vExpected = ParseStream(clSerialParser, vStream);
+      ASSERT_EQ(vExpected.size(), 100U);
+
+      Parser clPipelinedParser(&clJsonDb);
+      clPipelinedParser.SetEncodeFormat(eFormat);
+      clPipelinedParser.SetWorkerThreads(4);
+      ASSERT_EQ(ParseStream(clPipelinedParser, vStream), vExpected);
+   }
+}
+
+TEST_F(ParserTest, WORKER_THREADS_ZERO_COPY)
+{
+   // Frames that would be returned in place are copied for the workers, and messages are the same either way
+   std::vector<unsigned char> vStream = MakeRangeCmpStream(10);
+   std::vector<unsigned char> vTestLogs = MakeStream(500);
+   vStream.insert(vStream.end(), vTestLogs.begin(), vTestLogs.end());
+
+   for (ENCODEFORMAT eFormat : { ENCODEFORMAT::ASCII, ENCODEFORMAT::BINARY })
+   {
+      Parser clSerialParser(&clJsonDb);
+      clSerialParser.SetEncodeFormat(eFormat);
+      clSerialParser.SetZeroCopy(true);
+      const auto vExpected = ParseStream(clSerialParser, vStream);
+      ASSERT_GT(vExpected.size(), 560U);
+
+      Parser clPipelinedParser(&clJsonDb);
+      clPipelinedParser.SetEncodeFormat(eFormat);
+      clPipelinedParser.SetZeroCopy(true);
+      clPipelinedParser.SetWorkerThreads(4);
+      ASSERT_EQ(ParseStream(clPipelinedParser, vStream), vExpected);
+   }
+}
+
+TEST_F(ParserTest, CHUNK_THREADS)
+{
+   FileParser clFileParser(&clJsonDb);
+   ASSERT_EQ(clFileParser.GetChunkThreads(), 1U);
+   clFileParser.SetChunkThreads(4);
+   ASSERT_EQ(clFileParser.GetChunkThreads(), 4U);
+   clFileParser.SetChunkThreads(0);
+   ASSERT_EQ(clFileParser.GetChunkThreads(), 1U);
+}
+
+TEST_F(ParserTest, CHUNK_THREADS_PRESERVE_ORDER)
+{
+   const std::filesystem::path clPath = WriteFile("edie_chunk_threads_test.GPS", MakeStream(2000));
+
+   for (ENCODEFORMAT eFormat : { ENCODEFORMAT::ASCII, ENCODEFORMAT::JSON, ENCODEFORMAT::BINARY })
+   {
+      FileParser clSerialParser(&clJsonDb);
+      clSerialParser.SetEncodeFormat(eFormat);
+      const auto vExpected = ParseFile<InputFileStream>(clSerialParser, clPath);
+      ASSERT_GT(vExpected.size(), 2000U);
+
+      // Chunks much smaller than the file, so that plenty of logs straddle a boundary
+      FileParser clChunkedParser(&clJsonDb);
+      clChunkedParser.SetEncodeFormat(eFormat);
+      clChunkedParser.SetChunkThreads(3, 1000);
+      ASSERT_EQ(ParseFile<InputFileStream>(clChunkedParser, clPath), vExpected);
+      ASSERT_EQ(ParseFile<InputFileStream>(clChunkedParser, clPath), vExpected);
+   }
+
+   std::filesystem::remove(clPath);
+}
+
+TEST_F(ParserTest, CHUNK_THREADS_RANGECMP)
+{
+   const std::filesystem::path clPath = WriteFile("edie_chunk_threads_rangecmp_test.GPS", MakeRangeCmpStream(20));
+
+   FileParser clSerialParser(&clJsonDb);
+   const auto vExpected = ParseFile<InputFileStream>(clSerialParser, clPath);
+   const auto IsRange = [](const std::pair<STATUS, std::vector<unsigned char>>& stResult_) {
+      return stResult_.first == STATUS::SUCCESS && std::string(stResult_.second.begin(), stResult_.second.end()).starts_with("#RANGEA,");
+   };
+   ASSERT_EQ(std::count_if(vExpected.begin(), vExpected.end(), IsRange), 40);
+
+   // Locktimes are extended from the logs before, so the last RANGECMP2 log decompressed on its own is different
+   Parser clParser(&clJsonDb);
+   std::vector<unsigned char> vLastLog = MakeRangeCmpLog(RANGECMP2_MSG_ID, 244820000.0 + 1000.0 * 19, szRangeCmp2Data);
+   const auto vLastRange = ParseStream(clParser, vLastLog);
+   ASSERT_EQ(vLastRange.size(), 1U);
+   ASSERT_TRUE(IsRange(vLastRange[0]));
+   ASSERT_EQ(std::count(vExpected.begin(), vExpected.end(), vLastRange[0]), 0);
+
+   // Chunk boundaries fall inside the RANGECMP logs and on the TESTLOGs embedded in RXCONFIG logs
+   for (uint64_t ullChunkSize : { 509U, 997U, 1499U, 2003U })
+   {
+      FileParser clChunkedParser(&clJsonDb);
+      clChunkedParser.SetChunkThreads(3, ullChunkSize);
+      ASSERT_EQ(ParseFile<InputFileStream>(clChunkedParser, clPath), vExpected) << "Chunk size " << ullChunkSize;
+   }
+
+   std::filesystem::remove(clPath);
+}
+
+TEST_F(ParserTest, MAPPED_STREAM)
+{
+   const std::filesystem::path clPath = WriteFile("edie_mapped_stream_test.GPS", MakeStream(500));
+
+   FileParser clFileParser(&clJsonDb);
+   const auto vExpected = ParseFile<InputFileStream>(clFileParser, clPath);
+   ASSERT_GT(vExpected.size(), 500U);
+   ASSERT_EQ(ParseFile<InputMappedFileStream>(clFileParser, clPath), vExpected);
+
+   clFileParser.SetChunkThreads(2, 4096);
+   ASSERT_EQ(ParseFile<InputMappedFileStream>(clFileParser, clPath), vExpected);
+
+   std::filesystem::remove(clPath);
+}
+
+TEST_F(ParserTest, READ_OBSERVATIONS)
+{
+   // Binary RANGE logs between the TESTLOGs, with a different number of observations in each
+   std::vector<unsigned char> vStream;
+   for (uint32_t uiEpoch = 0; uiEpoch < 4; ++uiEpoch)
+   {
+      std::vector<unsigned char> vTestLogs = MakeStream(3);
+      vStream.insert(vStream.end(), vTestLogs.begin(), vTestLogs.end());
+
+      RangeStruct stRange;
+      stRange.uiNumberOfObservations = uiEpoch + 1;
+      for (uint32_t i = 0; i < stRange.uiNumberOfObservations; ++i)
+      {
+         stRange.astRangeData[i].usPRN = static_cast<uint16_t>(i + 1);
+         stRange.astRangeData[i].dPSR = 20000000.0 + 1000.0 * uiEpoch + i;
+         stRange.astRangeData[i].fCNo = 40.0f + static_cast<float>(i);
+         // GLONASS L2CA
+         stRange.astRangeData[i].uiChannelTrackingStatus = 0x00211c04;
+      }
+
+      IntermediateHeader stHeader;
+      stHeader.usMessageID = static_cast<uint16_t>(RANGE_MSG_ID);
+      stHeader.uiPortAddress = 32;
+      stHeader.uiTimeStatus = 180;
+      stHeader.usWeek = 2167;
+      stHeader.dMilliseconds = 244820000.0 + 1000.0 * uiEpoch;
+      stHeader.usLength = static_cast<uint16_t>(sizeof(uint32_t) + stRange.uiNumberOfObservations * sizeof(RangeDataStruct));
+      const OEM4BinaryHeader stBinaryHeader(stHeader);
+
+      std::vector<unsigned char> vLog(sizeof(stBinaryHeader) + stHeader.usLength + OEM4_BINARY_CRC_LENGTH);
+      memcpy(vLog.data(), &stBinaryHeader, sizeof(stBinaryHeader));
+      memcpy(vLog.data() + sizeof(stBinaryHeader), &stRange, stHeader.usLength);
+      const uint32_t uiCrc = CalculateBlockCRC32(static_cast<uint32_t>(vLog.size() - OEM4_BINARY_CRC_LENGTH), 0, vLog.data());
+      memcpy(vLog.data() + vLog.size() - OEM4_BINARY_CRC_LENGTH, &uiCrc, sizeof(uiCrc));
+      vStream.insert(vStream.end(), vLog.begin(), vLog.end());
+   }
+
+   Parser clParser(&clJsonDb);
+   ASSERT_EQ(clParser.Write(vStream.data(), static_cast<uint32_t>(vStream.size())), vStream.size());
+
+   // The same arrays are reused for every epoch
+   RangeObservations stObservations;
+   MetaDataStruct stMetaData;
+   for (uint32_t uiEpoch = 0; uiEpoch < 4; ++uiEpoch)
+   {
+      ASSERT_EQ(clParser.ReadObservations(stObservations, stMetaData), STATUS::SUCCESS);
+      ASSERT_EQ(stMetaData.usMessageID, RANGE_MSG_ID);
+      ASSERT_EQ(stObservations.Size(), uiEpoch + 1);
+      for (uint32_t i = 0; i <= uiEpoch; ++i)
+      {
+         ASSERT_EQ(stObservations.vusPRN[i], i + 1);
+         ASSERT_EQ(stObservations.vdPSR[i], 20000000.0 + 1000.0 * uiEpoch + i);
+         ASSERT_EQ(stObservations.vfCNo[i], 40.0f + static_cast<float>(i));
+         ASSERT_EQ(stObservations.veSatelliteSystem[i], ChannelTrackingStatusStruct::SATELLITE_SYSTEM::GLONASS);
+         ASSERT_EQ(stObservations.veSignalType[i], ChannelTrackingStatusStruct::SIGNAL_TYPE::GLONASS_L2CA);
+         ASSERT_EQ(stObservations.vuiChannelTrackingStatus[i], 0x00211c04U);
+      }
+   }
+   ASSERT_EQ(clParser.ReadObservations(stObservations, stMetaData), STATUS::BUFFER_EMPTY);
+}
+
+TEST_F(ParserTest, READ_OBSERVATIONS_RANGECMP)
+{
+   std::vector<unsigned char> vStream = MakeRangeCmpStream(8);
+
+   // Drop the logs of one epoch, so that the locktimes after it are extended from the epoch before
+   Filter clFilter;
+   clFilter.SetIncludeLowerTimeBound(2167, 244823.0);
+   clFilter.SetIncludeUpperTimeBound(2167, 244823.0);
+   clFilter.InvertTimeFilter(true);
+
+   // Read() decompresses the same logs to binary RANGE logs
+   Parser clRangeParser(&clJsonDb);
+   clRangeParser.SetEncodeFormat(ENCODEFORMAT::BINARY);
+   clRangeParser.SetFilter(&clFilter);
+   std::vector<std::vector<unsigned char>> vRangeLogs;
+   for (const auto& [eStatus, vLog] : ParseStream(clRangeParser, vStream))
+   {
+      OEM4BinaryHeader stHeader;
+      memcpy(&stHeader, vLog.data(), sizeof(stHeader));
+      if (eStatus == STATUS::SUCCESS && stHeader.usMsgNumber == RANGE_MSG_ID) { vRangeLogs.push_back(vLog); }
+   }
+   ASSERT_EQ(vRangeLogs.size(), 14U);
+
+   Parser clParser(&clJsonDb);
+   clParser.SetFilter(&clFilter);
+   ASSERT_EQ(clParser.Write(vStream.data(), static_cast<uint32_t>(vStream.size())), vStream.size());
+
+   RangeObservations stObservations;
+   MetaDataStruct stMetaData;
+   for (size_t i = 0; i < vRangeLogs.size(); ++i)
+   {
+      const std::vector<unsigned char>& vRangeLog = vRangeLogs[i];
+      OEM4BinaryHeader stHeader;
+      memcpy(&stHeader, vRangeLog.data(), sizeof(stHeader));
+      RangeStruct stRange;
+      memcpy(&stRange, vRangeLog.data() + sizeof(stHeader), stHeader.usLength);
+      RangeObservations stExpected;
+      stExpected.Assign(stRange.astRangeData, stRange.uiNumberOfObservations);
+
+      ASSERT_EQ(clParser.ReadObservations(stObservations, stMetaData), STATUS::SUCCESS);
+      // The meta data is that of the RANGECMP log, as it was framed
+      ASSERT_EQ(stMetaData.usMessageID, i % 2 == 0 ? RANGECMP2_MSG_ID : RANGECMP4_MSG_ID);
+      ASSERT_EQ(stMetaData.dMilliseconds, stHeader.uiWeekMSec);
+      ASSERT_GT(stObservations.Size(), 0U);
+      ASSERT_EQ(stObservations.vusPRN, stExpected.vusPRN);
+      ASSERT_EQ(stObservations.vsGLONASSFrequency, stExpected.vsGLONASSFrequency);
+      ASSERT_EQ(stObservations.veSatelliteSystem, stExpected.veSatelliteSystem);
+      ASSERT_EQ(stObservations.veSignalType, stExpected.veSignalType);
+      ASSERT_EQ(stObservations.vdPSR, stExpected.vdPSR);
+      ASSERT_EQ(stObservations.vfPSRStdDev, stExpected.vfPSRStdDev);
+      ASSERT_EQ(stObservations.vdADR, stExpected.vdADR);
+      ASSERT_EQ(stObservations.vfADRStdDev, stExpected.vfADRStdDev);
+      ASSERT_EQ(stObservations.vfDopplerFrequency, stExpected.vfDopplerFrequency);
+      ASSERT_EQ(stObservations.vfCNo, stExpected.vfCNo);
+      ASSERT_EQ(stObservations.vfLockTime, stExpected.vfLockTime);
+      ASSERT_EQ(stObservations.vuiChannelTrackingStatus, stExpected.vuiChannelTrackingStatus);
+   }
+   ASSERT_EQ(clParser.ReadObservations(stObservations, stMetaData), STATUS::BUFFER_EMPTY);
+}
+
+TEST_F(ParserTest, ZERO_COPY)
+{
+   // Binary logs, including RANGECMP logs to decompress, then the TESTLOGs again in ASCII and abbreviated ASCII
+   std::vector<unsigned char> vStream = MakeRangeCmpStream(10);
+   std::vector<unsigned char> vTestLogs = MakeStream(200);
+   for (ENCODEFORMAT eFormat : { ENCODEFORMAT::ASCII, ENCODEFORMAT::ABBREV_ASCII })
+   {
+      Parser clEncodingParser(&clJsonDb);
+      clEncodingParser.SetEncodeFormat(eFormat);
+      for (const auto& [eStatus, vLog] : ParseStream(clEncodingParser, vTestLogs))
+      {
+         if (eStatus == STATUS::SUCCESS) { vStream.insert(vStream.end(), vLog.begin(), vLog.end()); }
+      }
+   }
+   std::vector<unsigned char> vRangeCmpLogs = MakeRangeCmpStream(10);
+   vStream.insert(vStream.end(), vRangeCmpLogs.begin(), vRangeCmpLogs.end());
+
+   for (ENCODEFORMAT eFormat : { ENCODEFORMAT::ASCII, ENCODEFORMAT::ABBREV_ASCII, ENCODEFORMAT::BINARY })
+   {
+      Parser clCopyParser(&clJsonDb);
+      clCopyParser.SetEncodeFormat(eFormat);
+      clCopyParser.SetPassthrough(true);
+      const auto vExpected = ParseStream(clCopyParser, vStream);
+      ASSERT_GT(vExpected.size(), 400U);
+
+      Parser clZeroCopyParser(&clJsonDb);
+      clZeroCopyParser.SetEncodeFormat(eFormat);
+      clZeroCopyParser.SetZeroCopy(true);
+      ASSERT_TRUE(clZeroCopyParser.GetZeroCopy());
+
+      // The stream is many times the size of the Framer's buffer, and writes of an odd size leave frames straddling
+      // the point where it wraps
+      std::vector<std::pair<STATUS, std::vector<unsigned char>>> vResults;
+      MessageDataStruct stMessageData;
+      MetaDataStruct stMetaData;
+      for (size_t ullOffset = 0; ullOffset < vStream.size();)
+      {
+         ullOffset += clZeroCopyParser.Write(vStream.data() + ullOffset, static_cast<uint32_t>(std::min<size_t>(vStream.size() - ullOffset, 997)));
+
+         const unsigned char* pucLast = nullptr;
+         while (true)
+         {
+            // The message returned last is left untouched until the next Read()
+            if (pucLast != nullptr) { ASSERT_EQ(std::vector<unsigned char>(pucLast, pucLast + vResults.back().second.size()), vResults.back().second); }
+
+            const STATUS eStatus = clZeroCopyParser.Read(stMessageData, stMetaData);
+            if (eStatus == STATUS::BUFFER_EMPTY) { break; }
+
+            pucLast = eStatus == STATUS::UNKNOWN ? stMessageData.pucMessageHeader : stMessageData.pucMessage;
+            const uint32_t uiLength = eStatus == STATUS::UNKNOWN ? stMessageData.uiMessageHeaderLength : stMessageData.uiMessageLength;
+            vResults.emplace_back(eStatus, std::vector<unsigned char>(pucLast, pucLast + uiLength));
+         }
+      }
+      ASSERT_EQ(vResults, vExpected);
+   }
+}
+
 // -------------------------------------------------------------------------------------------------------
 // Novatel Types Unit Tests
 // -------------------------------------------------------------------------------------------------------
@@ -2914,12 +3670,12 @@ protected:
    public:
       DecoderTester(JsonReader* pclJsonDb_) : MessageDecoder(pclJsonDb_) {}
 
-      STATUS TestDecodeAscii(const std::vector<BaseField*> MsgDefFields_, const char** ppcLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_)
+      STATUS TestDecodeAscii(const std::vector<BaseField*>& MsgDefFields_, const char** ppcLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_)
       {
          return DecodeAscii<false>(MsgDefFields_, const_cast<char**>(ppcLogBuf_), vIntermediateFormat_);
       }
 
-      STATUS TestDecodeBinary(const std::vector<BaseField*> MsgDefFields_, unsigned char** ppucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_)
+      STATUS TestDecodeBinary(const std::vector<BaseField*>& MsgDefFields_, unsigned char** ppucLogBuf_, std::vector<FieldContainer>& vIntermediateFormat_)
       {
          uint16_t MsgDefFieldsSize = 0;
          for (BaseField* field : MsgDefFields_) { MsgDefFieldsSize += field->dataType.length; }
@@ -44,25 +44,51 @@ class RangeCmpTest : public ::testing::Test
       public:
         RangeDecompressorTester(JsonReader* pclJsonDb_) : RangeDecompressor(pclJsonDb_) {}
 
-        // Access protected member of RangeDecompressor
-        void SetBitoffset(uint32_t uiBitOffset_) { uiMyBitOffset = uiBitOffset_; }
+        // The next GetBitfield() starts reading at this bit
+        void SetBitoffset(uint32_t uiBitOffset_)
+        {
+            uiMyBitOffset = uiBitOffset_;
+            bMyResetReader = true;
+        }
+
+        // The next GetBitfield() reads a buffer this long
+        void SetBytesRemaining(uint32_t uiByteCount_)
+        {
+            uiMyBytesRemaining = uiByteCount_;
+            bMyResetReader = true;
+        }
 
-        // Access protected member of RangeDecompressor
-        void SetBytesRemaining(uint32_t uiByteCount_) { uiMyBytesRemaining = uiByteCount_; }
+        uint32_t GetBytesRemaining() { return clMyBitfieldReader.GetBytesRemaining(); }
 
-        // Access protected member of RangeDecompressor
-        uint32_t GetBytesRemaining() { return uiMyBytesRemaining; }
+        // Read a bitfield the way RangeCmp4ToRange() does, returning 0 if it isn't in the buffer.
+        uint64_t GetBitfield(uint8_t** ppucBytes_, uint32_t uiBitfieldSize_)
+        {
+            if (bMyResetReader)
+            {
+                clMyBitfieldReader.Reset(*ppucBytes_, uiMyBytesRemaining, uiMyBitOffset);
+                bMyResetReader = false;
+            }
 
-        // Access protected member of RangeDecompressor
-        uint64_t GetBitfield(uint8_t** ppucBytes_, uint32_t uiBitfieldSize_) { return GetBitfieldFromBuffer(ppucBytes_, uiBitfieldSize_); }
+            if (uiBitfieldSize_ > BitfieldReader::uiMAX_BITFIELD_BITS || !clMyBitfieldReader.HasBits(uiBitfieldSize_)) { return 0; }
+
+            const uint64_t ullBitfield = clMyBitfieldReader.Read(uiBitfieldSize_);
+            *ppucBytes_ = const_cast<uint8_t*>(clMyBitfieldReader.GetCurrentByte());
+            return ullBitfield;
+        }
 
         void ResetLocktimes()
         {
-            ammmMyRangeCmp2Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::PRIMARY)].clear();
-            ammmMyRangeCmp2Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::SECONDARY)].clear();
-            ammmMyRangeCmp4Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::PRIMARY)].clear();
-            ammmMyRangeCmp4Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::SECONDARY)].clear();
+            aclMyRangeCmp2Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::PRIMARY)].Clear();
+            aclMyRangeCmp2Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::SECONDARY)].Clear();
+            aclMyRangeCmp4Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::PRIMARY)].Clear();
+            aclMyRangeCmp4Locktimes[static_cast<uint32_t>(MEASUREMENT_SOURCE::SECONDARY)].Clear();
         }
+
+      private:
+        BitfieldReader clMyBitfieldReader;
+        uint32_t uiMyBitOffset{0U};
+        uint32_t uiMyBytesRemaining{0U};
+        bool bMyResetReader{true};
     };
 
   protected:
@@ -230,6 +256,149 @@ TEST_F(RangeCmpTest, BITFIELD_4)
    ASSERT_EQ(0U, pclMyRangeDecompressor->GetBytesRemaining());
 }
 
+TEST_F(RangeCmpTest, BITFIELD_5)
+{
+   // Read fields of the widths found in RANGECMP4 messages across many refills of the bit buffer,
+   // checking each one against the bits picked out of the buffer one at a time.
+   uint8_t aucBytes[45];
+   for (uint32_t i = 0; i < sizeof(aucBytes); i++) { aucBytes[i] = static_cast<uint8_t>(i * 0x9D + 0x3B); }
+   uint8_t* pucBytesPointer = &aucBytes[0]; // GetBitfield() will advance this pointer.
+
+   const uint32_t auiBitfieldSizes[] = {1, 3, 11, 37, 23, 26, 64, 5, 19, 16, 18, 4, 64, 64};
+   uint32_t uiBitPosition = 0;
+
+   pclMyRangeDecompressor->SetBitoffset(0);
+   pclMyRangeDecompressor->SetBytesRemaining(sizeof(aucBytes));
+   for (uint32_t uiBitfieldSize : auiBitfieldSizes)
+   {
+      uint64_t ullExpected = 0;
+      for (uint32_t i = 0; i < uiBitfieldSize; i++, uiBitPosition++)
+      {
+         if (aucBytes[uiBitPosition / 8] & (1U << (uiBitPosition % 8))) { ullExpected |= 1ULL << i; }
+      }
+      ASSERT_EQ(ullExpected, pclMyRangeDecompressor->GetBitfield(&pucBytesPointer, uiBitfieldSize));
+      ASSERT_EQ(&aucBytes[uiBitPosition / 8], pucBytesPointer);
+   }
+
+   // 355 of the 360 bits have been read, so there isn't room for a 6-bit field.
+   ASSERT_EQ(1U, pclMyRangeDecompressor->GetBytesRemaining());
+   ASSERT_EQ(0x0, pclMyRangeDecompressor->GetBitfield(&pucBytesPointer, 6));
+   ASSERT_EQ(static_cast<uint64_t>(aucBytes[44] >> 3), pclMyRangeDecompressor->GetBitfield(&pucBytesPointer, 5));
+   ASSERT_EQ(0U, pclMyRangeDecompressor->GetBytesRemaining());
+}
+
+TEST_F(RangeCmpTest, OBSERVATION_STATE_TABLE)
+{
+   using SATELLITE_SYSTEM = ChannelTrackingStatusStruct::SATELLITE_SYSTEM;
+   using SIGNAL_TYPE = ChannelTrackingStatusStruct::SIGNAL_TYPE;
+   ObservationStateTable<SATELLITE_SYSTEM, SIGNAL_TYPE, RangeCmp4LocktimeInfoStruct> clTable;
+
+   // PRN 200 is beyond the indexed PRNs, so it is stored in the overflow map.
+   for (uint32_t uiPRN : {1U, 64U, 200U})
+   {
+      ASSERT_EQ(nullptr, clTable.Find(SATELLITE_SYSTEM::GPS, SIGNAL_TYPE::GPS_L1CA, uiPRN));
+      clTable.Get(SATELLITE_SYSTEM::GPS, SIGNAL_TYPE::GPS_L1CA, uiPRN).ucLocktimeBits = static_cast<uint8_t>(uiPRN);
+   }
+   for (uint32_t uiPRN : {1U, 64U, 200U})
+   {
+      const RangeCmp4LocktimeInfoStruct* pstState = clTable.Find(SATELLITE_SYSTEM::GPS, SIGNAL_TYPE::GPS_L1CA, uiPRN);
+      ASSERT_NE(nullptr, pstState);
+      ASSERT_EQ(uiPRN, pstState->ucLocktimeBits);
+   }
+   ASSERT_EQ(nullptr, clTable.Find(SATELLITE_SYSTEM::GPS, SIGNAL_TYPE::GPS_L2P, 1));
+   ASSERT_EQ(nullptr, clTable.Find(SATELLITE_SYSTEM::GLONASS, SIGNAL_TYPE::GPS_L1CA, 1));
+
+   // Cleared state reads as empty, and is default-constructed when it is stored again.
+   clTable.Clear();
+   for (uint32_t uiPRN : {1U, 64U, 200U})
+   {
+      ASSERT_EQ(nullptr, clTable.Find(SATELLITE_SYSTEM::GPS, SIGNAL_TYPE::GPS_L1CA, uiPRN));
+      ASSERT_EQ(UINT8_MAX, clTable.Get(SATELLITE_SYSTEM::GPS, SIGNAL_TYPE::GPS_L1CA, uiPRN).ucLocktimeBits);
+   }
+}
+
+TEST_F(RangeCmpTest, RANGE_ENCODER)
+{
+   RangeStruct stRange;
+   stRange.uiNumberOfObservations = 3;
+   for (uint32_t i = 0; i < stRange.uiNumberOfObservations; i++)
+   {
+      RangeDataStruct& stData = stRange.astRangeData[i];
+      stData.usPRN = static_cast<uint16_t>(i * 20 + 3);
+      stData.sGLONASSFrequency = static_cast<int16_t>(i) - 1;
+      stData.dPSR = 21540290.811 + i * 1234.5678;
+      stData.fPSRStdDev = 0.030f * static_cast<float>(i + 1);
+      stData.dADR = -113194996.162716 * (i % 2 == 0 ? 1 : -1);
+      stData.fADRStdDev = 0.005f;
+      stData.fDopplerFrequency = 2288.688f - static_cast<float>(i) * 3000.0f;
+      stData.fCNo = 52.6f;
+      stData.fLockTime = 262.144f;
+      stData.uiChannelTrackingStatus = 0x08101c04 + i;
+   }
+
+   IntermediateHeader stHeader;
+   stHeader.usMessageID = static_cast<uint16_t>(RANGE_MSG_ID);
+   stHeader.usWeek = 1919;
+   stHeader.dMilliseconds = 507977000.0;
+
+   RangeEncoder clRangeEncoder(pclMyJsonDb.get());
+   Encoder clEncoder(pclMyJsonDb.get());
+   MessageDecoder clMessageDecoder(pclMyJsonDb.get());
+
+   // Encoding straight from the RangeStruct matches decoding the binary RANGE message and encoding it.
+   for (ENCODEFORMAT eFormat : {ENCODEFORMAT::ASCII, ENCODEFORMAT::BINARY, ENCODEFORMAT::FLATTENED_BINARY, ENCODEFORMAT::JSON})
+   {
+      unsigned char aucRangeBuffer[MAX_ASCII_MESSAGE_LENGTH];
+      unsigned char* pucRangeBuffer = aucRangeBuffer;
+      MessageDataStruct stRangeMessageData;
+      MetaDataStruct stRangeMetaData;
+      stRangeMetaData.eFormat = HEADERFORMAT::BINARY;
+      ASSERT_EQ(STATUS::SUCCESS, clRangeEncoder.Encode(&pucRangeBuffer, sizeof(aucRangeBuffer), stHeader, stRange, stRangeMessageData, stRangeMetaData, eFormat));
+
+      unsigned char aucBinaryBody[sizeof(RangeStruct)];
+      memcpy(aucBinaryBody, &stRange, sizeof(aucBinaryBody));
+      IntermediateMessage stMessage;
+      MetaDataStruct stMetaData;
+      stMetaData.eFormat = HEADERFORMAT::BINARY;
+      stMetaData.usMessageID = static_cast<uint16_t>(RANGE_MSG_ID);
+      stMetaData.uiBinaryMsgLength = sizeof(uint32_t) + stRange.uiNumberOfObservations * sizeof(RangeDataStruct);
+      ASSERT_EQ(STATUS::SUCCESS, clMessageDecoder.Decode(aucBinaryBody, stMessage, stMetaData));
+
+      unsigned char aucBuffer[MAX_ASCII_MESSAGE_LENGTH];
+      unsigned char* pucBuffer = aucBuffer;
+      MessageDataStruct stMessageData;
+      ASSERT_EQ(STATUS::SUCCESS, clEncoder.Encode(&pucBuffer, sizeof(aucBuffer), stHeader, stMessage, stMessageData, stMetaData, eFormat));
+
+      ASSERT_EQ(stMessageData.uiMessageLength, stRangeMessageData.uiMessageLength);
+      ASSERT_EQ(stMessageData.uiMessageHeaderLength, stRangeMessageData.uiMessageHeaderLength);
+      ASSERT_EQ(stMessageData.uiMessageBodyLength, stRangeMessageData.uiMessageBodyLength);
+      ASSERT_EQ(0, memcmp(aucBuffer, aucRangeBuffer, stMessageData.uiMessageLength));
+   }
+
+   // Abbreviated ASCII is left to the Encoder.
+   unsigned char aucRangeBuffer[MAX_ASCII_MESSAGE_LENGTH];
+   unsigned char* pucRangeBuffer = aucRangeBuffer;
+   MessageDataStruct stRangeMessageData;
+   MetaDataStruct stRangeMetaData;
+   ASSERT_EQ(STATUS::UNSUPPORTED, clRangeEncoder.Encode(&pucRangeBuffer, sizeof(aucRangeBuffer), stHeader, stRange, stRangeMessageData, stRangeMetaData, ENCODEFORMAT::ABBREV_ASCII));
+
+   // The RANGE definition is resolved again for each database loaded.
+   JsonReader clEmptyJsonDb;
+   RangeEncoder clReloadedEncoder(&clEmptyJsonDb);
+   ASSERT_EQ(STATUS::UNSUPPORTED, clReloadedEncoder.Encode(&pucRangeBuffer, sizeof(aucRangeBuffer), stHeader, stRange, stRangeMessageData, stRangeMetaData, ENCODEFORMAT::BINARY));
+   clReloadedEncoder.LoadJsonDb(pclMyJsonDb.get());
+   ASSERT_EQ(STATUS::SUCCESS, clReloadedEncoder.Encode(&pucRangeBuffer, sizeof(aucRangeBuffer), stHeader, stRange, stRangeMessageData, stRangeMetaData, ENCODEFORMAT::BINARY));
+   clReloadedEncoder.LoadJsonDb(&clEmptyJsonDb);
+   ASSERT_EQ(STATUS::UNSUPPORTED, clReloadedEncoder.Encode(&pucRangeBuffer, sizeof(aucRangeBuffer), stHeader, stRange, stRangeMessageData, stRangeMetaData, ENCODEFORMAT::BINARY));
+
+   // And again when the database it was resolved from changes.
+   JsonReader clChangedJsonDb(*pclMyJsonDb);
+   RangeEncoder clChangedEncoder(&clChangedJsonDb);
+   ASSERT_EQ(STATUS::SUCCESS, clChangedEncoder.Encode(&pucRangeBuffer, sizeof(aucRangeBuffer), stHeader, stRange, stRangeMessageData, stRangeMetaData, ENCODEFORMAT::BINARY));
+   clChangedJsonDb.RemoveMessage(RANGE_MSG_ID);
+   ASSERT_EQ(STATUS::UNSUPPORTED, clChangedEncoder.Encode(&pucRangeBuffer, sizeof(aucRangeBuffer), stHeader, stRange, stRangeMessageData, stRangeMetaData, ENCODEFORMAT::BINARY));
+}
+
 // -------------------------------------------------------------------------------------------------------
 // RANGECMP decompression unit tests
 // -------------------------------------------------------------------------------------------------------
@@ -384,6 +553,97 @@ TEST_F(RangeCmpTest, DECOMPRESS_RANGECMPA4_2)
    ASSERT_EQ(0, memcmp(aucCompressionBuffer, aucDecompressedData, stMetaData.uiLength));
 }
 
+TEST_F(RangeCmpTest, DECOMPRESS_OBSERVATIONS_RANGECMPA4)
+{
+   char aucCompressedData[] = "#RANGECMP4A,COM1,0,88.5,FINESTEERING,1919,507977.000,02000020,fb0e,32768;295,030000421204000000009200df7688831f611fd87ca0b03a00638bbdf7b82f49b080fd0ec0ff1f091f8214ff4d4d00a1009cbf1751f6911f5141f87fd9571a96dbd7040c8090f87f0080fcf722fe9bfa8a49a8ff4f299d7f96fb9afefc771800fcffd0063f02cde01f3c7dd3ffb75240886f5fa2b0ff91f57f00003edf8b78868c882878014065dbf7d3ed6b722680d5fc0f00a4c08730fe7fecf8bffa3f003008000000002001f03fa019f8136a11273649b8fcefab9c434c7b89e71560dbfe070030b2e04fd841f33125320b80b0ecefa5ee21243ac0bb03e0ffc36a813fb13bbe5791a0f5ff9e3bdbffbb87f0cb8064f03f0000e4b67dd15bc5f4a50a3a006ca72fdee53ec86405b2c0fffa3fa450f725d5bfed7c49b1fb0fb16b45a87a9adb0740cbfe0700*7dd8f893\r\n";
+   char aucDecompressedData[] = "#RANGEA,COM1,0,88.5,FINESTEERING,1919,507977.000,02000020,fb0e,32768;22,10,0,21540290.811,0.030,-113194996.162716,0.005,2288.688,52.6,262.144,08101c04,10,0,21540293.632,0.148,-88203904.730026,0.007,1783.394,45.5,262.144,01301c0b,10,0,21540289.869,0.020,-84528728.138867,0.005,1709.022,53.0,262.144,01d01c0b,15,0,21776375.653,0.045,-114435625.391362,0.007,-1814.485,50.9,262.144,18101c04,15,0,21776376.038,0.148,-89170616.456737,0.009,-1413.886,44.1,262.144,11301c0b,18,0,20493192.703,0.045,-107692454.149616,0.007,212.747,51.1,262.144,08101c04,18,0,20493191.934,0.148,-83916195.495361,0.009,165.777,45.9,262.144,01301c0b,21,0,21214757.684,0.030,-111484302.589394,0.005,-1107.624,52.5,262.144,08101c04,21,0,21214757.049,0.148,-86870882.607262,0.007,-863.084,44.6,262.144,01301c0b,27,0,21761200.335,0.045,-114355879.994277,0.007,1121.758,50.0,262.144,18101c04,27,0,21761202.795,0.148,-89108485.029933,0.009,874.097,44.2,262.144,11301c0b,27,0,21761200.306,0.020,-85395622.840012,0.005,837.685,51.7,262.144,01d01c0b,38,8,19781617.845,0.066,-105744080.697075,0.005,-2024.611,51.8,262.144,18111c04,38,8,19781623.453,0.045,-82245418.311729,0.005,-1574.698,42.2,262.144,00b11c0b,39,3,19968976.955,0.066,-106558290.404817,0.005,2248.713,52.3,262.144,08111c04,39,3,19968980.676,0.020,-82878686.552770,0.005,1749.000,46.9,262.144,00b11c0b,54,11,19507573.214,0.066,-104388964.030286,0.005,1289.410,51.8,262.144,08111c04,54,11,19507576.477,0.020,-81191427.275585,0.005,1002.874,48.0,262.144,10b11c0b,55,4,22748433.080,0.148,-121432681.637759,0.012,4061.119,43.9,262.144,18111c04,55,4,22748438.602,0.030,-94447660.069150,0.012,3158.651,46.0,262.144,00b11c0b,61,9,20375330.795,0.148,-108956045.737668,0.007,-3039.482,46.8,262.144,08111c04,61,9,20375332.806,0.099,-84743599.055346,0.009,-2364.042,34.0,262.144,00b11c0b*d2ac2e1f\r\n";
+
+   char aucCompressionBuffer[MAX_ASCII_MESSAGE_LENGTH];
+   memcpy(aucCompressionBuffer, aucCompressedData, sizeof(aucCompressedData)-1);
+
+   MetaDataStruct stMetaData;
+   stMetaData.usMessageID = static_cast<uint16_t>(RANGECMP4_MSG_ID);
+   stMetaData.uiLength = sizeof(aucCompressedData)-1;
+
+   RangeObservations stObservations;
+   ASSERT_EQ(STATUS::SUCCESS, pclMyRangeDecompressor->DecompressObservations(reinterpret_cast<unsigned char*>(aucCompressionBuffer), sizeof(aucCompressionBuffer), stMetaData, stObservations));
+   ASSERT_EQ(static_cast<uint16_t>(RANGECMP4_MSG_ID), stMetaData.usMessageID);
+   ASSERT_EQ(22U, stObservations.Size());
+
+   ASSERT_EQ(10, stObservations.vusPRN[0]);
+   ASSERT_EQ(ChannelTrackingStatusStruct::SATELLITE_SYSTEM::GPS, stObservations.veSatelliteSystem[0]);
+   ASSERT_EQ(ChannelTrackingStatusStruct::SIGNAL_TYPE::GPS_L1CA, stObservations.veSignalType[0]);
+   ASSERT_EQ(ChannelTrackingStatusStruct::SIGNAL_TYPE::GPS_L2Y, stObservations.veSignalType[1]);
+   ASSERT_EQ(38, stObservations.vusPRN[12]);
+   ASSERT_EQ(8, stObservations.vsGLONASSFrequency[12]);
+   ASSERT_EQ(ChannelTrackingStatusStruct::SATELLITE_SYSTEM::GLONASS, stObservations.veSatelliteSystem[12]);
+
+   // The observations match those of the decompressed RANGE message, to the precision it is printed with
+   memcpy(aucCompressionBuffer, aucDecompressedData, sizeof(aucDecompressedData)-1);
+   MetaDataStruct stRangeMetaData;
+   stRangeMetaData.usMessageID = static_cast<uint16_t>(RANGE_MSG_ID);
+   stRangeMetaData.uiLength = sizeof(aucDecompressedData)-1;
+
+   RangeObservations stRangeObservations;
+   ASSERT_EQ(STATUS::SUCCESS, pclMyRangeDecompressor->DecompressObservations(reinterpret_cast<unsigned char*>(aucCompressionBuffer), sizeof(aucCompressionBuffer), stRangeMetaData, stRangeObservations));
+   ASSERT_EQ(stObservations.Size(), stRangeObservations.Size());
+   for (size_t i = 0; i < stObservations.Size(); i++)
+   {
+      ASSERT_EQ(stRangeObservations.vusPRN[i], stObservations.vusPRN[i]);
+      ASSERT_EQ(stRangeObservations.vsGLONASSFrequency[i], stObservations.vsGLONASSFrequency[i]);
+      ASSERT_EQ(stRangeObservations.vuiChannelTrackingStatus[i], stObservations.vuiChannelTrackingStatus[i]);
+      ASSERT_NEAR(stRangeObservations.vdPSR[i], stObservations.vdPSR[i], 0.001);
+      ASSERT_NEAR(stRangeObservations.vfPSRStdDev[i], stObservations.vfPSRStdDev[i], 0.001);
+      ASSERT_NEAR(stRangeObservations.vdADR[i], stObservations.vdADR[i], 0.000001);
+      ASSERT_NEAR(stRangeObservations.vfADRStdDev[i], stObservations.vfADRStdDev[i], 0.001);
+      ASSERT_NEAR(stRangeObservations.vfDopplerFrequency[i], stObservations.vfDopplerFrequency[i], 0.001);
+      ASSERT_NEAR(stRangeObservations.vfCNo[i], stObservations.vfCNo[i], 0.1);
+      ASSERT_NEAR(stRangeObservations.vfLockTime[i], stObservations.vfLockTime[i], 0.001);
+   }
+
+   // RANGE messages are only taken by DecompressObservations().
+   memcpy(aucCompressionBuffer, aucDecompressedData, sizeof(aucDecompressedData)-1);
+   ASSERT_EQ(STATUS::UNSUPPORTED, pclMyRangeDecompressor->Decompress(reinterpret_cast<unsigned char*>(aucCompressionBuffer), sizeof(aucCompressionBuffer), stRangeMetaData));
+}
+
+TEST_F(RangeCmpTest, DECOMPRESS_RANGECMP4_TRUNCATED)
+{
+   // The compressed data of DECOMPRESS_RANGECMPA4_2
+   const std::string strData("030000421204000000009200df7688831f611fd87ca0b03a00638bbdf7b82f49b080fd0ec0ff1f091f8214ff4d4d00a1009cbf1751f6911f5141f87fd9571a96dbd7040c8090f87f0080fcf722fe9bfa8a49a8ff4f299d7f96fb9afefc771800fcffd0063f02cde01f3c7dd3ffb75240886f5fa2b0ff91f57f00003edf8b78868c882878014065dbf7d3ed6b722680d5fc0f00a4c08730fe7fecf8bffa3f003008000000002001f03fa019f8136a11273649b8fcefab9c434c7b89e71560dbfe070030b2e04fd841f33125320b80b0ecefa5ee21243ac0bb03e0ffc36a813fb13bbe5791a0f5ff9e3bdbffbb87f0cb8064f03f0000e4b67dd15bc5f4a50a3a006ca72fdee53ec86405b2c0fffa3fa450f725d5bfed7c49b1fb0fb16b45a87a9adb0740cbfe0700");
+   std::vector<unsigned char> vCompressedData;
+   for (size_t i = 0; i < strData.size(); i += 2) { vCompressedData.push_back(static_cast<unsigned char>(std::stoul(strData.substr(i, 2), nullptr, 16))); }
+   const auto uiCompressedDataLength = static_cast<uint32_t>(vCompressedData.size());
+
+   // Decompress a binary RANGECMP4 message whose body only has room for the first uiBodyBytes_ of the compressed data. Its
+   // length field still claims all of it, and the rest follows the body in the buffer, where it must not be read.
+   auto Decompress = [&](uint32_t uiBodyBytes_)
+   {
+      IntermediateHeader stHeader;
+      stHeader.usMessageID = static_cast<uint16_t>(RANGECMP4_MSG_ID);
+      stHeader.uiPortAddress = 32;
+      stHeader.uiTimeStatus = 180;
+      stHeader.usWeek = 1919;
+      stHeader.dMilliseconds = 507977000.0;
+      stHeader.usLength = static_cast<uint16_t>(sizeof(uint32_t) + uiBodyBytes_);
+      const OEM4BinaryHeader stBinaryHeader(stHeader);
+
+      std::vector<unsigned char> vBuffer(MAX_ASCII_MESSAGE_LENGTH);
+      memcpy(vBuffer.data(), &stBinaryHeader, sizeof(stBinaryHeader));
+      memcpy(vBuffer.data() + sizeof(stBinaryHeader), &uiCompressedDataLength, sizeof(uiCompressedDataLength));
+      memcpy(vBuffer.data() + sizeof(stBinaryHeader) + sizeof(uiCompressedDataLength), vCompressedData.data(), vCompressedData.size());
+
+      MetaDataStruct stMetaData;
+      pclMyRangeDecompressor->ResetLocktimes();
+      return pclMyRangeDecompressor->Decompress(vBuffer.data(), static_cast<uint32_t>(vBuffer.size()), stMetaData, ENCODEFORMAT::BINARY);
+   };
+
+   ASSERT_EQ(STATUS::SUCCESS, Decompress(uiCompressedDataLength));
+   ASSERT_EQ(STATUS::DECOMPRESSION_FAILURE, Decompress(0));
+   ASSERT_EQ(STATUS::DECOMPRESSION_FAILURE, Decompress(1));
+   ASSERT_EQ(STATUS::DECOMPRESSION_FAILURE, Decompress(uiCompressedDataLength / 2));
+   ASSERT_EQ(STATUS::DECOMPRESSION_FAILURE, Decompress(uiCompressedDataLength - 8));
+}
+
 TEST_F(RangeCmpTest, DISABLED_DECOMPRESS_RANGECMPA4_3)
 {
    char aucCompressedData[] = "#RANGECMP4A,COM1,0,49.0,FINESTEERING,2241,408982.000,02000020,fb0e,32768;848,e3002d812042000000001200ffffc3987b2310571bd85514de1f675e63c6fdd08d0f2c31f2130098873fc368808c99b23cfcd48d1d9cc28fa1ef00c546ff0000a5ef8bb42dd8b813cdd07f43c7f8b4f7427712f0f5ee1f0020cdbd55a2df32c32a0efb5b118d5fe57e8a3404084cfe010074b937ea962d2559263c0064c0d01bdc0fb59780e4e61f008063f7352b932bf14a0a11c06242f94e7ba2bd0ce85806dcfff0e6de8646c87d59013ffba1249d386d4f749d0198c8fd04009edf93c42aab2c28539f80837cf4afef45865460cb2bf0ffc3eefb9a749ffb2225fef0fff6a862f0bdcc9802881dfa0f00f0416000000000000980fe6e187bebcf0841d5bdd4f2f1ff118d0c60fdef4566eb800112d7d31f1b6f8290f7205113103af31700a07dbe1fb1f65a734cd2827f62aed91fdc8318198043c15f0080b2065f02089f54229d2604aa9addbf7f0fa2a801de8f810100405dfba2c2c902f5240e17a8a4871cccb97b12bf3742104545fc8f6916e3d53d8cdb0b7063fd0f00508ded8b90ce40981589c33f5e220b4869ee491c1b4b3a9548f27f13a58014f730621f90e8f21f00101c2848000000001400feff21c9bd51a291a81f4b73011491de9efe3e446f0238e2fde33e24bb2f5a8d415662a277ff6d9815a2df473c53402ebb7ffc87f6f6669cb3245b6cf6efcf491540a27b295efd9f37fa6b00d0d6de28a9c67a8ec5e9fa1f6291487a2f11dc00d6e57d8b1fb2ded700458d80adadc2ff9567fce5ef23080e806ce94ffc43d4fb9a66ec37fff57412808188bd0e7ec4cf07ac5e076e0088814f42cbc30cba00e700da6ffb07c38748c5806c6c400d0059ee8d8459d4075ac4af3fc1938878f7222327e0d3df4ffe01105800304000001410d6b62d1cb3a74a353ae961a9877f0ccc1466de9310e37f37d6ffc08762f820e4b4862e8ac6ed5f8f96401f7c881a005030f93ffe30f83ee4b985656131a6fa71b3a2d87d0f91a5ffd2af7d0b0042e08740d11b57ac8a983f3490ed9fef410ee2bf83d24ff8c3e5fb103c9b60b545f00c188619bdea3d883213586605220008752fc324b1ffb434b2fe46294784bd07c1d481bf6affc30fb5f0412c681f7494721160c5ecfc47f81050ce8fdc07d0fb090000000000000014008626f736daf8d7471410e4cf154f40a67b9be708e056f60300*ba486c85\r\n";
@@ -84,4 +84,24 @@ struct StreamReadStatus
     constexpr StreamReadStatus() = default;
 };
 
+/*! A Structure
+ *
+ *  Controls when data written to an output file is handed to the operating system.
+ */
+struct FileFlushPolicy
+{
+    bool bDurable{true};           /*!< Flush after every write, so nothing written is lost if the process dies */
+    uint32_t uiBufferSize{65536};  /*!< Bytes held back before they are written to the file, when not durable */
+    uint32_t uiFlushIntervalMs{0}; /*!< Also flush on a write this long after the last flush, 0 to disable */
+
+    /*! Default Intializer */
+    constexpr FileFlushPolicy() = default;
+
+    /*! Intializer for a buffered policy */
+    constexpr FileFlushPolicy(uint32_t uiBufferSize_, uint32_t uiFlushIntervalMs_ = 0)
+        : bDurable(false), uiBufferSize(uiBufferSize_), uiFlushIntervalMs(uiFlushIntervalMs_)
+    {
+    }
+};
+
 #endif
@@ -38,11 +38,13 @@
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
+#include <chrono>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 #include "common.hpp"
 
@@ -69,6 +71,17 @@ class FileStream
      */
     std::fstream MyStream;
 
+    FileFlushPolicy stMyFlushPolicy;                                                       /**< When written data is flushed */
+    std::vector<char> vMyWriteBuffer;                                                      /**< Data held back by a buffered policy */
+    std::chrono::steady_clock::time_point tpMyLastFlush{std::chrono::steady_clock::now()}; /**< Time of the last flush */
+
+    /*! \fn void WriteBuffer()
+     *  \brief Hand the data held back by a buffered policy to the fstream.
+     *
+     *  \remark If write fails, then exception"... file  write failed" will thrown.
+     */
+    void WriteBuffer();
+
     /*! Private Copy Constructor
      *
      *  A copy constructor is a member function which initializes an object using another object of
@@ -194,6 +207,7 @@ class FileStream
      *
      *  \return Number of bytes written into the file
      *  \remark If write fails, then exception"... file  write failed" will thrown.
+     *  The data is flushed as the FileFlushPolicy given to SetFlushPolicy() says.
      */
     uint32_t WriteFile(char* cData, uint32_t uiSize);
 
@@ -209,10 +223,25 @@ class FileStream
      *  \brief  clears the internal buffer of the file.
      *
      *  \return
-     *  \remark
+     *  \remark Data held back by a buffered FileFlushPolicy is written first.
      */
     void FlushFile();
 
+    /*! \fn void SetFlushPolicy(const FileFlushPolicy&)
+     *  \brief Set when written data is flushed. Data held back by the previous
+     *  policy is flushed first.
+     *
+     *  \param [in] stFlushPolicy_ The policy for future writes.
+     */
+    void SetFlushPolicy(const FileFlushPolicy& stFlushPolicy_);
+
+    /*! \fn const FileFlushPolicy& GetFlushPolicy()
+     *  \brief Returns when written data is flushed.
+     *
+     *  \return The current FileFlushPolicy.
+     */
+    const FileFlushPolicy& GetFlushPolicy() const { return stMyFlushPolicy; };
+
     /*! \fn void SetFilePosition(std::streamoff = 0, std::ios_base::seekdir = std::ios::beg)
      *  \brief Set File Position from which next read will be done.
      *
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/*! \file inputmappedfilestream.hpp
+ *  \brief It is a Derived class from main InputStream. Input to the decoder is a memory-mapped file.
+ *
+ */
+
+//-----------------------------------------------------------------------
+// Recursive Inclusion
+//-----------------------------------------------------------------------
+#ifndef INPUTMAPPEDFILESTREAM_HPP
+#define INPUTMAPPEDFILESTREAM_HPP
+
+//-----------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------
+#include <filesystem>
+
+#include "inputstreaminterface.hpp"
+
+/*! \class InputMappedFileStream
+ *   \brief A Derived class will be used by decoder, if the decoded input is a file
+ *   that should be read through a memory mapping rather than a std::fstream.
+ *
+ *  Derived from base class InputStreamInterface. The whole file is mapped read-only
+ *  and the kernel is advised that it will be read sequentially, so ReadDataInPlace()
+ *  can hand out bytes without copying them. Also supports File names with Wide characters.
+ */
+class InputMappedFileStream : public InputStreamInterface
+{
+  public:
+    /*! A Constructor
+     *  \brief  Maps the file with the wide character filename string.
+     *
+     *  \param [in] s32FileName_ Wide Characer file name.
+     *
+     *  \remark If the file can't be opened or mapped, then exception is thrown.
+     */
+    InputMappedFileStream(const std::u32string s32FileName_);
+
+    /*! A Constructor
+     *  \brief  Maps the file with the filename string.
+     *
+     *  \param [in] pcFileName_ file name as Character pointer.
+     *
+     *  \remark If pcFileName_ is NULL, or the file can't be opened or mapped, then exception is thrown.
+     */
+    InputMappedFileStream(const char* pcFileName_);
+
+    /*! A destructor, which unmaps the file */
+    virtual ~InputMappedFileStream();
+
+    /*! \fn StreamReadStatus ReadData(ReadDataStructure&)
+     *  \brief Copy the next bytes of the file into ReadDataStructure
+     *
+     *  \param [in] stReadDataStructure_ ReadDataStructure to hold the bytes and the number of bytes requested.
+     *  \return StreamReadStatus read data statistics
+     */
+    StreamReadStatus ReadData(ReadDataStructure& stReadDataStructure_);
+
+    /*! \fn StreamReadStatus ReadDataInPlace(const unsigned char*&, uint32_t)
+     *  \brief Point at the next bytes of the file in the mapping, without copying them.
+     *
+     *  \param [out] pucData_ Set to the first byte read. Valid until the stream is destroyed.
+     *  \param [in] uiDataSize_ The most bytes to read.
+     *  \return StreamReadStatus read data statistics
+     */
+    StreamReadStatus ReadDataInPlace(const unsigned char*& pucData_, uint32_t uiDataSize_);
+
+    /*! \fn StreamReadStatus ReadLine
+     *  \brief Read one line from the file.
+     *
+     *  \param [in] szLine_ String to hold one line of data read from the file.
+     *  \return Returns Read statistics structure (StreamReadStatus)
+     */
+    StreamReadStatus ReadLine(std::string& szLine_);
+
+    /*! \fn void Reset(std::streamoff = 0, std::ios_base::seekdir = std::ios::beg)
+     *  \brief Set/Reset File Position from which next read will be done.
+     *
+     *  \param [in] offset_ the position of the file pointer to read.
+     *  \param [in] dir_ Seeking direction from begining or end.
+     */
+    void Reset(std::streamoff offset_ = 0, std::ios_base::seekdir dir_ = std::ios::beg);
+
+    /*! \n std::string GetFileExtension()
+     *  \brief Returns the extension of the input file to be decoded.
+     *
+     *  \return  std::string - File Extension name
+     */
+    std::string GetFileExtension();
+
+    /*! \n std::string GetFileName()
+     *  \brief Returns the name of the input file to be decoded.
+     *
+     *  \return  std::string - File name
+     */
+    std::string GetFileName();
+
+    /*! \n const std::filesystem::path& GetFilePath()
+     *  \brief Returns the path of the input file to be decoded.
+     *
+     *  \return  The path the stream was created with.
+     */
+    const std::filesystem::path& GetFilePath() const { return clMyFilePath; }
+
+    /*! \n uint64_t  GetCurrentFilePosition()
+     *  \brief Returns the current file position from which next read will be done.
+     *
+     *  \return uint64_t  - File current offset
+     */
+    uint64_t GetCurrentFilePosition();
+
+    /*! \fn void SetCurrentFileOffset(uint64_t  ullCurrentFileOffset_)
+     *  \brief Sets the current file offset. It could be read bytes so far.
+     *
+     *  \param [in] ullCurrentFileOffset_ Size of the data from one read size,
+     *  Will be append to calculate read bytes so far
+     */
+    void SetCurrentFileOffset(uint64_t ullCurrentFileOffset_);
+
+    /*! \fn uint64_t  GetCurrentFileOffset(void)
+     *  \brief Returns Cuurent file offset.
+     *
+     *  \return Cuurent file offset.
+     */
+    uint64_t GetCurrentFileOffset(void) const;
+
+  private:
+    InputMappedFileStream(const InputMappedFileStream&) = delete;
+    const InputMappedFileStream& operator=(const InputMappedFileStream&) = delete;
+
+    /*! \fn void MapFile()
+     *  \brief Open and map clMyFilePath.
+     */
+    void MapFile();
+
+    /*! \fn StreamReadStatus Advance(uint64_t)
+     *  \brief Move the read position forward and report the read statistics.
+     *
+     *  \param [in] ullBytes_ The number of bytes read.
+     *  \return Returns Read statistics structure (StreamReadStatus)
+     */
+    StreamReadStatus Advance(uint64_t ullBytes_);
+
+    std::filesystem::path clMyFilePath;
+    const unsigned char* pucMyData{nullptr};
+    uint64_t ullMyFileLength{0};
+    uint64_t ullMyPosition{0};
+    uint64_t ullMyCurrentFileOffset{0};
+    void* pvMyMappingHandle{nullptr}; //!< Only used on Windows, where the mapping is a separate object from the view.
+};
+
+#endif
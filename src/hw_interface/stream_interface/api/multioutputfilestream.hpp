@@ -38,8 +38,13 @@
 //-----------------------------------------------------------------------
 // Includes
 //-----------------------------------------------------------------------
+#include <atomic>
+#include <exception>
 #include <map>
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "decoders/common/api/common.hpp"
 #include "decoders/common/api/nexcept.h"
@@ -71,6 +76,12 @@
  */
 #define MBYTE_TO_BYTE 1024 * 1024
 
+/*! \def DEFAULT_ASYNC_QUEUE_SIZE
+ *  \brief Default number of writes the asynchronous writer may have queued.
+ *
+ */
+#define DEFAULT_ASYNC_QUEUE_SIZE 256
+
 /*! \class MultiOutputFileStream
  *  \brief A class will provide API's to writing decoded output into multiple out files.
  *
@@ -252,6 +263,37 @@ class MultiOutputFileStream : public OutputStreamInterface
     void SetExtensionName(std::string strExt) { stMyExtentionName = strExt; }
     void SetExtensionName(std::u32string strExt) { s32MyExtentionName = strExt; }
 
+    /*! \fn void SetFlushPolicy(const FileFlushPolicy& stFlushPolicy_)
+     *  \brief Sets when data written to the output files is flushed.
+     *  \param [in] stFlushPolicy_ Durable (the default) or buffered flush policy.
+     *  \remark Applies to the files already open and to every file opened afterwards.
+     *  \sa FileStream::SetFlushPolicy
+     */
+    void SetFlushPolicy(const FileFlushPolicy& stFlushPolicy_);
+
+    /*! \fn void Flush()
+     *  \brief Writes out any buffered data and flushes every open output file.
+     */
+    void Flush() override;
+
+    /*! \fn void ConfigureAsyncWrite(bool bEnable_, uint32_t uiQueueSize_)
+     *  \brief Enable/Disable writing on a background thread.
+     *  \param [in] bEnable_ true to queue writes for a background thread.
+     *  \param [in] uiQueueSize_ Number of writes that may be queued before WriteData() blocks.
+     *  \remark While enabled, WriteData() copies the data into a bounded queue and returns.
+     *  The background thread does the file selection, splitting, opening and writing, so a
+     *  file rotation doesn't hold up the caller. Disabling waits for every queued write.
+     *  Configure splitting and file names before enabling; Flush(), SetFlushPolicy() and the
+     *  destructor wait for the queue to drain. An exception thrown by a background write is
+     *  rethrown by the next call to WriteData() or Flush().
+     */
+    void ConfigureAsyncWrite(bool bEnable_, uint32_t uiQueueSize_ = DEFAULT_ASYNC_QUEUE_SIZE);
+
+    /*! \fn bool IsAsyncWrite()
+     *  \return true if writes are done on a background thread.
+     */
+    bool IsAsyncWrite() const { return !vMyAsyncQueue.empty(); }
+
     /*! Frind class to test private methods. */
     friend class MultiOutputFileStreamTest;
 
@@ -270,6 +312,48 @@ class MultiOutputFileStream : public OutputStreamInterface
      */
     const MultiOutputFileStream& operator=(const MultiOutputFileStream& clTemp);
 
+    /*! \struct AsyncWrite
+     *  \brief A write queued for the background thread.
+     */
+    struct AsyncWrite
+    {
+        std::vector<char> vData;                                                  /**< Copy of the data to write */
+        bool bSelectFile{false};                                                  /**< Select the output file before writing */
+        std::string strMsgName;                                                   /**< Message name for SPLIT_LOG */
+        uint32_t uiSize{0};                                                       /**< Message size for SPLIT_SIZE */
+        novatel::edie::TIME_STATUS eStatus{novatel::edie::TIME_STATUS::UNKNOWN}; /**< Time status for SPLIT_TIME */
+        uint16_t usWeek{0};                                                       /**< GPS week for SPLIT_TIME */
+        double dMilliseconds{0.0};                                                /**< GPS milliseconds for SPLIT_TIME */
+    };
+
+    /*! \fn void SelectSplitFile(const std::string& strMsgName_, uint32_t uiSize_, TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_)
+     *  \brief Selects the output file for the configured split method.
+     */
+    void SelectSplitFile(const std::string& strMsgName_, uint32_t uiSize_, novatel::edie::TIME_STATUS eStatus_, uint16_t usWeek_,
+                         double dMilliseconds_);
+
+    /*! \fn uint32_t QueueWrite(char* pcData_, uint32_t uiDataLength_, bool bSelectFile_, ...)
+     *  \brief Copies a write into the queue, waiting for space if it is full.
+     *  \return uiDataLength_
+     */
+    uint32_t QueueWrite(char* pcData_, uint32_t uiDataLength_, bool bSelectFile_, std::string strMsgName_, uint32_t uiSize_,
+                        novatel::edie::TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_);
+
+    /*! \fn void RunAsyncWriter()
+     *  \brief The background thread: writes queued data in order until stopped.
+     */
+    void RunAsyncWriter();
+
+    /*! \fn void DrainAsyncWrites()
+     *  \brief Waits for every queued write, then rethrows any exception from the background thread.
+     */
+    void DrainAsyncWrites();
+
+    /*! \fn void StopAsyncWriter()
+     *  \brief Drains the queue and joins the background thread.
+     */
+    void StopAsyncWriter();
+
     /*! FileStream class object pointer
      * \sa FileStream
      */
@@ -353,6 +437,23 @@ class MultiOutputFileStream : public OutputStreamInterface
     uint64_t ullMyFileSplitSize{0ULL};
     /*! Total File size */
     uint64_t ullMyFileSize{0ULL};
+    /*! Flush policy given to every output file */
+    FileFlushPolicy stMyFlushPolicy;
+
+    /*! Ring of writes for the background thread, empty when writing synchronously */
+    std::vector<AsyncWrite> vMyAsyncQueue;
+    /*! Number of writes queued, only advanced by the caller's thread */
+    std::atomic<uint64_t> ullMyQueued{0};
+    /*! Number of writes done, only advanced by the background thread */
+    std::atomic<uint64_t> ullMyWritten{0};
+    /*! Tells the background thread to return */
+    std::atomic<bool> bMyStopWriter{false};
+    /*! Exception thrown by the background thread, rethrown on the caller's thread */
+    std::exception_ptr pMyWriterException;
+    /*! Set once pMyWriterException holds an exception */
+    std::atomic<bool> bMyWriterFailed{false};
+    /*! The background thread */
+    std::thread clMyWriterThread;
 };
 
 #endif
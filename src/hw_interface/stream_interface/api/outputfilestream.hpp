@@ -86,6 +86,18 @@ class OutputFileStream : public OutputStreamInterface
      */
     uint32_t WriteData(char* cData, uint32_t uiSize);
 
+    /*! \fn void SetFlushPolicy(const FileFlushPolicy& stFlushPolicy_)
+     *  \brief Sets when data written to the output file is flushed.
+     *  \param [in] stFlushPolicy_ Durable (the default) or buffered flush policy.
+     *  \sa FileStream::SetFlushPolicy
+     */
+    void SetFlushPolicy(const FileFlushPolicy& stFlushPolicy_) { pOutFileStream->SetFlushPolicy(stFlushPolicy_); }
+
+    /*! \fn void Flush()
+     *  \brief Writes out any buffered data and flushes the output file.
+     */
+    void Flush() override { pOutFileStream->FlushFile(); }
+
   private:
     /*! Private Copy Constructor
      *
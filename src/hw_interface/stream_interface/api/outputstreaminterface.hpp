@@ -122,6 +122,13 @@ class OutputStreamInterface
      */
     virtual MemoryStream* GetMemoryStream() { return nullptr; };
 
+    /** A virtual member.
+     *  \sa Flush
+     *  \brief Writes out any data held back by a buffered FileFlushPolicy.
+     *  \remark Streams that don't buffer do nothing.
+     */
+    virtual void Flush(){};
+
     //#ifdef WIDE_CHAR_SUPPORT
     /** A virtual member.
      *  \sa SelectFileStream
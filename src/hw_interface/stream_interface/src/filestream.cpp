@@ -63,7 +63,17 @@ FileStream::FileStream(const char* pcFileName_)
 }
 
 // ---------------------------------------------------------
-FileStream::~FileStream() {}
+FileStream::~FileStream()
+{
+    // Don't lose data held back by a buffered policy, but a destructor mustn't throw
+    try
+    {
+        if (MyStream.is_open()) { WriteBuffer(); }
+    }
+    catch (...)
+    {
+    }
+}
 
 // ---------------------------------------------------------
 // Open the file in different modes.
@@ -110,6 +120,7 @@ void FileStream::OpenFile(FILEMODES eMode)
 // if somebody wants to check the close status.
 void FileStream::CloseFile()
 {
+    if (MyStream.is_open()) { WriteBuffer(); }
     MyStream.close();
     if (MyStream.fail()) throw nExcept("\"%s\" close file failed", clFilePath.u32string().c_str());
 }
@@ -117,8 +128,28 @@ void FileStream::CloseFile()
 // ---------------------------------------------------------
 void FileStream::FlushFile()
 {
+    WriteBuffer();
     MyStream.flush();
     if (MyStream.fail()) throw nExcept("\"%s\" flush file failed", clFilePath.string().c_str());
+    tpMyLastFlush = std::chrono::steady_clock::now();
+}
+
+// ---------------------------------------------------------
+void FileStream::WriteBuffer()
+{
+    if (vMyWriteBuffer.empty()) { return; }
+
+    MyStream.write(vMyWriteBuffer.data(), static_cast<std::streamsize>(vMyWriteBuffer.size()));
+    vMyWriteBuffer.clear();
+    if (MyStream.bad()) { throw nExcept("\"%s\" file  write failed", clFilePath.generic_u32string().c_str()); }
+}
+
+// ---------------------------------------------------------
+void FileStream::SetFlushPolicy(const FileFlushPolicy& stFlushPolicy_)
+{
+    if (!vMyWriteBuffer.empty()) { FlushFile(); }
+    stMyFlushPolicy = stFlushPolicy_;
+    if (!stMyFlushPolicy.bDurable) { vMyWriteBuffer.reserve(stMyFlushPolicy.uiBufferSize); }
 }
 
 // ---------------------------------------------------------
@@ -173,9 +204,30 @@ StreamReadStatus FileStream::ReadLine(std::string& szLine)
 // fstream
 uint32_t FileStream::WriteFile(char* cData, uint32_t uiSize)
 {
-    MyStream.write(cData, uiSize);
-    if (MyStream.bad()) { throw nExcept("\"%s\" file  write failed", clFilePath.generic_u32string().c_str()); }
-    FlushFile();
+    if (stMyFlushPolicy.bDurable)
+    {
+        MyStream.write(cData, uiSize);
+        if (MyStream.bad()) { throw nExcept("\"%s\" file  write failed", clFilePath.generic_u32string().c_str()); }
+        FlushFile();
+        return uiSize;
+    }
+
+    // Flush once the buffer would overflow, and write anything that wouldn't fit in it at all straight through
+    if (vMyWriteBuffer.size() + uiSize > stMyFlushPolicy.uiBufferSize) { FlushFile(); }
+    if (uiSize >= stMyFlushPolicy.uiBufferSize)
+    {
+        MyStream.write(cData, uiSize);
+        if (MyStream.bad()) { throw nExcept("\"%s\" file  write failed", clFilePath.generic_u32string().c_str()); }
+        FlushFile();
+        return uiSize;
+    }
+    vMyWriteBuffer.insert(vMyWriteBuffer.end(), cData, cData + uiSize);
+
+    if (stMyFlushPolicy.uiFlushIntervalMs > 0 &&
+        std::chrono::steady_clock::now() - tpMyLastFlush >= std::chrono::milliseconds(stMyFlushPolicy.uiFlushIntervalMs))
+    {
+        FlushFile();
+    }
     return uiSize;
 }
 
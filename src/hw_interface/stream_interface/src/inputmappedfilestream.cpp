@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include "inputmappedfilestream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "decoders/common/api/nexcept.h"
+
+// code
+// ---------------------------------------------------------
+InputMappedFileStream::InputMappedFileStream(const std::u32string s32FileName_)
+{
+    if (s32FileName_.length() == 0) { throw nExcept("file name is not valid"); }
+    clMyFilePath = std::filesystem::path(s32FileName_);
+    MapFile();
+}
+
+// ---------------------------------------------------------
+InputMappedFileStream::InputMappedFileStream(const char* pcFileName_)
+{
+    if (pcFileName_ == nullptr) { throw nExcept("file name is not valid"); }
+    clMyFilePath = std::filesystem::path(pcFileName_);
+    MapFile();
+}
+
+// ---------------------------------------------------------
+InputMappedFileStream::~InputMappedFileStream()
+{
+#ifdef _WIN32
+    if (pucMyData != nullptr) { UnmapViewOfFile(pucMyData); }
+    if (pvMyMappingHandle != nullptr) { CloseHandle(pvMyMappingHandle); }
+#else
+    if (pucMyData != nullptr) { munmap(const_cast<unsigned char*>(pucMyData), ullMyFileLength); }
+#endif
+}
+
+// ---------------------------------------------------------
+void InputMappedFileStream::MapFile()
+{
+#ifdef _WIN32
+    HANDLE hFile = CreateFileW(clMyFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE) { throw nExcept("file does not exist"); }
+
+    LARGE_INTEGER liFileLength;
+    if (!GetFileSizeEx(hFile, &liFileLength))
+    {
+        CloseHandle(hFile);
+        throw nExcept("\"%s\" file size could not be read", clMyFilePath.string().c_str());
+    }
+    ullMyFileLength = static_cast<uint64_t>(liFileLength.QuadPart);
+
+    // Windows can't map an empty file, and there is nothing to read from one anyway
+    if (ullMyFileLength > 0)
+    {
+        HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(hFile);
+        if (hMapping == nullptr) { throw nExcept("\"%s\" file could not be mapped", clMyFilePath.string().c_str()); }
+
+        const void* pvData = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+        if (pvData == nullptr)
+        {
+            CloseHandle(hMapping);
+            throw nExcept("\"%s\" file could not be mapped", clMyFilePath.string().c_str());
+        }
+        pvMyMappingHandle = hMapping;
+        pucMyData = static_cast<const unsigned char*>(pvData);
+    }
+    else { CloseHandle(hFile); }
+#else
+    const int iFile = open(clMyFilePath.c_str(), O_RDONLY);
+    if (iFile < 0) { throw nExcept("file does not exist"); }
+
+    struct stat stFileStatus;
+    if (fstat(iFile, &stFileStatus) != 0)
+    {
+        close(iFile);
+        throw nExcept("\"%s\" file size could not be read", clMyFilePath.string().c_str());
+    }
+    ullMyFileLength = static_cast<uint64_t>(stFileStatus.st_size);
+
+    // mmap() rejects a zero length, and there is nothing to read from an empty file anyway
+    if (ullMyFileLength > 0)
+    {
+        void* pvData = mmap(nullptr, ullMyFileLength, PROT_READ, MAP_PRIVATE, iFile, 0);
+        close(iFile);
+        if (pvData == MAP_FAILED) { throw nExcept("\"%s\" file could not be mapped", clMyFilePath.string().c_str()); }
+
+        // Let the kernel read ahead aggressively and drop pages behind us
+        madvise(pvData, ullMyFileLength, MADV_SEQUENTIAL);
+        pucMyData = static_cast<const unsigned char*>(pvData);
+    }
+    else { close(iFile); }
+#endif
+}
+
+// ---------------------------------------------------------
+StreamReadStatus InputMappedFileStream::Advance(uint64_t ullBytes_)
+{
+    StreamReadStatus stFileReadStatus;
+
+    ullMyPosition += ullBytes_;
+
+    stFileReadStatus.uiCurrentStreamRead = static_cast<uint32_t>(ullBytes_);
+    stFileReadStatus.uiPercentStreamRead = ullMyFileLength == 0 ? 100 : static_cast<uint32_t>(ullMyPosition * 100 / ullMyFileLength);
+    stFileReadStatus.ullStreamLength = ullMyFileLength;
+    stFileReadStatus.bEOS = ullMyPosition >= ullMyFileLength;
+    return stFileReadStatus;
+}
+
+// ---------------------------------------------------------
+StreamReadStatus InputMappedFileStream::ReadData(ReadDataStructure& stReadDataStructure_)
+{
+    const unsigned char* pucData = nullptr;
+    StreamReadStatus stFileReadStatus = ReadDataInPlace(pucData, stReadDataStructure_.uiDataSize);
+    if (stFileReadStatus.uiCurrentStreamRead > 0) { memcpy(stReadDataStructure_.cData, pucData, stFileReadStatus.uiCurrentStreamRead); }
+    return stFileReadStatus;
+}
+
+// ---------------------------------------------------------
+StreamReadStatus InputMappedFileStream::ReadDataInPlace(const unsigned char*& pucData_, uint32_t uiDataSize_)
+{
+    pucData_ = pucMyData + ullMyPosition;
+    return Advance(std::min<uint64_t>(uiDataSize_, ullMyFileLength - ullMyPosition));
+}
+
+// ---------------------------------------------------------
+StreamReadStatus InputMappedFileStream::ReadLine(std::string& szLine_)
+{
+    const unsigned char* pucStart = pucMyData + ullMyPosition;
+    const unsigned char* pucEnd = pucMyData + ullMyFileLength;
+    const unsigned char* pucNewLine = std::find(pucStart, pucEnd, '\n');
+    szLine_.assign(pucStart, pucNewLine);
+
+    // Like std::getline(), a line that runs into the end of the file reports the end of the stream
+    if (pucNewLine == pucEnd)
+    {
+        ullMyPosition = ullMyFileLength;
+        StreamReadStatus stFileReadStatus;
+        stFileReadStatus.bEOS = true;
+        return stFileReadStatus;
+    }
+
+    StreamReadStatus stFileReadStatus = Advance(szLine_.length() + 1);
+    stFileReadStatus.uiCurrentStreamRead = static_cast<uint32_t>(szLine_.length());
+    stFileReadStatus.bEOS = false;
+    return stFileReadStatus;
+}
+
+// ---------------------------------------------------------
+void InputMappedFileStream::Reset(std::streamoff offset_, std::ios_base::seekdir dir_)
+{
+    const auto llBase = static_cast<std::streamoff>(dir_ == std::ios::cur ? ullMyPosition : dir_ == std::ios::end ? ullMyFileLength : 0);
+    ullMyPosition = static_cast<uint64_t>(std::clamp<std::streamoff>(llBase + offset_, 0, static_cast<std::streamoff>(ullMyFileLength)));
+    ullMyCurrentFileOffset = ullMyPosition;
+}
+
+// ---------------------------------------------------------
+std::string InputMappedFileStream::GetFileExtension()
+{
+    const std::string strExtension = clMyFilePath.extension().string();
+    return strExtension.empty() ? strExtension : strExtension.substr(1);
+}
+
+// ---------------------------------------------------------
+std::string InputMappedFileStream::GetFileName() { return clMyFilePath.string(); }
+
+// ---------------------------------------------------------
+uint64_t InputMappedFileStream::GetCurrentFilePosition() { return ullMyPosition; }
+
+// ---------------------------------------------------------
+void InputMappedFileStream::SetCurrentFileOffset(uint64_t ullCurrentFileOffset_) { ullMyCurrentFileOffset += ullCurrentFileOffset_; }
+
+// ---------------------------------------------------------
+uint64_t InputMappedFileStream::GetCurrentFileOffset(void) const { return ullMyCurrentFileOffset; }
@@ -27,10 +27,20 @@
 
 #include <iterator>
 #include <map>
+#include <utility>
 
 // ---------------------------------------------------------
 MultiOutputFileStream::~MultiOutputFileStream()
 {
+    // Write out everything queued, but a destructor mustn't throw
+    try
+    {
+        StopAsyncWriter();
+    }
+    catch (...)
+    {
+    }
+
     ClearWCFileStreamMap();
     ClearFileStreamMap();
 
@@ -48,6 +58,7 @@ void MultiOutputFileStream::SelectFileStream(std::u32string s32FileName_)
     {
         pLocalFileStream = new FileStream(s32FileName_);
         pLocalFileStream->OpenFile(FileStream::FILEMODES::OUTPUT);
+        pLocalFileStream->SetFlushPolicy(stMyFlushPolicy);
         wmMyFstreamMap.emplace(std::pair<std::u32string, FileStream*>(s32FileName_, pLocalFileStream));
     }
 }
@@ -61,6 +72,7 @@ void MultiOutputFileStream::SelectFileStream(std::string stFileName)
     {
         pLocalFileStream = new FileStream(stFileName.c_str());
         pLocalFileStream->OpenFile(FileStream::FILEMODES::OUTPUT);
+        pLocalFileStream->SetFlushPolicy(stMyFlushPolicy);
         mMyFstreamMap.emplace(std::pair<std::string, FileStream*>(stFileName, pLocalFileStream));
     }
 }
@@ -87,6 +99,23 @@ void MultiOutputFileStream::ClearFileStreamMap()
     }
 }
 
+// ---------------------------------------------------------
+void MultiOutputFileStream::SetFlushPolicy(const FileFlushPolicy& stFlushPolicy_)
+{
+    DrainAsyncWrites();
+    stMyFlushPolicy = stFlushPolicy_;
+    for (auto& [strFileName, pclFileStream] : mMyFstreamMap) { pclFileStream->SetFlushPolicy(stMyFlushPolicy); }
+    for (auto& [s32FileName, pclFileStream] : wmMyFstreamMap) { pclFileStream->SetFlushPolicy(stMyFlushPolicy); }
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::Flush()
+{
+    DrainAsyncWrites();
+    for (auto& [strFileName, pclFileStream] : mMyFstreamMap) { pclFileStream->FlushFile(); }
+    for (auto& [s32FileName, pclFileStream] : wmMyFstreamMap) { pclFileStream->FlushFile(); }
+}
+
 // ---------------------------------------------------------
 void MultiOutputFileStream::ConfigureSplitByLog(bool bStatus)
 {
@@ -296,9 +325,135 @@ void MultiOutputFileStream::SelectTimeFile(novatel::edie::TIME_STATUS eStatus_,
     }
 }
 
+// ---------------------------------------------------------
+void MultiOutputFileStream::ConfigureAsyncWrite(bool bEnable_, uint32_t uiQueueSize_)
+{
+    StopAsyncWriter();
+    if (!bEnable_) { return; }
+
+    vMyAsyncQueue.resize(uiQueueSize_ > 0 ? uiQueueSize_ : 1);
+    ullMyQueued = 0;
+    ullMyWritten = 0;
+    bMyStopWriter = false;
+    clMyWriterThread = std::thread(&MultiOutputFileStream::RunAsyncWriter, this);
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::StopAsyncWriter()
+{
+    if (vMyAsyncQueue.empty()) { return; }
+
+    // Wait for the queue to drain before waking the background thread to stop
+    uint64_t ullQueued = ullMyQueued.load(std::memory_order_relaxed);
+    for (uint64_t ullWritten = ullMyWritten.load(std::memory_order_acquire); ullWritten < ullQueued;
+         ullWritten = ullMyWritten.load(std::memory_order_acquire))
+    {
+        ullMyWritten.wait(ullWritten, std::memory_order_acquire);
+    }
+    bMyStopWriter = true;
+    ullMyQueued.fetch_add(1, std::memory_order_release);
+    ullMyQueued.notify_one();
+    clMyWriterThread.join();
+    vMyAsyncQueue.clear();
+
+    if (bMyWriterFailed.exchange(false, std::memory_order_acquire)) { std::rethrow_exception(std::exchange(pMyWriterException, nullptr)); }
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::DrainAsyncWrites()
+{
+    if (vMyAsyncQueue.empty()) { return; }
+
+    uint64_t ullQueued = ullMyQueued.load(std::memory_order_relaxed);
+    for (uint64_t ullWritten = ullMyWritten.load(std::memory_order_acquire); ullWritten < ullQueued;
+         ullWritten = ullMyWritten.load(std::memory_order_acquire))
+    {
+        ullMyWritten.wait(ullWritten, std::memory_order_acquire);
+    }
+
+    // The background thread is idle until the next write is queued, so the exception is ours to take
+    if (bMyWriterFailed.exchange(false, std::memory_order_acquire)) { std::rethrow_exception(std::exchange(pMyWriterException, nullptr)); }
+}
+
+// ---------------------------------------------------------
+uint32_t MultiOutputFileStream::QueueWrite(char* pcData_, uint32_t uiDataLength_, bool bSelectFile_, std::string strMsgName_, uint32_t uiSize_,
+                                           novatel::edie::TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_)
+{
+    if (bMyWriterFailed.load(std::memory_order_acquire)) { DrainAsyncWrites(); }
+
+    // Back-pressure: wait for the background thread to free the oldest slot
+    const uint64_t ullQueued = ullMyQueued.load(std::memory_order_relaxed);
+    for (uint64_t ullWritten = ullMyWritten.load(std::memory_order_acquire); ullQueued - ullWritten >= vMyAsyncQueue.size();
+         ullWritten = ullMyWritten.load(std::memory_order_acquire))
+    {
+        ullMyWritten.wait(ullWritten, std::memory_order_acquire);
+    }
+
+    AsyncWrite& stWrite = vMyAsyncQueue[ullQueued % vMyAsyncQueue.size()];
+    stWrite.vData.assign(pcData_, pcData_ + uiDataLength_);
+    stWrite.bSelectFile = bSelectFile_;
+    stWrite.strMsgName = std::move(strMsgName_);
+    stWrite.uiSize = uiSize_;
+    stWrite.eStatus = eStatus_;
+    stWrite.usWeek = usWeek_;
+    stWrite.dMilliseconds = dMilliseconds_;
+
+    ullMyQueued.store(ullQueued + 1, std::memory_order_release);
+    ullMyQueued.notify_one();
+    return uiDataLength_;
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::RunAsyncWriter()
+{
+    for (uint64_t ullWritten = 0;; ++ullWritten)
+    {
+        uint64_t ullQueued = ullMyQueued.load(std::memory_order_acquire);
+        while (ullQueued <= ullWritten)
+        {
+            if (bMyStopWriter) { return; }
+            ullMyQueued.wait(ullQueued, std::memory_order_acquire);
+            ullQueued = ullMyQueued.load(std::memory_order_acquire);
+        }
+        if (bMyStopWriter) { return; }
+
+        AsyncWrite& stWrite = vMyAsyncQueue[ullWritten % vMyAsyncQueue.size()];
+        try
+        {
+            if (stWrite.bSelectFile) { SelectSplitFile(stWrite.strMsgName, stWrite.uiSize, stWrite.eStatus, stWrite.usWeek, stWrite.dMilliseconds); }
+            if (pLocalFileStream) { pLocalFileStream->WriteFile(stWrite.vData.data(), static_cast<uint32_t>(stWrite.vData.size())); }
+        }
+        catch (...)
+        {
+            // Keep the first failure for the caller and carry on with the rest of the queue
+            if (!bMyWriterFailed.load(std::memory_order_relaxed))
+            {
+                pMyWriterException = std::current_exception();
+                bMyWriterFailed.store(true, std::memory_order_release);
+            }
+        }
+
+        ullMyWritten.store(ullWritten + 1, std::memory_order_release);
+        ullMyWritten.notify_all();
+    }
+}
+
 // ---------------------------------------------------------
 uint32_t MultiOutputFileStream::WriteData(char* pcData_, uint32_t uiDataLength_, std::string strMsgName_, uint32_t uiSize_,
                                           novatel::edie::TIME_STATUS eStatus_, uint16_t usWeek_, double dMilliseconds_)
+{
+    if (!vMyAsyncQueue.empty())
+    {
+        return QueueWrite(pcData_, uiDataLength_, bMyFileSplit, std::move(strMsgName_), uiSize_, eStatus_, usWeek_, dMilliseconds_);
+    }
+
+    SelectSplitFile(strMsgName_, uiSize_, eStatus_, usWeek_, dMilliseconds_);
+    return pLocalFileStream ? pLocalFileStream->WriteFile(pcData_, uiDataLength_) : 0;
+}
+
+// ---------------------------------------------------------
+void MultiOutputFileStream::SelectSplitFile(const std::string& strMsgName_, uint32_t uiSize_, novatel::edie::TIME_STATUS eStatus_, uint16_t usWeek_,
+                                            double dMilliseconds_)
 {
     if (bMyFileSplit)
     {
@@ -327,11 +482,12 @@ uint32_t MultiOutputFileStream::WriteData(char* pcData_, uint32_t uiDataLength_,
         default: break;
         }
     }
-    return WriteData(pcData_, uiDataLength_);
 }
 
 // ---------------------------------------------------------
 uint32_t MultiOutputFileStream::WriteData(char* pcData_, uint32_t uiDataLength_)
 {
+    if (!vMyAsyncQueue.empty()) { return QueueWrite(pcData_, uiDataLength_, false, std::string(), 0, novatel::edie::TIME_STATUS::UNKNOWN, 0, 0.0); }
+
     return pLocalFileStream ? pLocalFileStream->WriteFile(pcData_, uiDataLength_) : 0;
 }
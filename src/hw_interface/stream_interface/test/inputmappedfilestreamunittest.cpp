@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2020 NovAtel Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+#include "hw_interface/stream_interface/api/inputmappedfilestream.hpp"
+
+class InputMappedFileStreamTest : public ::testing::Test
+{
+  public:
+    virtual void SetUp() {}
+
+    virtual void TearDown() {}
+
+  protected:
+    static std::string TestFile() { return (std::filesystem::path(std::getenv("TEST_RESOURCE_PATH")) / "streaminterface_testread.asc").string(); }
+};
+
+TEST_F(InputMappedFileStreamTest, ReadData)
+{
+    InputMappedFileStream clStream(TestFile().c_str());
+    ReadDataStructure stReadDataStructure;
+    char acData[21] = {};
+    stReadDataStructure.uiDataSize = 20;
+    stReadDataStructure.cData = acData;
+    StreamReadStatus stReadStatus = clStream.ReadData(stReadDataStructure);
+    ASSERT_STREQ("This is a test file.", acData);
+    ASSERT_EQ(stReadStatus.uiCurrentStreamRead, 20U);
+    ASSERT_EQ(stReadStatus.ullStreamLength, std::filesystem::file_size(TestFile()));
+    ASSERT_FALSE(stReadStatus.bEOS);
+}
+
+TEST_F(InputMappedFileStreamTest, ReadDataWideCharPath)
+{
+    InputMappedFileStream clStream(
+        std::u32string(((std::filesystem::path(std::getenv("TEST_RESOURCE_PATH")) / U"inputfilestream不同语言的文件.gps").generic_u32string())));
+    const unsigned char* pucData = nullptr;
+    StreamReadStatus stReadStatus = clStream.ReadDataInPlace(pucData, 69);
+    ASSERT_EQ(stReadStatus.uiCurrentStreamRead, 69U);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(pucData), 69), "#RANGEA,COM1,0,77.5,FINESTEERING,2195,512277.000,02000020,9691,16696;");
+}
+
+TEST_F(InputMappedFileStreamTest, ReadDataInPlace)
+{
+    InputMappedFileStream clStream(TestFile().c_str());
+    const uint64_t ullFileLength = std::filesystem::file_size(TestFile());
+    const unsigned char* pucData = nullptr;
+
+    StreamReadStatus stReadStatus = clStream.ReadDataInPlace(pucData, 5);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(pucData), stReadStatus.uiCurrentStreamRead), "This ");
+    ASSERT_EQ(stReadStatus.uiPercentStreamRead, 5 * 100 / ullFileLength);
+
+    // Reading past the end returns what is left, then nothing
+    stReadStatus = clStream.ReadDataInPlace(pucData, UINT32_MAX);
+    ASSERT_EQ(stReadStatus.uiCurrentStreamRead, ullFileLength - 5);
+    ASSERT_EQ(stReadStatus.uiPercentStreamRead, 100U);
+    ASSERT_TRUE(stReadStatus.bEOS);
+
+    stReadStatus = clStream.ReadDataInPlace(pucData, 5);
+    ASSERT_EQ(stReadStatus.uiCurrentStreamRead, 0U);
+    ASSERT_TRUE(stReadStatus.bEOS);
+}
+
+TEST_F(InputMappedFileStreamTest, ReadLine)
+{
+    InputMappedFileStream clStream(TestFile().c_str());
+    std::string strLine;
+
+    StreamReadStatus stReadStatus = clStream.ReadLine(strLine);
+    ASSERT_EQ(strLine, "This is a test file. it will\r");
+    ASSERT_EQ(strLine.size(), stReadStatus.uiCurrentStreamRead);
+    ASSERT_FALSE(stReadStatus.bEOS);
+
+    stReadStatus = clStream.ReadLine(strLine);
+    ASSERT_EQ(strLine, "be used to perform unit test cases\r");
+    ASSERT_FALSE(stReadStatus.bEOS);
+
+    stReadStatus = clStream.ReadLine(strLine);
+    ASSERT_EQ(strLine, "for file stream functionalities.\r");
+    ASSERT_FALSE(stReadStatus.bEOS);
+
+    while (!stReadStatus.bEOS) { stReadStatus = clStream.ReadLine(strLine); }
+    ASSERT_EQ(clStream.GetCurrentFilePosition(), std::filesystem::file_size(TestFile()));
+}
+
+TEST_F(InputMappedFileStreamTest, Reset)
+{
+    InputMappedFileStream clStream(TestFile().c_str());
+    const unsigned char* pucData = nullptr;
+
+    clStream.ReadDataInPlace(pucData, 20);
+    clStream.Reset();
+    StreamReadStatus stReadStatus = clStream.ReadDataInPlace(pucData, 5);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(pucData), stReadStatus.uiCurrentStreamRead), "This ");
+
+    clStream.Reset(2, std::ios::beg);
+    stReadStatus = clStream.ReadDataInPlace(pucData, 5);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(pucData), stReadStatus.uiCurrentStreamRead), "is is");
+
+    clStream.Reset(-3, std::ios::cur);
+    stReadStatus = clStream.ReadDataInPlace(pucData, 5);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(pucData), stReadStatus.uiCurrentStreamRead), " is a");
+
+    clStream.Reset(0, std::ios::end);
+    ASSERT_TRUE(clStream.ReadDataInPlace(pucData, 5).bEOS);
+}
+
+TEST_F(InputMappedFileStreamTest, GetFileExtension)
+{
+    InputMappedFileStream clStream(TestFile().c_str());
+    ASSERT_EQ(clStream.GetFileExtension(), "asc");
+    ASSERT_EQ(clStream.GetFileName(), TestFile());
+}
+
+TEST_F(InputMappedFileStreamTest, GetCurrentFileStats)
+{
+    InputMappedFileStream clStream(TestFile().c_str());
+    const unsigned char* pucData = nullptr;
+
+    clStream.ReadDataInPlace(pucData, 5);
+    ASSERT_EQ(clStream.GetCurrentFilePosition(), 5U);
+    ASSERT_EQ(clStream.GetCurrentFileOffset(), 0U);
+
+    clStream.Reset(7);
+    ASSERT_EQ(clStream.GetCurrentFilePosition(), 7U);
+    ASSERT_EQ(clStream.GetCurrentFileOffset(), 7U);
+}
+
+TEST_F(InputMappedFileStreamTest, MissingFile)
+{
+    ASSERT_ANY_THROW(InputMappedFileStream clStream((std::filesystem::path(std::getenv("TEST_RESOURCE_PATH")) / "missing.asc").string().c_str()));
+}
@@ -31,6 +31,8 @@
 #include <gtest/gtest.h>
 
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 
 #include "hw_interface/stream_interface/api/multioutputfilestream.hpp"
 #include "string"
@@ -320,3 +322,75 @@ TEST_F(MultiOutputFileStreamTest, SelectTimeFile)
 
     delete pMyTestCommand;
 }
+
+TEST_F(MultiOutputFileStreamTest, AsyncWriteSplitByLog)
+{
+    const std::filesystem::path clBase = std::filesystem::temp_directory_path() / "AsyncLog.txt";
+    const std::filesystem::path clBestPos = std::filesystem::temp_directory_path() / "AsyncLog_BESTPOS.txt";
+    const std::filesystem::path clRange = std::filesystem::temp_directory_path() / "AsyncLog_RANGE.txt";
+
+    pMyTestCommand = new MultiOutputFileStream();
+    pMyTestCommand->ConfigureSplitByLog(true);
+    pMyTestCommand->ConfigureBaseFileName(clBase.string());
+    // A queue shorter than the number of writes makes the caller wait for the background thread
+    pMyTestCommand->ConfigureAsyncWrite(true, 2);
+    ASSERT_TRUE(pMyTestCommand->IsAsyncWrite());
+
+    std::string strBestPos, strRange;
+    for (int32_t i = 0; i < 100; ++i)
+    {
+        std::string strData = std::to_string(i) + ";";
+        const bool bBestPos = i % 3 == 0;
+        ASSERT_EQ(pMyTestCommand->WriteData(strData.data(), static_cast<uint32_t>(strData.size()), bBestPos ? "BESTPOS" : "RANGE", 0,
+                                            novatel::edie::TIME_STATUS::UNKNOWN, 0, 0.0),
+                  strData.size());
+        (bBestPos ? strBestPos : strRange) += strData;
+    }
+    pMyTestCommand->Flush();
+    ASSERT_EQ(GetMap().size(), 2U);
+
+    // The destructor drains the queue too
+    char pcCommand[] = "END";
+    pMyTestCommand->WriteData(pcCommand, 3, "RANGE", 0, novatel::edie::TIME_STATUS::UNKNOWN, 0, 0.0);
+    delete pMyTestCommand;
+    strRange += "END";
+
+    std::stringstream clBestPosData, clRangeData;
+    clBestPosData << std::ifstream(clBestPos).rdbuf();
+    clRangeData << std::ifstream(clRange).rdbuf();
+    ASSERT_EQ(clBestPosData.str(), strBestPos);
+    ASSERT_EQ(clRangeData.str(), strRange);
+
+    std::filesystem::remove(clBestPos);
+    std::filesystem::remove(clRange);
+}
+
+TEST_F(MultiOutputFileStreamTest, AsyncWriteSplitBySize)
+{
+    const std::filesystem::path clBase = std::filesystem::temp_directory_path() / "AsyncSize.txt";
+
+    pMyTestCommand = new MultiOutputFileStream();
+    pMyTestCommand->ConfigureSplitBySize(1);
+    pMyTestCommand->ConfigureBaseFileName(clBase.string());
+    pMyTestCommand->ConfigureAsyncWrite(true, 4);
+
+    // Three 600 KB writes rotate once the first two have filled a 1 MB part
+    std::vector<char> vData(600 * 1024, 'x');
+    for (int32_t i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(pMyTestCommand->WriteData(vData.data(), static_cast<uint32_t>(vData.size()), "", static_cast<uint32_t>(vData.size()),
+                                            novatel::edie::TIME_STATUS::UNKNOWN, 0, 0.0),
+                  vData.size());
+    }
+    pMyTestCommand->ConfigureAsyncWrite(false);
+    ASSERT_FALSE(pMyTestCommand->IsAsyncWrite());
+    ASSERT_EQ(GetFileCount(), 1U);
+    delete pMyTestCommand;
+
+    const std::filesystem::path clPart0 = std::filesystem::temp_directory_path() / "AsyncSize_Part0.txt";
+    const std::filesystem::path clPart1 = std::filesystem::temp_directory_path() / "AsyncSize_Part1.txt";
+    ASSERT_EQ(std::filesystem::file_size(clPart0), 2 * vData.size());
+    ASSERT_EQ(std::filesystem::file_size(clPart1), vData.size());
+    std::filesystem::remove(clPart0);
+    std::filesystem::remove(clPart1);
+}
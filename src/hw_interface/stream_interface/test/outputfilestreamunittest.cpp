@@ -26,7 +26,10 @@
 #include <gtest/gtest.h>
 
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 #include <string>
+#include <thread>
 
 #include "hw_interface/stream_interface/api/outputfilestream.hpp"
 
@@ -61,3 +64,73 @@ TEST_F(OutputFileStreamTest, ConstructorWideChar)
     delete pMyTestCommand;
     std::cout << "Made it past ASSERT and Delete. Output Stream Test, Constructor WC" << std::endl;
 }
+
+namespace {
+std::string ReadBack(const std::filesystem::path& clPath_)
+{
+    std::ifstream clFile(clPath_, std::ios::binary);
+    std::stringstream clContents;
+    clContents << clFile.rdbuf();
+    return clContents.str();
+}
+} // namespace
+
+// Durable writes reach the file straight away
+TEST_F(OutputFileStreamTest, FlushPolicyDurable)
+{
+    const std::filesystem::path clPath = std::filesystem::temp_directory_path() / "outputfilestream_durable.txt";
+    char acData[] = "0123456789";
+    {
+        OutputFileStream clStream(clPath.string().c_str());
+        ASSERT_TRUE(clStream.pOutFileStream->GetFlushPolicy().bDurable);
+        ASSERT_EQ(clStream.WriteData(acData, 10), 10U);
+        ASSERT_EQ(ReadBack(clPath), "0123456789");
+    }
+    std::filesystem::remove(clPath);
+}
+
+// Buffered writes are held back until the buffer fills, Flush() is called or the stream is closed
+TEST_F(OutputFileStreamTest, FlushPolicyBuffered)
+{
+    const std::filesystem::path clPath = std::filesystem::temp_directory_path() / "outputfilestream_buffered.txt";
+    char acData[] = "0123456789";
+    {
+        OutputFileStream clStream(clPath.string().c_str());
+        clStream.SetFlushPolicy(FileFlushPolicy(16));
+        ASSERT_FALSE(clStream.pOutFileStream->GetFlushPolicy().bDurable);
+
+        ASSERT_EQ(clStream.WriteData(acData, 10), 10U);
+        ASSERT_EQ(ReadBack(clPath), "");
+
+        // The next write would overflow the buffer, so the first is written out
+        ASSERT_EQ(clStream.WriteData(acData, 10), 10U);
+        ASSERT_EQ(ReadBack(clPath), "0123456789");
+
+        clStream.Flush();
+        ASSERT_EQ(ReadBack(clPath), "01234567890123456789");
+
+        // Writes as large as the buffer go straight through
+        char acLarge[] = "abcdefghijklmnopqrstuvwxyz";
+        ASSERT_EQ(clStream.WriteData(acLarge, 26), 26U);
+        ASSERT_EQ(ReadBack(clPath), "01234567890123456789abcdefghijklmnopqrstuvwxyz");
+
+        ASSERT_EQ(clStream.WriteData(acData, 5), 5U);
+    }
+    ASSERT_EQ(ReadBack(clPath), "01234567890123456789abcdefghijklmnopqrstuvwxyz01234");
+    std::filesystem::remove(clPath);
+}
+
+// A buffered write after the flush interval has passed flushes everything held back
+TEST_F(OutputFileStreamTest, FlushPolicyInterval)
+{
+    const std::filesystem::path clPath = std::filesystem::temp_directory_path() / "outputfilestream_interval.txt";
+    char acData[] = "0123456789";
+    {
+        OutputFileStream clStream(clPath.string().c_str());
+        clStream.SetFlushPolicy(FileFlushPolicy(1024, 1));
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        ASSERT_EQ(clStream.WriteData(acData, 10), 10U);
+        ASSERT_EQ(ReadBack(clPath), "0123456789");
+    }
+    std::filesystem::remove(clPath);
+}